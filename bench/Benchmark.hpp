@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace zia::bench {
+    // Run settings shared by every benchmark (see main.cpp for the command line).
+    struct BenchOptions {
+        // Timed runs per benchmark; the median run is reported.
+        int repetitions = 5;
+        // Frames simulated per run by the macro benchmarks.
+        int frames = 5000;
+        // Largest entity count used by the ECS micro benchmarks.
+        int max_entities = 100000;
+        // Only benchmarks whose name contains this string are run (empty = all).
+        std::string filter;
+    };
+
+    // Extra measurements a benchmark reports next to its timing (draws per frame, p99 frame time...).
+    // Recorded from the median run.
+    class BenchRun {
+    public:
+        void metric(std::string name, double value);
+        [[nodiscard]] const std::vector<std::pair<std::string, double>>& metrics() const noexcept { return _metrics; }
+
+    private:
+        std::vector<std::pair<std::string, double>> _metrics;
+    };
+
+    // One benchmark. 'setup' runs untimed before every repetition and builds the state 'run' works on
+    // (both usually capture the same shared state); 'run' is timed and performs 'ops' operations, so
+    // results are comparable across sizes as nanoseconds per operation.
+    struct Benchmark {
+        std::string name;
+        // "micro" or "macro".
+        std::string group;
+        std::uint64_t ops = 1;
+        std::function<void()> setup;
+        std::function<void(BenchRun&)> run;
+    };
+
+    struct BenchResult {
+        std::string name;
+        std::string group;
+        std::uint64_t ops = 0;
+        int repetitions = 0;
+        // Per-operation times over the repetitions. The median is the compared value.
+        double median_ns = 0.0;
+        double min_ns = 0.0;
+        double max_ns = 0.0;
+        // Heap allocations per operation (0 unless built with ZIA_TRACK_ALLOCATIONS).
+        double allocations = 0.0;
+        std::vector<std::pair<std::string, double>> metrics;
+    };
+
+    // Registered benchmarks, in registration order.
+    class BenchSuite {
+    public:
+        void add(Benchmark benchmark);
+        [[nodiscard]] const std::vector<Benchmark>& benchmarks() const noexcept { return _benchmarks; }
+
+        // Run every benchmark matching options.filter, printing one line per result.
+        [[nodiscard]] std::vector<BenchResult> run(const BenchOptions& options) const;
+
+    private:
+        std::vector<Benchmark> _benchmarks;
+    };
+
+    // A pass/fail check run by --check instead of the benchmarks (checks.cpp). 'run' reports what went
+    // wrong on stderr and returns false.
+    struct Check {
+        std::string name;
+        std::function<bool()> run;
+    };
+
+    // The checks of this build, in order. The no_alloc/ checks need ZIA_TRACK_ALLOCATIONS and are
+    // left out without it.
+    std::vector<Check> checks();
+
+    // Level generated for the benchmarks (see LevelGenerator.hpp) with its compiled .zlvl.
+    struct StressLevel {
+        std::string name;
+        std::filesystem::path path;
+    };
+
+    // The generated stress levels, written to the temp directory on first use. Levels that cannot be
+    // written are left out.
+    const std::vector<StressLevel>& stress_levels();
+
+    // Keeps a computed value alive so the optimizer cannot drop the work that produced it.
+    void consume(double value);
+
+    // Populate the suite (micro_benchmarks.cpp, macro_benchmarks.cpp).
+    void register_micro_benchmarks(BenchSuite& suite, const BenchOptions& options);
+    void register_macro_benchmarks(BenchSuite& suite, const BenchOptions& options);
+
+    // Write results as JSON: {"schema":1,"build":{...},"options":{...},"results":[...]}.
+    bool write_results(const std::filesystem::path& path, const std::vector<BenchResult>& results, const BenchOptions& options);
+
+    // Compare results against a file written by write_results. A benchmark regresses when its median
+    // time per operation exceeds the baseline's by more than threshold_percent; benchmarks missing from
+    // either side are listed but never fail. Returns the number of regressions, or -1 when the baseline
+    // cannot be read.
+    int compare_with_baseline(const std::filesystem::path& baseline, const std::vector<BenchResult>& results,
+                              double threshold_percent);
+} // namespace zia::bench
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Zia/engine/IEntityManager.hpp"
+#include "Zia/engine/adapters/EntityManagerAdapter.hpp"
+#include "Zia/engine/adapters/InputAdapter.hpp"
+#include "Zia/engine/render/RecordingRenderer.hpp"
+#include "Zia/game/PlayPipeline.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace zia::bench {
+    // A level played without a window: the PlayPipeline that PlayScene runs, driven by scripted input
+    // and drawn into a RecordingRenderer. Textures are empty stand-ins, so draws are recorded (and
+    // counted) exactly as in the game but nothing touches the GPU.
+    class HeadlessSession {
+    public:
+        // Totals since the last load().
+        struct Stats {
+            std::uint64_t frames = 0;
+            std::uint64_t draws = 0;
+            std::uint64_t sprite_draws = 0;
+            std::uint64_t texture_switches = 0;
+            // Level transitions, handled as in the game: falls below the map restore the level start
+            // snapshot and level ends advance to the next level.
+            std::uint64_t restarts = 0;
+        };
+
+        explicit HeadlessSession(sf::Vector2u window_size = {800u, 480u});
+        ~HeadlessSession();
+
+        HeadlessSession(const HeadlessSession&) = delete;
+        HeadlessSession& operator=(const HeadlessSession&) = delete;
+
+        // Load a level (compiled .zlvl when present, like the game) and populate it.
+        void load(const std::string& level_path);
+
+        // Simulate and render one frame with a fixed time step. The input script holds MoveRight and
+        // jumps periodically, so the player crosses the level and streams its chunks in.
+        void step(float dt);
+
+        [[nodiscard]] const Stats& stats() const noexcept { return _stats; }
+        [[nodiscard]] zia::engine::IEntityManager& registry() noexcept { return _registry; }
+        // The running pipeline (valid after load()), for snapshots.
+        [[nodiscard]] PlayPipeline& pipeline() noexcept { return *_pipeline; }
+
+    private:
+        void update_input();
+        void render();
+
+        std::uint64_t _script_frame = 0;
+
+        zia::engine::RecordingRenderer _renderer;
+        std::shared_ptr<zia::engine::IAssetManager> _assets;
+        std::shared_ptr<zia::InputManager> _input_state;
+        zia::engine::adapters::InputAdapter _input;
+        zia::engine::adapters::EntityManagerAdapter _registry;
+        // Declared after what it references: its HUD releases renderer text handles on destruction.
+        std::unique_ptr<PlayPipeline> _pipeline;
+
+        Stats _stats;
+    };
+} // namespace zia::bench
@@ -0,0 +1,218 @@
+// Implements the benchmark runner: repetitions and timing, the JSON result file and the baseline
+// comparison used to fail CI runs on performance regressions.
+
+#include "Benchmark.hpp"
+#include "Zia/engine/profiling/AllocationTracker.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
+#include "Zia/game/world/JsonDocument.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <map>
+
+namespace zia::bench {
+    namespace {
+        // Names and metric keys are plain identifiers, but keep the output valid JSON regardless.
+        std::string json_string(const std::string& text) {
+            std::string out = "\"";
+            for (const char c : text) {
+                if (c == '"' || c == '\\') {
+                    out += '\\';
+                    out += c;
+                } else if (static_cast<unsigned char>(c) >= 0x20) {
+                    out += c;
+                }
+            }
+            out += '"';
+            return out;
+        }
+
+        std::string json_number(double value) {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+            return buffer;
+        }
+
+        std::string compiler_name() {
+#if defined(__clang__)
+            return "clang " __clang_version__;
+#elif defined(__GNUC__)
+            return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+            return "msvc " + std::to_string(_MSC_VER);
+#else
+            return "unknown";
+#endif
+        }
+
+        std::string format_ns(double ns) {
+            char buffer[32];
+            if (ns >= 1e6) {
+                std::snprintf(buffer, sizeof(buffer), "%.3f ms", ns / 1e6);
+            } else if (ns >= 1e3) {
+                std::snprintf(buffer, sizeof(buffer), "%.3f us", ns / 1e3);
+            } else {
+                std::snprintf(buffer, sizeof(buffer), "%.1f ns", ns);
+            }
+            return buffer;
+        }
+    }
+
+    void consume(double value) {
+        static volatile double sink = 0.0;
+        sink = sink + value;
+    }
+
+    void BenchRun::metric(std::string name, double value) {
+        _metrics.emplace_back(std::move(name), value);
+    }
+
+    void BenchSuite::add(Benchmark benchmark) {
+        _benchmarks.push_back(std::move(benchmark));
+    }
+
+    // Used by: main
+    std::vector<BenchResult> BenchSuite::run(const BenchOptions& options) const {
+        using Clock = std::chrono::steady_clock;
+        namespace alloc = zia::engine::allocation_tracker;
+
+        std::vector<BenchResult> results;
+        for (const auto& benchmark : _benchmarks) {
+            if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+
+            const int repetitions = std::max(1, options.repetitions);
+            const double ops = static_cast<double>(std::max<std::uint64_t>(1, benchmark.ops));
+            struct Sample {
+                double ns_per_op;
+                double allocations_per_op;
+                BenchRun run;
+            };
+            std::vector<Sample> samples;
+            samples.reserve(static_cast<std::size_t>(repetitions));
+
+            for (int rep = 0; rep < repetitions; ++rep) {
+                if (benchmark.setup) benchmark.setup();
+                Sample sample{};
+                const auto allocations_before = alloc::process_counters().allocations;
+                const auto start = Clock::now();
+                benchmark.run(sample.run);
+                const auto end = Clock::now();
+                const auto allocations = alloc::process_counters().allocations - allocations_before;
+                sample.ns_per_op = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / ops;
+                sample.allocations_per_op = static_cast<double>(allocations) / ops;
+                samples.push_back(std::move(sample));
+            }
+
+            std::sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b) { return a.ns_per_op < b.ns_per_op; });
+            const Sample& median = samples[samples.size() / 2];
+
+            BenchResult result;
+            result.name = benchmark.name;
+            result.group = benchmark.group;
+            result.ops = benchmark.ops;
+            result.repetitions = repetitions;
+            result.median_ns = median.ns_per_op;
+            result.min_ns = samples.front().ns_per_op;
+            result.max_ns = samples.back().ns_per_op;
+            result.allocations = median.allocations_per_op;
+            result.metrics = median.run.metrics();
+
+            std::cout << "  " << result.name << ": " << format_ns(result.median_ns) << "/op"
+                      << " (min " << format_ns(result.min_ns) << ", max " << format_ns(result.max_ns) << ")";
+            if constexpr (alloc::compiled_in()) {
+                std::cout << ", " << json_number(result.allocations) << " allocs/op";
+            }
+            std::cout << std::endl;
+            results.push_back(std::move(result));
+        }
+        return results;
+    }
+
+    // Used by: main (--out)
+    bool write_results(const std::filesystem::path& path, const std::vector<BenchResult>& results, const BenchOptions& options) {
+        std::ofstream out(path, std::ios::trunc);
+        if (!out) {
+            std::cerr << "zia_bench: cannot write '" << path.string() << "'" << std::endl;
+            return false;
+        }
+
+#ifdef NDEBUG
+        const bool assertions = false;
+#else
+        const bool assertions = true;
+#endif
+        out << "{\n  \"schema\": 1,\n";
+        out << "  \"build\": {\"compiler\": " << json_string(compiler_name())
+            << ", \"assertions\": " << (assertions ? "true" : "false")
+            << ", \"profiler\": " << (ZIA_ENABLE_PROFILER ? "true" : "false")
+            << ", \"allocation_tracking\": " << (zia::engine::allocation_tracker::compiled_in() ? "true" : "false") << "},\n";
+        out << "  \"options\": {\"repetitions\": " << options.repetitions << ", \"frames\": " << options.frames
+            << ", \"max_entities\": " << options.max_entities << ", \"filter\": " << json_string(options.filter) << "},\n";
+        out << "  \"results\": [";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto& result = results[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << "    {\"name\": " << json_string(result.name) << ", \"group\": " << json_string(result.group)
+                << ", \"ops\": " << result.ops << ", \"repetitions\": " << result.repetitions
+                << ", \"median_ns\": " << json_number(result.median_ns) << ", \"min_ns\": " << json_number(result.min_ns)
+                << ", \"max_ns\": " << json_number(result.max_ns) << ", \"allocations\": " << json_number(result.allocations)
+                << ", \"metrics\": {";
+            for (std::size_t m = 0; m < result.metrics.size(); ++m) {
+                out << (m == 0 ? "" : ", ") << json_string(result.metrics[m].first) << ": " << json_number(result.metrics[m].second);
+            }
+            out << "}}";
+        }
+        out << "\n  ]\n}\n";
+        return static_cast<bool>(out);
+    }
+
+    // Used by: main (--baseline)
+    int compare_with_baseline(const std::filesystem::path& baseline, const std::vector<BenchResult>& results,
+                              double threshold_percent) {
+        std::ifstream in(baseline, std::ios::binary);
+        if (!in) {
+            std::cerr << "zia_bench: cannot read baseline '" << baseline.string() << "'" << std::endl;
+            return -1;
+        }
+        std::ostringstream text;
+        text << in.rdbuf();
+        JsonDocument document;
+        if (!document.parse(text.str())) {
+            std::cerr << "zia_bench: invalid baseline '" << baseline.string() << "': " << document.error() << std::endl;
+            return -1;
+        }
+
+        std::map<std::string, double> baseline_ns;
+        for (const JsonValue entry : document.root()["results"]) {
+            baseline_ns[std::string(entry["name"].as_string())] = entry["median_ns"].as_number();
+        }
+
+        int regressions = 0;
+        std::cout << "Comparison with " << baseline.string() << " (threshold " << json_number(threshold_percent) << "%):" << std::endl;
+        for (const auto& result : results) {
+            const auto it = baseline_ns.find(result.name);
+            if (it == baseline_ns.end() || it->second <= 0.0) {
+                std::cout << "  new        " << result.name << std::endl;
+                continue;
+            }
+            const double change = (result.median_ns / it->second - 1.0) * 100.0;
+            const bool regressed = change > threshold_percent;
+            regressions += regressed ? 1 : 0;
+            char line[64];
+            std::snprintf(line, sizeof(line), "  %-10s %+7.1f%%  ", regressed ? "REGRESSED" : "ok", change);
+            std::cout << line << result.name << " (" << format_ns(it->second) << " -> " << format_ns(result.median_ns) << ")" << std::endl;
+            baseline_ns.erase(it);
+        }
+        // Whatever is left was not run (filtered out, or removed since the baseline was recorded).
+        if (!baseline_ns.empty()) {
+            std::cout << "  " << baseline_ns.size() << " baseline benchmark(s) not run" << std::endl;
+        }
+        return regressions;
+    }
+} // namespace zia::bench
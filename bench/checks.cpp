@@ -0,0 +1,186 @@
+// Checks run by zia_bench --check: properties that timings alone would not catch. The snapshot/
+// checks play a level headlessly and compare the world before and after a round trip. The no_alloc/
+// checks wrap a warmed-up path in ZIA_ASSERT_NO_ALLOC and compare the thread's allocation counter
+// around it, so they are only registered when allocation tracking is compiled in.
+
+#include "Benchmark.hpp"
+#include "HeadlessSession.hpp"
+#include "Zia/engine/input/InputManager.hpp"
+#include "Zia/engine/profiling/AllocationTracker.hpp"
+#include "Zia/game/helpers/Constants.hpp"
+#include "Zia/game/world/Level.hpp"
+#include "Zia/game/world/TileMap.hpp"
+#include "Zia/game/world/WorldSnapshot.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace zia::bench {
+    namespace {
+        namespace tracker = zia::engine::allocation_tracker;
+
+        constexpr float FRAME_DT = 1.0f / 60.0f;
+
+        // Fails the check when the calling thread allocated since 'before'.
+        bool expect_no_allocations(const char *check, std::uint64_t before) {
+            const std::uint64_t allocations = tracker::thread_counters().allocations - before;
+            if (allocations != 0) {
+                std::cerr << check << ": " << allocations << " allocation(s) in the steady state" << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        // The world state a snapshot must bring back: what world_state_hash covers, plus the level's
+        // streaming state (consumed spawns and resident chunks), which lives outside the ECS.
+        struct WorldState {
+            std::uint64_t hash = 0;
+            std::vector<bool> consumed_spawns;
+            std::vector<bool> resident_chunks;
+        };
+
+        WorldState world_state(HeadlessSession &session) {
+            const Level &level = session.pipeline().level();
+            WorldState state;
+            state.hash = world_state_hash(session.registry().underlying());
+            for (std::size_t i = 0; i < level.entity_spawns().size(); ++i) {
+                state.consumed_spawns.push_back(level.spawn_consumed(i));
+            }
+            if (const auto tile_map = level.tile_map()) {
+                for (int chunk = 0; chunk < tile_map->chunk_count(); ++chunk) {
+                    state.resident_chunks.push_back(tile_map->is_chunk_resident(chunk));
+                }
+            }
+            return state;
+        }
+
+        // Capture, play on long enough for enemies to spawn and despawn and for the chunks around the
+        // capture point to be evicted, restore, and compare with the captured world. The frames in
+        // between must have changed each part of the state, or the comparison would prove nothing.
+        bool check_snapshot_round_trip() {
+            constexpr const char *CHECK = "snapshot/round_trip";
+            constexpr int SETTLE_FRAMES = 60;
+            constexpr int FRAMES = 600;
+            const auto &levels = stress_levels();
+            const auto level = std::find_if(levels.begin(), levels.end(), [](const StressLevel &l) { return l.name == "stress_wide"; });
+            if (level == levels.end()) {
+                std::cerr << CHECK << ": stress level 'stress_wide' is not available" << std::endl;
+                return false;
+            }
+
+            HeadlessSession session;
+            session.load(level->path.string());
+            for (int i = 0; i < SETTLE_FRAMES; ++i) session.step(FRAME_DT);
+
+            WorldSnapshot snapshot;
+            session.pipeline().capture_snapshot(snapshot);
+            const WorldState captured = world_state(session);
+
+            for (int i = 0; i < FRAMES; ++i) session.step(FRAME_DT);
+            const WorldState played = world_state(session);
+            bool ok = true;
+            auto expect = [&ok](bool condition, const char *message) {
+                if (!condition) {
+                    std::cerr << CHECK << ": " << message << std::endl;
+                    ok = false;
+                }
+            };
+            expect(played.hash != captured.hash, "the world did not change after the capture");
+            expect(played.consumed_spawns != captured.consumed_spawns, "no spawn was consumed after the capture");
+            expect(played.resident_chunks != captured.resident_chunks, "no chunk was streamed in or evicted after the capture");
+            if (!ok) return false;
+
+            if (!session.pipeline().restore_snapshot(snapshot)) {
+                std::cerr << CHECK << ": restore failed" << std::endl;
+                return false;
+            }
+            const WorldState restored = world_state(session);
+            expect(restored.hash == captured.hash, "world_state_hash differs from the captured world");
+            expect(restored.consumed_spawns == captured.consumed_spawns, "consumed spawns differ from the captured world");
+            expect(restored.resident_chunks == captured.resident_chunks, "resident chunks differ from the captured world");
+            return ok;
+        }
+
+        // A frame of key traffic applied by poll(), then the queries systems make by enum, by interned
+        // id and by name. The first frames size the event queue.
+        bool check_input_poll_no_alloc() {
+            constexpr int WARMUP_FRAMES = 4;
+            constexpr int FRAMES = 1000;
+            InputManager input;
+            std::vector<sf::Event> events;
+            for (const auto key : {sf::Keyboard::Key::Left, sf::Keyboard::Key::Right, sf::Keyboard::Key::Space, sf::Keyboard::Key::F5}) {
+                events.push_back(sf::Event::KeyPressed{key, {}, false, false, false, false});
+                events.push_back(sf::Event::KeyReleased{key, {}, false, false, false, false});
+            }
+            const ActionId jump = input.intern("Jump");
+            const std::string &move_right = InputManager::action_name(InputManager::Action::MoveRight);
+
+            int held = 0;
+            auto frame = [&]() {
+                for (const auto &event : events) {
+                    input.handle_event(event);
+                }
+                input.poll();
+                held += input.is_pressed(InputManager::Action::MoveLeft) ? 1 : 0;
+                held += input.is_down(jump) ? 1 : 0;
+                held += input.is_released(InputManager::action_id(InputManager::Action::QuickSave)) ? 1 : 0;
+                held += input.is_pressed(move_right) ? 1 : 0;
+                held += input.is_down(move_right) ? 1 : 0;
+            };
+            for (int i = 0; i < WARMUP_FRAMES; ++i) frame();
+
+            const std::uint64_t before = tracker::thread_counters().allocations;
+            {
+                ZIA_ASSERT_NO_ALLOC("no_alloc/input_poll");
+                for (int i = 0; i < FRAMES; ++i) frame();
+            }
+            consume(static_cast<double>(held));
+            return expect_no_allocations("no_alloc/input_poll", before);
+        }
+
+        // Quick load of a snapshot taken in the same frame: the entity set is unchanged, so the restore
+        // only overwrites component values in place. The first restore is the warm-up.
+        bool check_snapshot_restore_no_alloc() {
+            constexpr int FRAMES = 120;
+            constexpr int RESTORES = 100;
+            HeadlessSession session;
+            session.load(std::string(zia::constants::LEVEL1_PATH));
+            for (int i = 0; i < FRAMES; ++i) session.step(FRAME_DT);
+
+            WorldSnapshot snapshot;
+            auto &pipeline = session.pipeline();
+            pipeline.capture_snapshot(snapshot);
+            if (!pipeline.restore_snapshot(snapshot)) {
+                std::cerr << "no_alloc/snapshot_restore: restore failed" << std::endl;
+                return false;
+            }
+
+            const std::uint64_t before = tracker::thread_counters().allocations;
+            bool restored = true;
+            {
+                ZIA_ASSERT_NO_ALLOC("no_alloc/snapshot_restore");
+                for (int i = 0; i < RESTORES; ++i) {
+                    restored = pipeline.restore_snapshot(snapshot) && restored;
+                }
+            }
+            if (!restored) {
+                std::cerr << "no_alloc/snapshot_restore: restore failed" << std::endl;
+                return false;
+            }
+            return expect_no_allocations("no_alloc/snapshot_restore", before);
+        }
+    }
+
+    std::vector<Check> checks() {
+        std::vector<Check> list;
+        list.push_back({"snapshot/round_trip", check_snapshot_round_trip});
+        if (tracker::compiled_in()) {
+            list.push_back({"no_alloc/input_poll", check_input_poll_no_alloc});
+            list.push_back({"no_alloc/snapshot_restore", check_snapshot_restore_no_alloc});
+        }
+        return list;
+    }
+} // namespace zia::bench
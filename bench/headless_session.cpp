@@ -0,0 +1,117 @@
+// Implements HeadlessSession: PlayScene's PlayPipeline without a window, for the macro benchmarks.
+
+#include "HeadlessSession.hpp"
+
+#include <unordered_map>
+
+namespace zia::bench {
+    namespace {
+        // Asset manager handing out one empty texture per id. Nothing is loaded or uploaded: the
+        // recording renderer only needs texture identities, and an empty texture never touches OpenGL.
+        class HeadlessAssets final : public zia::engine::IAssetManager {
+        public:
+            bool load_texture(int id, const std::string &) override { texture(id); return true; }
+            std::shared_ptr<sf::Texture> get_mutable_texture(int id) override { return texture(id); }
+            std::shared_ptr<const sf::Texture> get_texture(int id) const override { return texture(id); }
+            bool has_texture(int id) const override { return _textures.count(id) != 0; }
+            int find_texture_id(const sf::Texture &texture) const override {
+                for (const auto &[id, slot] : _textures) {
+                    if (slot.get() == &texture) return id;
+                }
+                return -1;
+            }
+
+            bool load_font(int, const std::string &) override { return false; }
+            std::shared_ptr<const sf::Font> get_font(int) const override { return nullptr; }
+            bool has_font(int) const override { return false; }
+
+            void unload_all() override { _textures.clear(); }
+
+            zia::engine::TextureHandle request_texture(int id, const std::string &, zia::engine::AssetPriority) override {
+                texture(id);
+                return {id, zia::engine::AssetStatus::Ready};
+            }
+            zia::engine::AssetStatus texture_status(int id) const override {
+                return has_texture(id) ? zia::engine::AssetStatus::Ready : zia::engine::AssetStatus::Missing;
+            }
+            void set_upload_budget(std::size_t) override {}
+            // No worker pool: jobs (tile chunk reads) run inline, keeping sessions reproducible.
+            void submit_job(zia::engine::AssetPriority, std::function<void()> job) override { if (job) job(); }
+
+            void retain_texture(int) override {}
+            void release_texture(int) override {}
+            void set_memory_budget(std::size_t) override {}
+            std::size_t texture_memory_usage() const override { return 0; }
+
+            void push_decoded_image(int, sf::Image &&) override {}
+            void finalize_decoded_images() override {}
+
+        private:
+            const std::shared_ptr<sf::Texture> &texture(int id) const {
+                auto &slot = _textures[id];
+                if (!slot) slot = std::make_shared<sf::Texture>();
+                return slot;
+            }
+
+            mutable std::unordered_map<int, std::shared_ptr<sf::Texture>> _textures;
+        };
+
+        // Input script period: jump for JUMP_FRAMES out of every JUMP_PERIOD frames.
+        constexpr std::uint64_t JUMP_PERIOD = 90;
+        constexpr std::uint64_t JUMP_FRAMES = 20;
+    }
+
+    HeadlessSession::HeadlessSession(sf::Vector2u window_size)
+        : _renderer(window_size),
+          _assets(std::make_shared<HeadlessAssets>()),
+          _input_state(std::make_shared<zia::InputManager>()),
+          _input(_input_state),
+          _registry(std::make_shared<zia::EntityManager>()) {
+    }
+
+    HeadlessSession::~HeadlessSession() {
+        // The registry outlives the pipeline, but its components live in the level's arena.
+        if (_pipeline) _pipeline->exit();
+    }
+
+    // Used by: macro benchmarks (setup)
+    void HeadlessSession::load(const std::string &level_path) {
+        _stats = Stats();
+        _script_frame = 0;
+        if (_pipeline) _pipeline->exit();
+        // A fresh pipeline per load, so prefetches, snapshots and transition counts start over.
+        _pipeline.reset();
+        _pipeline = std::make_unique<PlayPipeline>(_registry, _renderer, *_assets, _input, level_path);
+        _pipeline->enter();
+    }
+
+    // Used by: macro benchmarks (timed loop)
+    void HeadlessSession::step(float dt) {
+        update_input();
+        _pipeline->update(dt);
+        _stats.restarts = _pipeline->transitions();
+        render();
+        ++_stats.frames;
+    }
+
+    void HeadlessSession::update_input() {
+        const bool jump = (_script_frame % JUMP_PERIOD) < JUMP_FRAMES;
+        _input_state->set_action_state(zia::InputManager::Action::MoveRight, true);
+        _input_state->set_action_state(zia::InputManager::Action::Jump, jump);
+        ++_script_frame;
+    }
+
+    void HeadlessSession::render() {
+        _renderer.begin_frame();
+        _pipeline->render();
+        _renderer.flush_text();
+        _renderer.end_frame();
+
+        // Keep the statistics, drop the command log so long runs use constant memory.
+        const auto &frame = _renderer.frame_stats().back();
+        _stats.draws += frame.draws;
+        _stats.sprite_draws += frame.sprite_draws;
+        _stats.texture_switches += frame.texture_switches;
+        _renderer.clear();
+    }
+} // namespace zia::bench
@@ -0,0 +1,68 @@
+// Macro benchmarks: thousands of headless frames (see HeadlessSession) of the shipped levels and of
+// generated stress levels. Each frame uses the fixed 60 Hz step, so runs are reproducible.
+
+#include "Benchmark.hpp"
+#include "HeadlessSession.hpp"
+#include "Zia/game/helpers/Constants.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace zia::bench {
+    namespace {
+        constexpr float FRAME_DT = 1.0f / 60.0f;
+
+        struct FrameState {
+            HeadlessSession session;
+            std::vector<double> frame_ns;
+        };
+
+        double percentile(const std::vector<double> &sorted_values, double fraction) {
+            if (sorted_values.empty()) return 0.0;
+            const auto index = static_cast<std::size_t>(fraction * static_cast<double>(sorted_values.size() - 1));
+            return sorted_values[index];
+        }
+
+        void register_frames(BenchSuite &suite, const std::string &name, const std::string &level_path, int frames) {
+            auto state = std::make_shared<FrameState>();
+            suite.add({"frames/" + name, "macro", static_cast<std::uint64_t>(frames),
+                       [state, level_path, frames]() {
+                           state->session.load(level_path);
+                           state->frame_ns.clear();
+                           state->frame_ns.reserve(static_cast<std::size_t>(frames));
+                       },
+                       [state, frames](BenchRun &run) {
+                           using Clock = std::chrono::steady_clock;
+                           for (int i = 0; i < frames; ++i) {
+                               const auto start = Clock::now();
+                               state->session.step(FRAME_DT);
+                               state->frame_ns.push_back(static_cast<double>(
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+                           }
+
+                           std::sort(state->frame_ns.begin(), state->frame_ns.end());
+                           const auto &stats = state->session.stats();
+                           const double count = static_cast<double>(std::max<std::uint64_t>(1, stats.frames));
+                           run.metric("p50_frame_us", percentile(state->frame_ns, 0.50) / 1000.0);
+                           run.metric("p99_frame_us", percentile(state->frame_ns, 0.99) / 1000.0);
+                           run.metric("max_frame_us", state->frame_ns.back() / 1000.0);
+                           run.metric("draws_per_frame", static_cast<double>(stats.draws) / count);
+                           run.metric("texture_switches_per_frame", static_cast<double>(stats.texture_switches) / count);
+                           run.metric("restarts", static_cast<double>(stats.restarts));
+                       }});
+        }
+    }
+
+    void register_macro_benchmarks(BenchSuite &suite, const BenchOptions &options) {
+        const int frames = std::max(1, options.frames);
+        register_frames(suite, "level1", std::string(zia::constants::LEVEL1_PATH), frames);
+        register_frames(suite, "level2", std::string(zia::constants::LEVEL2_PATH), frames);
+
+        for (const auto &level : stress_levels()) {
+            register_frames(suite, level.name, level.path.string(), frames);
+        }
+    }
+} // namespace zia::bench
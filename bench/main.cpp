@@ -0,0 +1,126 @@
+// zia_bench: headless micro and macro benchmarks with machine-readable output.
+//
+// Usage: zia_bench [--out results.json] [--baseline baseline.json] [--threshold percent]
+//                  [--filter text] [--repetitions n] [--frames n] [--max-entities n] [--quick]
+//                  [--list] [--asset-root dir] [--check]
+//
+// Results are written as JSON (default zia_bench.json). With --baseline, each benchmark's median
+// time per operation is compared with the baseline's and the exit code is 1 when any of them is more
+// than --threshold percent (default 10) slower. --quick shrinks the runs for CI smoke tests. Compare
+// baselines recorded on the same machine and build type. --check runs the checks (checks.cpp, also
+// narrowed by --filter) instead of the benchmarks and exits with 1 when any of them fails.
+
+#include "Benchmark.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
+#include "Zia/engine/resources/AssetPathResolver.hpp"
+#include "Zia/game/helpers/Spawner.hpp"
+#include "Zia/game/systems/ChunkStreamingSystem.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    zia::bench::BenchOptions options;
+    std::filesystem::path out_path = "zia_bench.json";
+    std::filesystem::path baseline_path;
+    double threshold = 10.0;
+    bool list_only = false;
+    bool run_checks = false;
+    std::vector<std::filesystem::path> asset_roots;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg(argv[i]);
+        const bool has_value = i + 1 < argc;
+        if (arg == "--out" && has_value) {
+            out_path = argv[++i];
+        } else if (arg == "--baseline" && has_value) {
+            baseline_path = argv[++i];
+        } else if (arg == "--threshold" && has_value) {
+            threshold = std::atof(argv[++i]);
+        } else if (arg == "--filter" && has_value) {
+            options.filter = argv[++i];
+        } else if (arg == "--repetitions" && has_value) {
+            options.repetitions = std::atoi(argv[++i]);
+        } else if (arg == "--frames" && has_value) {
+            options.frames = std::atoi(argv[++i]);
+        } else if (arg == "--max-entities" && has_value) {
+            options.max_entities = std::atoi(argv[++i]);
+        } else if (arg == "--quick") {
+            options.repetitions = 3;
+            options.frames = 600;
+            options.max_entities = 10000;
+        } else if (arg == "--list") {
+            list_only = true;
+        } else if (arg == "--check") {
+            run_checks = true;
+        } else if (arg == "--asset-root" && has_value) {
+            asset_roots.emplace_back(argv[++i]);
+        } else {
+            std::cerr << "zia_bench: unknown argument '" << arg << "'" << std::endl;
+            return 2;
+        }
+    }
+
+    const auto default_roots = zia::engine::AssetPathResolver::default_roots();
+    asset_roots.insert(asset_roots.end(), default_roots.begin(), default_roots.end());
+    zia::engine::asset_path_resolver().set_roots(std::move(asset_roots));
+
+    // Scope timers would only add their own cost to the measurements.
+    zia::engine::Profiler::instance().set_enabled(false);
+    // Every repetition simulates the same frames: fixed cloud placement, and enemies that spawn on the
+    // same frame whatever the chunk loader threads' timing.
+    zia::Spawner::set_random_seed(0x5A1Au);
+    zia::ChunkStreamingSystem::set_deterministic(true);
+
+    if (run_checks && !list_only) {
+        int passed = 0;
+        int failed = 0;
+        for (const auto& check : zia::bench::checks()) {
+            if (!options.filter.empty() && check.name.find(options.filter) == std::string::npos) continue;
+            const bool ok = check.run();
+            std::cout << "  " << check.name << ": " << (ok ? "ok" : "FAILED") << std::endl;
+            if (ok) {
+                ++passed;
+            } else {
+                ++failed;
+            }
+        }
+        std::cout << "zia_bench: " << passed << " check(s) passed, " << failed << " failed" << std::endl;
+        return failed > 0 ? 1 : 0;
+    }
+
+    zia::bench::BenchSuite suite;
+    zia::bench::register_micro_benchmarks(suite, options);
+    zia::bench::register_macro_benchmarks(suite, options);
+
+    if (list_only) {
+        for (const auto& benchmark : suite.benchmarks()) {
+            std::cout << benchmark.name << " (" << benchmark.group << ")" << std::endl;
+        }
+        for (const auto& check : zia::bench::checks()) {
+            std::cout << check.name << " (check)" << std::endl;
+        }
+        return 0;
+    }
+
+    std::cout << "zia_bench: " << options.repetitions << " repetitions, " << options.frames << " frames per macro run" << std::endl;
+    const auto results = suite.run(options);
+    if (!zia::bench::write_results(out_path, results, options)) {
+        return 2;
+    }
+    std::cout << "zia_bench: wrote " << results.size() << " results to " << out_path.string() << std::endl;
+
+    if (!baseline_path.empty()) {
+        const int regressions = zia::bench::compare_with_baseline(baseline_path, results, threshold);
+        if (regressions < 0) return 2;
+        if (regressions > 0) {
+            std::cout << "zia_bench: " << regressions << " regression(s) above " << threshold << "%" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,351 @@
+// Micro benchmarks: ECS add/get/query, component snapshots, Quadtree insert/retrieve, tile collision,
+// level parsing and loading, and input event processing.
+// Inputs are generated from fixed seeds so every run measures the same work.
+
+#include "Benchmark.hpp"
+#include "Zia/engine/ecs/ComponentSnapshot.hpp"
+#include "Zia/engine/ecs/EntityManager.hpp"
+#include "Zia/engine/ecs/components/PositionComponent.hpp"
+#include "Zia/engine/ecs/components/VelocityComponent.hpp"
+#include "Zia/engine/input/InputManager.hpp"
+#include "Zia/engine/resources/AssetPathResolver.hpp"
+#include "Zia/engine/spatial/Quadtree.hpp"
+#include "Zia/game/helpers/Constants.hpp"
+#include "Zia/game/helpers/tileSweep.hpp"
+#include "Zia/game/world/JsonDocument.hpp"
+#include "Zia/game/world/Level.hpp"
+#include "Zia/game/world/LevelBinary.hpp"
+#include "Zia/game/world/TileMap.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace zia::bench {
+    namespace {
+        constexpr std::uint32_t SEED = 0x5A1Au;
+
+        std::string size_label(int count) {
+            return count % 1000 == 0 ? std::to_string(count / 1000) + "k" : std::to_string(count);
+        }
+
+        // --- ECS ---------------------------------------------------------------------------------
+
+        struct EcsState {
+            std::unique_ptr<EntityManager> entities;
+            std::vector<EntityID> ids;
+            std::vector<EntityID> query;
+        };
+
+        void populate(EcsState &state, int count) {
+            state.entities = std::make_unique<EntityManager>();
+            state.ids.clear();
+            for (int i = 0; i < count; ++i) {
+                const EntityID id = state.entities->create_entity();
+                state.entities->add_component(id, PositionComponent{static_cast<float>(i), 0.0f});
+                // Every other entity moves, so the two-component query has to filter.
+                if (i % 2 == 0) {
+                    state.entities->add_component(id, VelocityComponent{1.0f, 0.0f});
+                }
+                state.ids.push_back(id);
+            }
+        }
+
+        void register_ecs(BenchSuite &suite, int count) {
+            const auto label = size_label(count);
+            const auto ops = static_cast<std::uint64_t>(count);
+
+            // Entity creation plus two components each.
+            auto add_state = std::make_shared<EcsState>();
+            suite.add({"ecs/add/" + label, "micro", ops,
+                       [add_state]() { add_state->entities = std::make_unique<EntityManager>(); },
+                       [add_state, count](BenchRun &) {
+                           auto &entities = *add_state->entities;
+                           for (int i = 0; i < count; ++i) {
+                               const EntityID id = entities.create_entity();
+                               entities.add_component(id, PositionComponent{static_cast<float>(i), 0.0f});
+                               entities.add_component(id, VelocityComponent{1.0f, 0.0f});
+                           }
+                       }});
+
+            // get/query only read, so the registry is built once and shared by both.
+            auto state = std::make_shared<EcsState>();
+            const auto ensure = [state, count]() {
+                if (!state->entities) populate(*state, count);
+            };
+            suite.add({"ecs/get/" + label, "micro", ops, ensure, [state](BenchRun &) {
+                           float sum = 0.0f;
+                           for (const EntityID id : state->ids) {
+                               if (const auto pos = state->entities->get_component<PositionComponent>(id)) {
+                                   sum += pos->get().x;
+                               }
+                           }
+                           consume(sum);
+                       }});
+            suite.add({"ecs/query/" + label, "micro", ops, ensure, [state](BenchRun &run) {
+                           state->entities->get_entities_with<PositionComponent, VelocityComponent>(state->query);
+                           consume(static_cast<double>(state->query.size()));
+                           run.metric("matches", static_cast<double>(state->query.size()));
+                       }});
+        }
+
+        // --- Snapshots ---------------------------------------------------------------------------
+
+        using BenchSnapshot = zia::engine::ComponentSnapshot<PositionComponent, VelocityComponent>;
+
+        struct SnapshotState {
+            EcsState ecs;
+            std::vector<std::byte> data;
+        };
+
+        // Capture of the populated registry, and restore of it after every entity has moved (the
+        // rollback case: all components still exist and are overwritten in place).
+        void register_snapshot(BenchSuite &suite, int count) {
+            const auto label = size_label(count);
+            const auto ops = static_cast<std::uint64_t>(count);
+            auto state = std::make_shared<SnapshotState>();
+            const auto ensure = [state, count]() {
+                if (!state->ecs.entities) {
+                    populate(state->ecs, count);
+                    zia::engine::SnapshotWriter out(state->data);
+                    BenchSnapshot::save(*state->ecs.entities, out);
+                }
+            };
+            suite.add({"snapshot/capture/" + label, "micro", ops, ensure, [state](BenchRun &run) {
+                           state->data.clear();
+                           zia::engine::SnapshotWriter out(state->data);
+                           BenchSnapshot::save(*state->ecs.entities, out);
+                           run.metric("bytes", static_cast<double>(state->data.size()));
+                       }});
+            suite.add({"snapshot/restore/" + label, "micro", ops,
+                       [state, ensure]() {
+                           ensure();
+                           for (const EntityID id : state->ecs.ids) {
+                               state->ecs.entities->get_component<PositionComponent>(id)->get().x += 1.0f;
+                           }
+                       },
+                       [state](BenchRun &) {
+                           zia::engine::SnapshotReader in(state->data.data(), state->data.size());
+                           consume(BenchSnapshot::restore(*state->ecs.entities, in) ? 1.0 : 0.0);
+                       }});
+        }
+
+        // --- Quadtree ----------------------------------------------------------------------------
+
+        struct QuadtreeState {
+            sf::FloatRect world;
+            std::vector<sf::FloatRect> rects;
+            zia::engine::spatial::Quadtree tree{0, sf::FloatRect()};
+            std::vector<QuadTile> hits;
+        };
+
+        // Entity-sized boxes scattered over a level-sized area.
+        std::shared_ptr<QuadtreeState> make_quadtree_state(int count) {
+            auto state = std::make_shared<QuadtreeState>();
+            state->world = sf::FloatRect({0.0f, 0.0f}, {200.0f * 32.0f, 18.0f * 32.0f});
+            std::mt19937 rng(SEED);
+            std::uniform_real_distribution<float> x(0.0f, state->world.size.x - 64.0f);
+            std::uniform_real_distribution<float> y(0.0f, state->world.size.y - 64.0f);
+            std::uniform_real_distribution<float> extent(16.0f, 64.0f);
+            state->rects.reserve(static_cast<std::size_t>(count));
+            for (int i = 0; i < count; ++i) {
+                state->rects.push_back(sf::FloatRect({x(rng), y(rng)}, {extent(rng), extent(rng)}));
+            }
+            return state;
+        }
+
+        void fill(QuadtreeState &state) {
+            state.tree.reset(state.world);
+            for (std::size_t i = 0; i < state.rects.size(); ++i) {
+                state.tree.insert(QuadTile(state.rects[i], static_cast<std::uint32_t>(i)));
+            }
+        }
+
+        void register_quadtree(BenchSuite &suite, int count) {
+            const auto label = size_label(count);
+            const auto ops = static_cast<std::uint64_t>(count);
+
+            // Rebuilt in place like CollisionSystem does every frame: node storage is reused.
+            auto insert_state = make_quadtree_state(count);
+            suite.add({"quadtree/insert/" + label, "micro", ops, [insert_state]() { fill(*insert_state); },
+                       [insert_state](BenchRun &) { fill(*insert_state); }});
+
+            auto retrieve_state = make_quadtree_state(count);
+            suite.add({"quadtree/retrieve/" + label, "micro", ops, [retrieve_state]() { fill(*retrieve_state); },
+                       [retrieve_state](BenchRun &run) {
+                           std::size_t candidates = 0;
+                           for (const auto &rect : retrieve_state->rects) {
+                               retrieve_state->hits.clear();
+                               retrieve_state->tree.retrieve(retrieve_state->hits, rect);
+                               candidates += retrieve_state->hits.size();
+                           }
+                           consume(static_cast<double>(candidates));
+                           run.metric("candidates_per_query", static_cast<double>(candidates) / static_cast<double>(retrieve_state->rects.size()));
+                       }});
+        }
+
+        // --- Tile collision ----------------------------------------------------------------------
+
+        struct CollisionBody {
+            float x, y, vx, vy;
+        };
+
+        struct CollisionState {
+            Level level;
+            std::vector<CollisionBody> bodies;
+        };
+
+        void register_tile_collision(BenchSuite &suite, std::string_view level_path, const std::string &level_name) {
+            constexpr int BODIES = 10000;
+            auto state = std::make_shared<CollisionState>();
+            suite.add({"tile_collision/" + level_name, "micro", BODIES,
+                       [state, path = std::string(level_path)]() {
+                           if (state->level.tile_map()) return;
+                           state->level.load_json(path);
+                           const auto map = state->level.tile_map();
+                           for (int chunk = 0; chunk < map->chunk_count(); ++chunk) {
+                               map->load_chunk_now(chunk);
+                           }
+                           // Player-sized bodies anywhere on the map, moving at up to jump/fall speeds.
+                           const float width = static_cast<float>(map->width() * map->tile_size());
+                           const float height = static_cast<float>(map->height() * map->tile_size());
+                           std::mt19937 rng(SEED);
+                           std::uniform_real_distribution<float> x(0.0f, width - 64.0f);
+                           std::uniform_real_distribution<float> y(0.0f, height - 64.0f);
+                           std::uniform_real_distribution<float> v(-900.0f, 900.0f);
+                           for (int i = 0; i < BODIES; ++i) {
+                               state->bodies.push_back({x(rng), y(rng), v(rng), v(rng)});
+                           }
+                       },
+                       [state](BenchRun &) {
+                           const auto &map = *state->level.tile_map();
+                           float sum = 0.0f;
+                           for (const auto &body : state->bodies) {
+                               const auto result = resolve_tile_collision(body.x, body.y, body.vx, body.vy, 28.0f, 60.0f, map, 1.0f / 60.0f);
+                               sum += result.x + result.y;
+                           }
+                           consume(sum);
+                       }});
+        }
+
+        // --- Level parsing -----------------------------------------------------------------------
+
+        std::filesystem::path resolve(std::string_view path) {
+            const auto resolved = zia::engine::asset_path_resolver().resolve(path);
+            return resolved ? *resolved : std::filesystem::path(path);
+        }
+
+        std::string read_file(const std::filesystem::path &path) {
+            std::ifstream in(path, std::ios::binary);
+            std::ostringstream text;
+            text << in.rdbuf();
+            return text.str();
+        }
+
+        void register_level_parse(BenchSuite &suite, std::string_view level_path, const std::string &level_name) {
+            constexpr int PARSES = 50;
+            const auto json_path = resolve(level_path);
+            auto text = std::make_shared<std::string>(read_file(json_path));
+            if (text->empty()) {
+                std::cerr << "zia_bench: cannot read '" << level_path << "', skipping its parse benchmarks" << std::endl;
+                return;
+            }
+
+            // The JSON document alone (the buffer copy is part of it, as parse() takes ownership).
+            suite.add({"json_parse/" + level_name, "micro", PARSES, nullptr, [text](BenchRun &run) {
+                           std::size_t rows = 0;
+                           for (int i = 0; i < PARSES; ++i) {
+                               JsonDocument document;
+                               document.parse(*text);
+                               rows += document.root()["rows"].size();
+                           }
+                           consume(static_cast<double>(rows));
+                           run.metric("bytes", static_cast<double>(text->size()));
+                       }});
+
+            // Everything Level::load does on the JSON path: parse, tileset, tile grid and spawn table.
+            constexpr int LOADS = 20;
+            suite.add({"level_load_json/" + level_name, "micro", LOADS, nullptr, [path = std::string(level_path)](BenchRun &) {
+                           for (int i = 0; i < LOADS; ++i) {
+                               Level level;
+                               level.load_json(path);
+                               consume(static_cast<double>(level.entity_spawns().size()));
+                           }
+                       }});
+
+            // The compiled path Level::load takes when a .zlvl is present: map the file, no parsing.
+            const auto compiled = compiled_level_path(json_path);
+            if (!std::filesystem::exists(compiled)) return;
+            suite.add({"level_load_compiled/" + level_name, "micro", LOADS, nullptr, [compiled](BenchRun &) {
+                           for (int i = 0; i < LOADS; ++i) {
+                               Level level;
+                               level.load_compiled(compiled);
+                               consume(static_cast<double>(level.entity_spawns().size()));
+                           }
+                       }});
+
+            // Loading into one Level again and again, as PlayPipeline does with each of the two Levels it
+            // alternates between (the running one is recycled into the next prefetch): after the first
+            // load the level arena's block fits the level, and unload() is a single arena reset.
+            suite.add({"level_reload_compiled/" + level_name, "micro", LOADS, nullptr,
+                       [compiled, level = std::make_shared<Level>()](BenchRun &) {
+                           for (int i = 0; i < LOADS; ++i) {
+                               level->load_compiled(compiled);
+                               consume(static_cast<double>(level->entity_spawns().size()));
+                               level->unload();
+                           }
+                       }});
+        }
+
+        // --- Input -------------------------------------------------------------------------------
+
+        // A frame of key traffic (press and release of every bound key) applied by poll(), then the
+        // per-frame queries systems make, by enum and by interned id.
+        void register_input(BenchSuite &suite) {
+            constexpr int FRAMES = 1000;
+            auto input = std::make_shared<InputManager>();
+            auto events = std::make_shared<std::vector<sf::Event>>();
+            for (const auto key : {sf::Keyboard::Key::Left, sf::Keyboard::Key::Right, sf::Keyboard::Key::Space, sf::Keyboard::Key::H}) {
+                events->push_back(sf::Event::KeyPressed{key, {}, false, false, false, false});
+                events->push_back(sf::Event::KeyReleased{key, {}, false, false, false, false});
+            }
+            suite.add({"input/poll_and_query", "micro", FRAMES, nullptr, [input, events](BenchRun &) {
+                           const ActionId jump = input->intern("Jump");
+                           int held = 0;
+                           for (int frame = 0; frame < FRAMES; ++frame) {
+                               for (const auto &event : *events) {
+                                   input->handle_event(event);
+                               }
+                               input->poll();
+                               held += input->is_pressed(InputManager::Action::MoveRight) ? 1 : 0;
+                               held += input->is_down(jump) ? 1 : 0;
+                           }
+                           consume(static_cast<double>(held));
+                       }});
+        }
+    }
+
+    void register_micro_benchmarks(BenchSuite &suite, const BenchOptions &options) {
+        for (const int count : {1000, 10000, 100000}) {
+            if (count <= options.max_entities) register_ecs(suite, count);
+        }
+        for (const int count : {1000, 10000}) {
+            if (count <= options.max_entities) register_snapshot(suite, count);
+        }
+        for (const int count : {1000, 10000}) {
+            if (count <= options.max_entities) register_quadtree(suite, count);
+        }
+        register_tile_collision(suite, zia::constants::LEVEL1_PATH, "level1");
+        register_level_parse(suite, zia::constants::LEVEL1_PATH, "level1");
+        register_level_parse(suite, zia::constants::LEVEL2_PATH, "level2");
+        for (const auto &level : stress_levels()) {
+            register_level_parse(suite, level.path.string(), level.name);
+        }
+        register_input(suite);
+    }
+} // namespace zia::bench
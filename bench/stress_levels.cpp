@@ -0,0 +1,52 @@
+// Generated stress levels shared by the micro and macro benchmarks.
+
+#include "Benchmark.hpp"
+#include "Zia/game/world/LevelGenerator.hpp"
+
+#include <iostream>
+#include <system_error>
+
+namespace zia::bench {
+    namespace {
+        std::vector<StressLevel> generate_all() {
+            struct Spec {
+                const char* name;
+                LevelGeneratorParams params;
+            };
+            std::vector<Spec> specs(2);
+            // A short level packed with enemies: every update system has a crowd to process.
+            specs[0].name = "stress_enemies";
+            specs[0].params.seed = 1;
+            specs[0].params.width = 400;
+            specs[0].params.enemy_count = 300;
+            specs[0].params.distribution = EnemyDistribution::Clustered;
+            // ~100k tiles and 10k enemies: chunk streaming, spawning and level loading at scale.
+            specs[1].name = "stress_wide";
+            specs[1].params.seed = 2;
+            specs[1].params.width = 6000;
+            specs[1].params.enemy_count = 10000;
+            specs[1].params.distribution = EnemyDistribution::Random;
+            specs[1].params.background_layers = 3;
+
+            const auto directory = std::filesystem::temp_directory_path() / "zia_bench";
+            std::error_code ec;
+            std::filesystem::create_directories(directory, ec);
+
+            std::vector<StressLevel> levels;
+            for (const auto& spec : specs) {
+                const auto path = directory / (std::string(spec.name) + ".json");
+                if (!write_generated_level(generate_level(spec.params), path)) {
+                    std::cerr << "zia_bench: skipping stress level '" << spec.name << "'" << std::endl;
+                    continue;
+                }
+                levels.push_back({spec.name, path});
+            }
+            return levels;
+        }
+    }
+
+    const std::vector<StressLevel>& stress_levels() {
+        static const std::vector<StressLevel> levels = generate_all();
+        return levels;
+    }
+} // namespace zia::bench
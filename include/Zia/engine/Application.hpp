@@ -14,6 +14,8 @@
 #include "Zia/engine/IInput.hpp"
 #include "Zia/engine/IAssetManager.hpp"
 #include "Zia/engine/IEntityManager.hpp"
+#include "Zia/engine/FramePacer.hpp"
+#include "Zia/engine/render/ThreadedRenderer.hpp"
 
 #include <memory>
 #include <vector>
@@ -60,6 +62,20 @@ namespace zia::engine {
         // Return the underlying concrete EntityManager for code that depends on concrete APIs.
         zia::EntityManager &underlying_entity_manager();
 
+        // Replace the input interface (e.g. with an InputRecorder or InputReplay). Scenes look the input
+        // up through input() every frame, so this may be called before run().
+        void set_input(std::shared_ptr<IInput> input);
+        [[nodiscard]] std::shared_ptr<IInput> shared_input() const { return _input_iface; }
+
+        // Fixed timestep in seconds: when positive every update receives exactly this dt instead of the
+        // measured frame time, so a run depends only on its input (see InputRecorder / InputReplay).
+        void set_fixed_timestep(float dt) { _fixed_dt = dt; }
+        [[nodiscard]] float fixed_timestep() const noexcept { return _fixed_dt; }
+
+        // Paces the main loop (target frame rate, missed-frame statistics). 60 fps by default.
+        FramePacer &frame_pacer() { return _pacer; }
+        [[nodiscard]] const FramePacer &frame_pacer() const { return _pacer; }
+
         // Access to the UI manager.
         UIManager& ui();
 
@@ -68,6 +84,12 @@ namespace zia::engine {
         // ImGui widgets it needs (e.g. main menu bar). Use a std::function to keep ownership simple.
         void set_ui_overlay(std::function<void()> cb) { _ui_overlay_cb = std::move(cb); }
 
+        // Optional render-thread mode: draw calls are recorded into double-buffered command lists and
+        // replayed by a dedicated thread, overlapping simulation of frame N+1 with rendering of frame N.
+        // Must be called before run() (scenes keep references to the renderer interface).
+        void set_threaded_rendering(bool enabled);
+        [[nodiscard]] bool threaded_rendering() const noexcept { return static_cast<bool>(_threaded_renderer); }
+
     protected:
         // Hook for derived classes to prepare an initial scene before the loop begins.
         virtual void before_loop();
@@ -76,8 +98,15 @@ namespace zia::engine {
         // Core loop implementation (fixed timestep and frame throttling).
         void main_loop();
 
+        // Wait for the render thread (if any) to finish the in-flight frame. Called before scene
+        // changes, which may release textures still referenced by recorded commands.
+        void sync_render_thread();
+
         // Running flag for the main loop.
         bool _running = false;
+        // Fixed update dt in seconds; 0 uses the measured frame time.
+        float _fixed_dt = 0.0f;
+        FramePacer _pacer;
 
         // Runtime interface pointers (point to either adapter or default wrapper) used by engine loops.
         std::shared_ptr<IRenderer> _renderer_iface;
@@ -85,6 +114,11 @@ namespace zia::engine {
         std::shared_ptr<IAssetManager> _assets_iface;
         std::shared_ptr<IEntityManager> _entities_iface;
 
+        // Set when render-thread mode is enabled; _renderer_iface then points at this decorator.
+        std::shared_ptr<ThreadedRenderer> _threaded_renderer;
+        // Events polled at the start of a frame, forwarded to the UI once the render thread is idle.
+        std::vector<sf::Event> _pending_events;
+
         // Active scene stack (shared ownership of scenes keeps interfaces simple).
         std::vector<std::shared_ptr<IScene>> _scenes;
 
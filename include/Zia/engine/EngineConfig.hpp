@@ -19,11 +19,24 @@ namespace zia::engine {
         int window_height() const;
         bool fullscreen() const;
         float master_volume() const;
+        // Render-thread mode (see Application::set_threaded_rendering); applied once at startup.
+        bool render_thread() const;
+        // Texture cache budget in MiB (0 = unlimited); unreferenced textures are evicted above it.
+        int texture_budget_mb() const;
+        // Present synchronised with the display refresh. Off by default: the frame pacer sets the rate,
+        // and stacking both adds up to a frame of latency. Use target_fps 0 to let vsync alone pace.
+        bool vsync() const;
+        // Frame rate the main loop is paced to (see FramePacer); 0 = uncapped.
+        int target_fps() const;
 
         // Setters (notify observers on change)
         void set_window_size(int width, int height);
         void set_fullscreen(bool enabled);
         void set_master_volume(float volume);
+        void set_render_thread(bool enabled);
+        void set_texture_budget_mb(int megabytes);
+        void set_vsync(bool enabled);
+        void set_target_fps(int fps);
 
         // Observer management
         ObserverId register_observer(Observer cb);
@@ -34,6 +47,10 @@ namespace zia::engine {
         int _height;
         bool _fullscreen;
         float _master_volume;
+        bool _render_thread = false;
+        int _texture_budget_mb = 256;
+        bool _vsync = false;
+        int _target_fps = 60;
 
         std::map<ObserverId, Observer> _observers;
         ObserverId _next_id = 1;
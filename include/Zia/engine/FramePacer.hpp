@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace zia::engine {
+    // Frame pacing counters since the last reset_stats().
+    struct FramePacerStats {
+        std::uint64_t frames = 0;
+        // Frames whose work ended after their deadline (always 0 when uncapped).
+        std::uint64_t missed = 0;
+        double last_frame_ms = 0.0;
+        double max_frame_ms = 0.0;
+        double total_frame_ms = 0.0;
+        // How late wait() returned past the deadline, worst case.
+        double max_wake_error_us = 0.0;
+
+        [[nodiscard]] double average_frame_ms() const { return frames > 0 ? total_frame_ms / static_cast<double>(frames) : 0.0; }
+        [[nodiscard]] double missed_ratio() const { return frames > 0 ? static_cast<double>(missed) / static_cast<double>(frames) : 0.0; }
+    };
+
+    // Paces the main loop to a target frame rate. wait() is called once per frame after presenting and
+    // returns at the next deadline: it sleeps until shortly before the deadline (OS sleeps overshoot by
+    // up to a timer tick), then spins for the remainder, so frames start within ~0.1 ms of the schedule.
+    // The sleep margin adapts to the oversleep observed on this machine. Deadlines advance by exactly one
+    // period so the average rate does not drift; after a hitch of more than a period the schedule
+    // restarts from the current time instead of rushing frames to catch up.
+    class FramePacer {
+    public:
+        explicit FramePacer(int target_fps = 60);
+
+        // 0 = uncapped: wait() only records statistics (benchmarks, or vsync doing the pacing).
+        void set_target_fps(int fps);
+        [[nodiscard]] int target_fps() const noexcept { return _target_fps; }
+
+        // Block until the current frame's deadline and advance the schedule.
+        void wait();
+
+        [[nodiscard]] const FramePacerStats &stats() const noexcept { return _stats; }
+        void reset_stats() { _stats = {}; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        void record_frame(Clock::time_point end);
+
+        int _target_fps = 0;
+        Clock::duration _period = Clock::duration::zero();
+        Clock::time_point _deadline;
+        Clock::time_point _last_frame_end;
+        bool _started = false;
+        // Time before the deadline at which the coarse sleep ends and spinning starts.
+        Clock::duration _sleep_margin;
+
+        FramePacerStats _stats;
+    };
+} // namespace zia::engine
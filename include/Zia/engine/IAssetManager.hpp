@@ -3,10 +3,36 @@
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <memory>
 
 namespace zia::engine {
+    // Scheduling priority of a streamed asset. Higher priorities are decoded and uploaded first.
+    enum class AssetPriority : std::uint8_t {
+        Low,    // decorative (clouds, far background layers)
+        Normal,
+        High    // needed on the first frames of a level (player, main background)
+    };
+
+    // Lifecycle of a streamed texture.
+    enum class AssetStatus : std::uint8_t {
+        Missing,   // never requested (or unloaded)
+        Queued,    // waiting for a decode worker
+        Decoding,  // being decoded on a worker thread
+        Uploading, // decoded, waiting for its share of the per-frame upload budget
+        Ready,
+        Failed
+    };
+
+    // Result of request_texture(): the id to draw with and the status at the time of the request.
+    struct TextureHandle {
+        int id = -1;
+        AssetStatus status = AssetStatus::Missing;
+    };
+
     class IAssetManager {
     public:
         virtual ~IAssetManager() = default;
@@ -15,6 +41,8 @@ namespace zia::engine {
         virtual std::shared_ptr<sf::Texture> get_mutable_texture(int id) = 0;
         virtual std::shared_ptr<const sf::Texture> get_texture(int id) const = 0;
         virtual bool has_texture(int id) const = 0;
+        // Id under which 'texture' is loaded, or -1 (placeholders, textures not owned by the manager).
+        virtual int find_texture_id(const sf::Texture &texture) const = 0;
 
         virtual bool load_font(int id, const std::string &path) = 0;
         virtual std::shared_ptr<const sf::Font> get_font(int id) const = 0;
@@ -22,7 +50,25 @@ namespace zia::engine {
 
         virtual void unload_all() = 0;
 
-        // Multi-threaded decode/finalize helpers used by PlayScene.
+        // Asynchronous streaming. The file is decoded on a worker pool and uploaded by
+        // finalize_decoded_images(); until then get_texture() returns a placeholder texture.
+        virtual TextureHandle request_texture(int id, const std::string &path, AssetPriority priority) = 0;
+        virtual AssetStatus texture_status(int id) const = 0;
+        // Maximum number of texture bytes uploaded per finalize_decoded_images() call (at least one
+        // texture is always uploaded so streaming makes progress).
+        virtual void set_upload_budget(std::size_t bytes_per_frame) = 0;
+        // Run 'job' on the same worker pool, queued with the texture decodes by priority (tile chunk
+        // reads use it). Jobs still queued when the manager is destroyed are dropped without running.
+        virtual void submit_job(AssetPriority priority, std::function<void()> job) = 0;
+
+        // Texture cache. Retained textures are never evicted; unretained ones are evicted least recently
+        // used first once the memory budget (bytes, 0 = unlimited) is exceeded, and reloaded on next use.
+        virtual void retain_texture(int id) = 0;
+        virtual void release_texture(int id) = 0;
+        virtual void set_memory_budget(std::size_t bytes) = 0;
+        virtual std::size_t texture_memory_usage() const = 0;
+
+        // Multi-threaded decode/finalize helpers. The application calls finalize once per frame.
         virtual void push_decoded_image(int id, sf::Image&& image) = 0;
         virtual void finalize_decoded_images() = 0;
     };
@@ -15,6 +15,7 @@ namespace zia::engine {
         // Basic non-template operations that can be polymorphic.
         virtual void clear() = 0;
         virtual zia::EntityID create_entity() = 0;
+        virtual void destroy_entity(zia::EntityID id) = 0;
 
         // Bridge to the underlying concrete manager for template operations.
         virtual zia::EntityManager& underlying() = 0;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <optional>
 
@@ -12,14 +13,25 @@ namespace zia::engine {
     public:
         virtual ~IInput() = default;
 
-        // Poll pending input events (typically called once per frame).
+        // Queue a window event; called by Application for every event it pumps.
+        virtual void handle_event(const sf::Event &event) = 0;
+
+        // Apply the queued events (typically called once per frame).
         virtual void poll() = 0;
 
         // Legacy: query whether an enum action is currently pressed.
         // Kept for compatibility with existing code that uses zia::InputManager::Action.
         [[nodiscard]] virtual bool is_pressed(zia::InputManager::Action action) const = 0;
 
-        // New string-based action API.
+        // Interned action ids (see zia::ActionId): resolve a name once, then query by id.
+        virtual zia::ActionId action_id(std::string_view name) = 0;
+        [[nodiscard]] virtual bool is_pressed(zia::ActionId action) const = 0;
+        [[nodiscard]] virtual bool is_down(zia::ActionId action) const = 0;
+        [[nodiscard]] virtual bool is_released(zia::ActionId action) const = 0;
+        // When the action last changed state (zero if it never did).
+        [[nodiscard]] virtual sf::Time last_change(zia::ActionId action) const = 0;
+
+        // String-based action API.
         [[nodiscard]] virtual bool is_pressed(const std::string &action) const = 0;
         [[nodiscard]] virtual bool is_down(const std::string &action) const = 0;
         [[nodiscard]] virtual bool is_released(const std::string &action) const = 0;
@@ -1,9 +1,19 @@
 #pragma once
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace zia::engine {
+    // Handle to a renderer-owned retained text object. 0 is never a valid handle.
+    using TextHandle = std::uint32_t;
+    inline constexpr TextHandle INVALID_TEXT_HANDLE = 0;
+
     // Minimal interface for a renderer used by the engine. Add methods as the engine needs them.
     class IRenderer {
     public:
@@ -32,9 +42,29 @@ namespace zia::engine {
         virtual void draw_rect(float x, float y, float width, float height, sf::Color color) = 0;
         virtual void draw_sprite(const sf::Texture& texture, float x, float y, float width, float height, const sf::IntRect& texture_rect) = 0;
         virtual void draw_sprite(int sprite_id, float x, float y) = 0;
+        // Draw a texture in screen space (default view), scaled by (scale_x, scale_y). An empty
+        // texture_rect draws the whole texture. Used for backgrounds, clouds and menu art.
+        virtual void draw_screen_sprite(const sf::Texture& texture, float x, float y, float scale_x, float scale_y, const sf::IntRect& texture_rect) = 0;
+        // Immediate-mode text, drawn in screen space with the UI text batch (see flush_text()).
         virtual void draw_text(const std::string& text, float x, float y, unsigned int size, sf::Color color) = 0;
         virtual void draw_ellipse(float x, float y, float width, float height, sf::Color color) = 0;
         virtual void draw_bbox(float x, float y, float width, float height, sf::Color color, float thickness) = 0;
+        // Draw a world-space line list (every two vertices form one segment) in a single draw call.
+        virtual void draw_lines(const std::vector<sf::Vertex>& vertices) = 0;
+
+        // Retained UI text. A text object keeps its glyph geometry between frames and only rebuilds it
+        // when the string, character size or colour changes; moving it is a transform change only.
+        virtual TextHandle create_text() = 0;
+        virtual void update_text(TextHandle handle, std::string_view text, float x, float y, unsigned int size, sf::Color color) = 0;
+        virtual void destroy_text(TextHandle handle) = 0;
+        // Queue a text object for this frame's UI text batch (screen space).
+        virtual void submit_text(TextHandle handle) = 0;
+        // Draw every queued UI text inside a single switch to the screen view, then clear the queue.
+        // The application calls this before the ImGui overlay; end_frame() flushes anything left over.
+        virtual void flush_text() = 0;
+
+        // Synchronise presentation with the display refresh (see EngineConfig::vsync).
+        virtual void set_vsync(bool enabled) = 0;
 
         // Debug
         virtual void toggle_debug_bboxes() = 0;
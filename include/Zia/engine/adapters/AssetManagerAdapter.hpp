@@ -15,6 +15,7 @@ namespace zia::engine::adapters {
         std::shared_ptr<sf::Texture> get_mutable_texture(int id) override { return _assets ? _assets->get_mutable_texture(id) : nullptr; }
         std::shared_ptr<const sf::Texture> get_texture(int id) const override { return _assets ? _assets->get_texture(id) : nullptr; }
         bool has_texture(int id) const override { return _assets ? _assets->has_texture(id) : false; }
+        int find_texture_id(const sf::Texture &texture) const override { return _assets ? _assets->find_texture_id(texture) : -1; }
 
         bool load_font(int id, const std::string &path) override { return _assets ? _assets->load_font(id, path) : false; }
         std::shared_ptr<const sf::Font> get_font(int id) const override { return _assets ? _assets->get_font(id) : nullptr; }
@@ -22,6 +23,21 @@ namespace zia::engine::adapters {
 
         void unload_all() override { if (_assets) _assets->unload_all(); }
 
+        engine::TextureHandle request_texture(int id, const std::string &path, engine::AssetPriority priority) override {
+            return _assets ? _assets->request_texture(id, path, priority) : engine::TextureHandle{id, engine::AssetStatus::Failed};
+        }
+        engine::AssetStatus texture_status(int id) const override { return _assets ? _assets->texture_status(id) : engine::AssetStatus::Missing; }
+        void set_upload_budget(std::size_t bytes_per_frame) override { if (_assets) _assets->set_upload_budget(bytes_per_frame); }
+        void submit_job(engine::AssetPriority priority, std::function<void()> job) override {
+            if (_assets) _assets->submit_job(priority, std::move(job));
+            else if (job) job();
+        }
+
+        void retain_texture(int id) override { if (_assets) _assets->retain_texture(id); }
+        void release_texture(int id) override { if (_assets) _assets->release_texture(id); }
+        void set_memory_budget(std::size_t bytes) override { if (_assets) _assets->set_memory_budget(bytes); }
+        std::size_t texture_memory_usage() const override { return _assets ? _assets->texture_memory_usage() : 0; }
+
         void push_decoded_image(int id, sf::Image&& image) override { if (_assets) _assets->push_decoded_image(id, std::move(image)); }
         void finalize_decoded_images() override { if (_assets) _assets->finalize_decoded_images(); }
 
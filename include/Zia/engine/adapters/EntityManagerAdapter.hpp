@@ -13,6 +13,7 @@ namespace zia::engine::adapters {
 
         void clear() override { if (_entities) _entities->clear(); }
         zia::EntityID create_entity() override { return _entities ? _entities->create_entity() : 0; }
+        void destroy_entity(zia::EntityID id) override { if (_entities) _entities->destroy_entity(id); }
 
         zia::EntityManager& underlying() override { return *_entities; }
         const zia::EntityManager& underlying() const override { return *_entities; }
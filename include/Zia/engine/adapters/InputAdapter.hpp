@@ -11,10 +11,17 @@ namespace zia::engine::adapters {
         explicit InputAdapter(std::shared_ptr<zia::InputManager> i) : _input(std::move(i)) {}
         ~InputAdapter() override = default;
 
+        void handle_event(const sf::Event &event) override { if (_input) _input->handle_event(event); }
         void poll() override { if (_input) _input->poll(); }
 
         [[nodiscard]] bool is_pressed(zia::InputManager::Action action) const override { return _input ? _input->is_pressed(action) : false; }
 
+        zia::ActionId action_id(std::string_view name) override { return _input ? _input->intern(name) : zia::INVALID_ACTION; }
+        [[nodiscard]] bool is_pressed(zia::ActionId action) const override { return _input ? _input->is_pressed(action) : false; }
+        [[nodiscard]] bool is_down(zia::ActionId action) const override { return _input ? _input->is_down(action) : false; }
+        [[nodiscard]] bool is_released(zia::ActionId action) const override { return _input ? _input->is_released(action) : false; }
+        [[nodiscard]] sf::Time last_change(zia::ActionId action) const override { return _input ? _input->last_change(action) : sf::Time::Zero; }
+
         [[nodiscard]] bool is_pressed(const std::string &action) const override { return _input ? _input->is_pressed(action) : false; }
         [[nodiscard]] bool is_down(const std::string &action) const override { return _input ? _input->is_down(action) : false; }
         [[nodiscard]] bool is_released(const std::string &action) const override { return _input ? _input->is_released(action) : false; }
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "Zia/engine/ecs/EntityManager.hpp"
+
+#include <algorithm>
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace zia::engine {
+    // Appends raw bytes to a snapshot buffer. The owner clears the buffer between saves; it keeps its
+    // capacity, so saving a world of the same size again does not allocate.
+    class SnapshotWriter {
+    public:
+        explicit SnapshotWriter(std::vector<std::byte> &out) : _out(out) {}
+
+        void write(const void *data, std::size_t size) {
+            const auto *bytes = static_cast<const std::byte *>(data);
+            _out.insert(_out.end(), bytes, bytes + size);
+        }
+
+        template<typename T>
+        void write_value(const T &value) {
+            static_assert(std::is_trivially_copyable_v<T>, "write_value copies raw bytes");
+            write(&value, sizeof(T));
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return _out.size(); }
+
+    private:
+        std::vector<std::byte> &_out;
+    };
+
+    // Reads a snapshot buffer back. Every read fails once the data runs out.
+    class SnapshotReader {
+    public:
+        SnapshotReader(const std::byte *data, std::size_t size) : _data(data), _size(size) {}
+
+        bool read(void *out, std::size_t size) {
+            const std::byte *bytes = view(size);
+            if (!bytes) return false;
+            std::memcpy(out, bytes, size);
+            return true;
+        }
+
+        template<typename T>
+        bool read_value(T &value) {
+            static_assert(std::is_trivially_copyable_v<T>, "read_value copies raw bytes");
+            return read(&value, sizeof(T));
+        }
+
+        // The next 'size' bytes without copying them (nullptr, consuming nothing, if fewer are left).
+        const std::byte *view(std::size_t size) {
+            if (size > _size - _offset) return nullptr;
+            const std::byte *bytes = _data + _offset;
+            _offset += size;
+            return bytes;
+        }
+
+        [[nodiscard]] bool at_end() const noexcept { return _offset == _size; }
+
+    private:
+        const std::byte *_data;
+        std::size_t _size;
+        std::size_t _offset = 0;
+    };
+
+    // How one component is written. Trivially copyable components are copied as raw bytes; other
+    // types specialise this (e.g. NameComponent in game/world/WorldSnapshot.hpp).
+    template<typename T>
+    struct SnapshotCodec {
+        static_assert(std::is_trivially_copyable_v<T>, "specialise zia::engine::SnapshotCodec for this component");
+
+        static void write(SnapshotWriter &out, const T &component) { out.write(&component, sizeof(T)); }
+        static bool read(SnapshotReader &in, T &component) { return in.read(&component, sizeof(T)); }
+    };
+
+    // Saves and restores the stores of the listed component types. Layout, per type in list order:
+    //   u32 count | count entity ids, ascending | count encoded components, same order
+    // Restoring overwrites each component in place when its entity still has one and only inserts
+    // (allocating a map node) for components removed since the save, so rolling back a few frames
+    // costs about a memcpy per component. Components added since the save are erased.
+    template<typename... Components>
+    struct ComponentSnapshot {
+        static void save(const zia::EntityManager &entities, SnapshotWriter &out) {
+            (save_store<Components>(entities, out), ...);
+        }
+
+        // Returns false when the data is truncated; the stores read so far stay restored.
+        static bool restore(zia::EntityManager &entities, SnapshotReader &in) {
+            return (restore_store<Components>(entities, in) && ...);
+        }
+
+    private:
+        template<typename T>
+        static void save_store(const zia::EntityManager &entities, SnapshotWriter &out) {
+            // Sorted so restore can binary-search the ids; reused between saves.
+            static thread_local std::vector<std::pair<EntityID, const T *>> sorted;
+            sorted.clear();
+            if (const auto *store = entities.find_component_store<T>()) {
+                for (const auto &[id, value] : *store) {
+                    if (const T *component = std::any_cast<T>(&value)) {
+                        sorted.emplace_back(id, component);
+                    }
+                }
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+            out.write_value(static_cast<std::uint32_t>(sorted.size()));
+            for (const auto &entry : sorted) {
+                out.write_value(entry.first);
+            }
+            for (const auto &entry : sorted) {
+                SnapshotCodec<T>::write(out, *entry.second);
+            }
+        }
+
+        template<typename T>
+        static bool restore_store(zia::EntityManager &entities, SnapshotReader &in) {
+            std::uint32_t count = 0;
+            if (!in.read_value(count)) return false;
+            const std::byte *ids = in.view(static_cast<std::size_t>(count) * sizeof(EntityID));
+            if (!ids) return false;
+            const auto id_at = [ids](std::size_t i) {
+                EntityID id = 0;
+                std::memcpy(&id, ids + i * sizeof(EntityID), sizeof(EntityID));
+                return id;
+            };
+
+            auto &store = entities.component_store<T>();
+            for (std::size_t i = 0; i < count; ++i) {
+                auto it = store.find(id_at(i));
+                if (it == store.end()) {
+                    it = store.emplace(id_at(i), T{}).first;
+                }
+                T *component = std::any_cast<T>(&it->second);
+                if (!component) {
+                    it->second = T{};
+                    component = std::any_cast<T>(&it->second);
+                }
+                if (!SnapshotCodec<T>::read(in, *component)) return false;
+            }
+
+            // Every saved id is now present, so any surplus was added after the save.
+            if (store.size() != count) {
+                const auto saved = [&id_at, count](EntityID id) {
+                    std::size_t lo = 0;
+                    std::size_t hi = count;
+                    while (lo < hi) {
+                        const std::size_t mid = lo + (hi - lo) / 2;
+                        if (id_at(mid) < id) lo = mid + 1; else hi = mid;
+                    }
+                    return lo < count && id_at(lo) == id;
+                };
+                for (auto it = store.begin(); it != store.end();) {
+                    it = saved(it->first) ? std::next(it) : store.erase(it);
+                }
+            }
+            return true;
+        }
+    };
+} // namespace zia::engine
@@ -7,7 +7,9 @@
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <memory_resource>
 #include <optional>
+#include <utility>
 
 namespace zia {
 
@@ -18,6 +20,9 @@ using EntityID = uint32_t;
 // Components are stored as std::any keyed by std::type_index and by EntityID.
 class EntityManager {
 public:
+    // Components of one type by entity id. Map nodes come from the manager's memory resource.
+    using ComponentStore = std::pmr::unordered_map<EntityID, std::any>;
+
     // Used by: Spawner::spawn_* functions, various systems when creating entities (background, clouds, enemies)
     // Create a new entity and return its unique ID.
     // IDs start from 1 and increment; 0 is reserved as an invalid ID.
@@ -30,7 +35,7 @@ public:
     // Overwrites any existing component of the same type for that entity.
     template<typename T>
     void add_component(EntityID id, T comp) {
-        _components[std::type_index(typeid(T))][id] = comp;
+        component_store<T>()[id] = comp;
     }
 
     // Used by: Systems and helpers that need mutable access (e.g. PhysicsSystem, EnemySystem, AnimationSystem, SpriteRenderSystem)
@@ -197,7 +202,7 @@ public:
         out.clear();
 
         // Collect pointers to the component maps for each requested type.
-        std::vector<const std::unordered_map<EntityID, std::any>*> maps;
+        std::vector<const ComponentStore*> maps;
         maps.reserve(sizeof...(Ts));
 
         bool missing = false;
@@ -237,18 +242,63 @@ public:
     }
 
     // Used by: Test/cleanup code and when resetting the ECS between levels
-    // Clear all components and reset the entity counter to zero.
+    // Clear all components and reset the entity counter to zero. The memory resource goes back to the
+    // default heap too: the level arena it pointed to is usually released right after.
     void clear() {
         _components.clear();
         _next_id = 0;
+        _memory = std::pmr::get_default_resource();
+    }
+
+    // Used by: PlayPipeline after loading a level (see Level::component_memory)
+    // Allocate the nodes of component stores created from now on from 'memory' (nullptr = the default
+    // heap). Stores that already exist keep their resource, so set it while the manager is empty.
+    // 'memory' must outlive the stores: clear() the manager before releasing it.
+    void set_memory_resource(std::pmr::memory_resource* memory) {
+        _memory = memory ? memory : std::pmr::get_default_resource();
+    }
+
+    // Used by: ChunkStreamingSystem (enemies left behind in evicted chunks)
+    // Remove every component of an entity. The id is not reused.
+    void destroy_entity(EntityID id) {
+        for (auto& pair : _components) {
+            pair.second.erase(id);
+        }
+    }
+
+    // Used by: PlayPipeline when switching to a prefetched level
+    // Exchange the whole entity set (components, id counter and memory resource) with another manager in O(1).
+    void swap(EntityManager& other) noexcept {
+        std::swap(_next_id, other._next_id);
+        std::swap(_memory, other._memory);
+        _components.swap(other._components);
+    }
+
+    // Used by: engine::ComponentSnapshot (saving and restoring whole component stores)
+    // Storage of component type T (entity id -> component), nullptr if no entity ever had one.
+    template<typename T>
+    const ComponentStore* find_component_store() const {
+        auto type_it = _components.find(std::type_index(typeid(T)));
+        return type_it != _components.end() ? &type_it->second : nullptr;
+    }
+
+    // Mutable variant; creates the (empty) store of T if needed.
+    template<typename T>
+    ComponentStore& component_store() {
+        return _components.try_emplace(std::type_index(typeid(T)), ComponentStore::allocator_type(_memory)).first->second;
     }
 
+    // Last entity id handed out. Snapshots restore it, so a resimulation hands out the same ids again.
+    EntityID entity_counter() const { return _next_id; }
+    void set_entity_counter(EntityID id) { _next_id = id; }
 
 private:
     // Next entity ID to assign. Starts at 0; first entity will have ID 1.
     EntityID _next_id = 0;
+    // Resource new component stores allocate their nodes from (see set_memory_resource).
+    std::pmr::memory_resource* _memory = std::pmr::get_default_resource();
     // Map from component type index -> map(entity id -> component stored as std::any).
-    std::unordered_map<std::type_index, std::unordered_map<EntityID, std::any>> _components;
+    std::unordered_map<std::type_index, ComponentStore> _components;
 };
 
 } // namespace Zia
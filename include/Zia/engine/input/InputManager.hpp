@@ -1,16 +1,34 @@
 #pragma once
 
 #include <array>
+#include <bitset>
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include <optional>
 #include <algorithm>
 #include "Zia/engine/input/Binding.hpp"
 
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/Event.hpp>
+#include <SFML/Window/Joystick.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+
 namespace zia {
+    // Interned action identifier: an index into the flat action state bitsets. The enum actions of
+    // InputManager::Action always hold ids 0..Action::Count-1.
+    using ActionId = std::uint16_t;
+    inline constexpr ActionId INVALID_ACTION = 0xFFFF;
+
     // Key bindings, edge detection (pressed/released).
+    // Input is event driven: the window events pumped by Application are queued with a timestamp by
+    // handle_event() and applied by poll(), which only touches the bindings of the devices that changed
+    // (O(events) per frame). Action state lives in bitsets indexed by ActionId, so queries are a bit test.
     class InputManager {
     public:
         enum class Action {
@@ -19,16 +37,48 @@ namespace zia {
             Jump,
             Escape,
             ToggleDebug, // toggle debug overlay (bounding boxes)
+            QuickSave,
+            QuickLoad,
             Count
         };
 
-        // Poll low-level inputs and update action states.
+        // Upper bound on interned actions (enum actions included).
+        static constexpr std::size_t MAX_ACTIONS = 64;
+
+        // Interns the enum actions and binds their default keys.
+        InputManager();
+
+        // Name under which an enum action is interned ("Unknown" for Count).
+        [[nodiscard]] static const std::string &action_name(Action action);
+        [[nodiscard]] static constexpr ActionId action_id(Action action) { return static_cast<ActionId>(action); }
+
+        // Id of 'name', interning it on first use; INVALID_ACTION once MAX_ACTIONS are in use. Callers
+        // that query every frame should keep the id rather than pass the name.
+        ActionId intern(std::string_view name);
+        // Id of an already interned action, INVALID_ACTION otherwise.
+        [[nodiscard]] ActionId find_action(std::string_view name) const;
+
+        // Queue a window event for the next poll(). Events other than key, mouse button, joystick and
+        // focus changes are ignored. Losing focus releases everything, since the matching release
+        // events go to another window.
+        void handle_event(const sf::Event &event);
+
+        // Apply the queued events and update action states. Down/released edges describe this poll
+        // only; a press and release between two polls reports both edges.
         void poll();
 
         // Old API: query by enum action (kept for backward compatibility).
         [[nodiscard]] bool is_pressed(Action action) const;
 
-        // New string-based API for actions.
+        // Interned-id API: bit tests, out-of-range ids read as released.
+        [[nodiscard]] bool is_pressed(ActionId action) const;
+        [[nodiscard]] bool is_down(ActionId action) const;
+        [[nodiscard]] bool is_released(ActionId action) const;
+        // When the action last changed state, on the clock of this manager (the time its event was
+        // handled); zero if it never did.
+        [[nodiscard]] sf::Time last_change(ActionId action) const;
+
+        // String-based API: one lookup per call, no allocation.
         [[nodiscard]] bool is_pressed(const std::string &action) const;
         [[nodiscard]] bool is_down(const std::string &action) const;
         [[nodiscard]] bool is_released(const std::string &action) const;
@@ -39,7 +89,8 @@ namespace zia {
         void add_binding(const std::string &action, Binding const &binding);
         void remove_binding(const std::string &action, Binding const &binding);
 
-        // Persistence
+        // Persistence. Loading replaces the bindings of the actions listed in the file; the others keep
+        // theirs (e.g. the default keys).
         void load_bindings_from_file(const std::string &path);
         void save_bindings_to_file(const std::string &path) const;
 
@@ -50,19 +101,63 @@ namespace zia {
         // Poll once to obtain a captured binding (if any) while in capture mode.
         std::optional<Binding> poll_captured_binding();
 
-        // Set action state directly (used internally and for compatibility).
+        // Set action state directly, bypassing the bindings (scripted input, tests).
         void set_action_state(Action action, bool pressed);
 
     private:
-        std::array<bool, static_cast<std::size_t>(Action::Count)> _pressed = {};
+        // A device change taken from a window event. 'value' is 1/0 for buttons and the axis position
+        // (-100..100) for axes.
+        struct DeviceEvent {
+            InputDevice device = InputDevice::Keyboard;
+            int code = -1;
+            int joystick = 0;
+            float value = 0.0f;
+            sf::Time time;
+            bool reset = false; // focus lost: release everything
+        };
+
+        // A binding of one action, with whether its input is currently active.
+        struct BoundInput {
+            Binding binding;
+            ActionId action = INVALID_ACTION;
+            bool active = false;
+        };
+
+        void apply(const DeviceEvent &event);
+        void capture(const DeviceEvent &event);
+        void update_bound(std::uint32_t key, sf::Time time);
+        void update_binding(BoundInput &bound, sf::Time time);
+        void set_held(ActionId action, bool held, sf::Time time);
+        [[nodiscard]] bool binding_active(const Binding &binding) const;
+        void release_all(sf::Time time);
+        // Rebuild the device -> binding index after the bindings changed.
+        void rebuild_bindings();
+
+        // Interned names; the index is the ActionId.
+        std::vector<std::string> _names;
+        std::unordered_map<std::string, ActionId> _ids;
+
+        // Action state, indexed by ActionId.
+        std::bitset<MAX_ACTIONS> _held;
+        std::bitset<MAX_ACTIONS> _down;
+        std::bitset<MAX_ACTIONS> _released;
+        std::array<sf::Time, MAX_ACTIONS> _changed_at = {};
+        // Bindings of each action currently active.
+        std::array<std::uint8_t, MAX_ACTIONS> _active_bindings = {};
+
+        // Bindings per action (indexed by ActionId) and the flattened index used by poll().
+        std::vector<std::vector<Binding>> _bindings;
+        std::vector<BoundInput> _bound;
+        std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> _bound_by_input;
 
-        // New: mapping from action name to list of Bindings
-        std::unordered_map<std::string, std::vector<Binding>> _bindings;
+        // Device state as reported by events.
+        std::bitset<sf::Keyboard::KeyCount> _keys;
+        std::bitset<sf::Mouse::ButtonCount> _mouse_buttons;
+        std::array<std::bitset<sf::Joystick::ButtonCount>, sf::Joystick::Count> _joystick_buttons = {};
+        std::array<std::array<float, sf::Joystick::AxisCount>, sf::Joystick::Count> _joystick_axes = {};
 
-        // Edge detection / state by action name
-        std::unordered_map<std::string, bool> _pressed_by_name;
-        std::unordered_map<std::string, bool> _down_by_name;
-        std::unordered_map<std::string, bool> _released_by_name;
+        std::vector<DeviceEvent> _queue;
+        sf::Clock _clock;
 
         // Capture state
         bool _capturing = false;
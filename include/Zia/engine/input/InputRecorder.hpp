@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Zia/engine/IInput.hpp"
+#include "Zia/engine/input/InputRecording.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+
+namespace zia::engine {
+    // IInput decorator that forwards to the live input and appends the action bitset of every poll()
+    // (one poll per fixed-timestep update) to a recording, saved with save().
+    class InputRecorder : public IInput {
+    public:
+        // 'recording' carries the level, seed and dt of the run; its ticks are appended to.
+        // 'state_hash', when set, is sampled on every poll so the last value ends up in the file.
+        InputRecorder(std::shared_ptr<IInput> live, InputRecording recording, std::function<std::uint64_t()> state_hash = {});
+
+        void handle_event(const sf::Event &event) override { _live->handle_event(event); }
+        void poll() override;
+
+        [[nodiscard]] bool is_pressed(zia::InputManager::Action action) const override { return _live->is_pressed(action); }
+        zia::ActionId action_id(std::string_view name) override { return _live->action_id(name); }
+        [[nodiscard]] bool is_pressed(zia::ActionId action) const override { return _live->is_pressed(action); }
+        [[nodiscard]] bool is_down(zia::ActionId action) const override { return _live->is_down(action); }
+        [[nodiscard]] bool is_released(zia::ActionId action) const override { return _live->is_released(action); }
+        [[nodiscard]] sf::Time last_change(zia::ActionId action) const override { return _live->last_change(action); }
+
+        [[nodiscard]] bool is_pressed(const std::string &action) const override { return _live->is_pressed(action); }
+        [[nodiscard]] bool is_down(const std::string &action) const override { return _live->is_down(action); }
+        [[nodiscard]] bool is_released(const std::string &action) const override { return _live->is_released(action); }
+
+        [[nodiscard]] std::vector<zia::Binding> get_bindings(const std::string &action) const override { return _live->get_bindings(action); }
+        void set_bindings(const std::string &action, const std::vector<zia::Binding> &bindings) override { _live->set_bindings(action, bindings); }
+        void add_binding(const std::string &action, zia::Binding const &binding) override { _live->add_binding(action, binding); }
+        void remove_binding(const std::string &action, zia::Binding const &binding) override { _live->remove_binding(action, binding); }
+
+        void load_bindings_from_file(const std::string &path) override { _live->load_bindings_from_file(path); }
+        void save_bindings_to_file(const std::string &path) const override { _live->save_bindings_to_file(path); }
+
+        void start_capture(const std::string &action) override { _live->start_capture(action); }
+        void stop_capture() override { _live->stop_capture(); }
+        [[nodiscard]] bool is_capturing() const override { return _live->is_capturing(); }
+        std::optional<zia::Binding> poll_captured_binding() override { return _live->poll_captured_binding(); }
+
+        [[nodiscard]] const InputRecording &recording() const noexcept { return _recording; }
+        bool save(const std::filesystem::path &path) const { return save_input_recording(path, _recording); }
+
+    private:
+        std::shared_ptr<IInput> _live;
+        InputRecording _recording;
+        std::function<std::uint64_t()> _state_hash;
+    };
+} // namespace zia::engine
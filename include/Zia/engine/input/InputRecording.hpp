@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Zia/engine/IInput.hpp"
+
+namespace zia::engine {
+    // Input recording (.zrep) layout, little-endian:
+    //   InputRecordingHeader | level path (level_path_size bytes, no NUL) | ticks (tick_count bytes)
+    // Each tick is the bitset of InputManager::Action values held during one fixed-timestep update
+    // (bit n = action n). Together with the stored dt and RNG seed, replaying the ticks reproduces the
+    // recorded run exactly; final_state_hash lets the replay check that it did.
+    inline constexpr std::uint32_t INPUT_RECORDING_MAGIC = 0x5045525Au; // "ZREP"
+    inline constexpr std::uint32_t INPUT_RECORDING_VERSION = 1;
+
+    static_assert(static_cast<int>(zia::InputManager::Action::Count) <= 8, "action bitsets are stored in one byte per tick");
+
+    struct InputRecordingHeader {
+        std::uint32_t magic = INPUT_RECORDING_MAGIC;
+        std::uint32_t version = INPUT_RECORDING_VERSION;
+        std::uint32_t tick_count = 0;
+        std::uint32_t seed = 0;
+        float dt = 0.0f;
+        std::uint32_t level_path_size = 0;
+        // World state hash seen when the last tick was polled (0 = not recorded).
+        std::uint64_t final_state_hash = 0;
+    };
+
+    struct InputRecording {
+        std::string level_path;
+        std::uint32_t seed = 0;
+        float dt = 1.0f / 60.0f;
+        std::uint64_t final_state_hash = 0;
+        std::vector<std::uint8_t> ticks;
+    };
+
+    // Returns false (with a message on stderr) when the file cannot be read or is not a recording.
+    bool load_input_recording(const std::filesystem::path &path, InputRecording &out);
+    bool save_input_recording(const std::filesystem::path &path, const InputRecording &recording);
+
+    // Action bitset of the given input's current state.
+    [[nodiscard]] std::uint8_t action_bits(const IInput &input);
+} // namespace zia::engine
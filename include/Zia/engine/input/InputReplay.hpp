@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Zia/engine/IInput.hpp"
+#include "Zia/engine/input/InputRecording.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace zia::engine {
+    // IInput that plays back a recording: each poll() advances one tick. Once the ticks run out the
+    // Escape action is held, which leaves the play scene and ends a replay run. Bindings and capture
+    // are inert; live devices are never read.
+    class InputReplay : public IInput {
+    public:
+        // 'state_hash', when set, is compared against the recording's final hash at the last tick.
+        explicit InputReplay(InputRecording recording, std::function<std::uint64_t()> state_hash = {});
+
+        // Live events are ignored.
+        void handle_event(const sf::Event &) override {}
+        void poll() override;
+
+        [[nodiscard]] bool is_pressed(zia::InputManager::Action action) const override;
+
+        // Only the enum actions are recorded; other names resolve to INVALID_ACTION. Change times are
+        // on the replay's own clock: tick index * dt.
+        zia::ActionId action_id(std::string_view name) override;
+        [[nodiscard]] bool is_pressed(zia::ActionId action) const override;
+        [[nodiscard]] bool is_down(zia::ActionId action) const override;
+        [[nodiscard]] bool is_released(zia::ActionId action) const override;
+        [[nodiscard]] sf::Time last_change(zia::ActionId action) const override;
+
+        [[nodiscard]] bool is_pressed(const std::string &action) const override;
+        [[nodiscard]] bool is_down(const std::string &action) const override;
+        [[nodiscard]] bool is_released(const std::string &action) const override;
+
+        [[nodiscard]] std::vector<zia::Binding> get_bindings(const std::string &) const override { return {}; }
+        void set_bindings(const std::string &, const std::vector<zia::Binding> &) override {}
+        void add_binding(const std::string &, zia::Binding const &) override {}
+        void remove_binding(const std::string &, zia::Binding const &) override {}
+
+        void load_bindings_from_file(const std::string &) override {}
+        void save_bindings_to_file(const std::string &) const override {}
+
+        void start_capture(const std::string &) override {}
+        void stop_capture() override {}
+        [[nodiscard]] bool is_capturing() const override { return false; }
+        std::optional<zia::Binding> poll_captured_binding() override { return std::nullopt; }
+
+        [[nodiscard]] const InputRecording &recording() const noexcept { return _recording; }
+        [[nodiscard]] std::size_t ticks_played() const noexcept { return _tick; }
+        [[nodiscard]] bool finished() const noexcept { return _tick >= _recording.ticks.size(); }
+        // Whether the world matched the recording at the last tick; empty until it was reached, or
+        // when either side has no hash.
+        [[nodiscard]] std::optional<bool> state_matches() const noexcept { return _state_matches; }
+        [[nodiscard]] std::uint64_t replayed_state_hash() const noexcept { return _replayed_hash; }
+
+    private:
+        [[nodiscard]] static bool bit(std::uint8_t bits, zia::ActionId action);
+
+        InputRecording _recording;
+        std::function<std::uint64_t()> _state_hash;
+        std::size_t _tick = 0;
+        std::uint8_t _bits = 0;
+        std::uint8_t _previous_bits = 0;
+        std::array<sf::Time, static_cast<std::size_t>(zia::InputManager::Action::Count)> _changed_at = {};
+        std::optional<bool> _state_matches;
+        std::uint64_t _replayed_hash = 0;
+    };
+} // namespace zia::engine
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace zia::engine {
+    // Monotonic allocator for data that lives exactly as long as one loaded level: the spawn table and
+    // its strings, background layers and the level's ECS component stores.
+    // Allocation is a pointer bump and deallocation does nothing; reset() releases everything at once,
+    // so unloading a level frees no individual nodes and leaves no holes in the heap.
+    //
+    // The first block is kept across resets and grown to the largest level seen, so once a level of
+    // that size has been loaded, the following ones are built without touching the heap. Data that is
+    // freed and reallocated while the level runs (entities created and destroyed) goes through pool(),
+    // which recycles freed blocks instead of bumping forever.
+    //
+    // Not thread-safe: a level is built on one thread (e.g. the prefetch worker) and then handed over.
+    class LevelArena final : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t DEFAULT_BLOCK_BYTES = 64 * 1024;
+
+        explicit LevelArena(std::size_t block_bytes = DEFAULT_BLOCK_BYTES);
+
+        LevelArena(const LevelArena &) = delete;
+        LevelArena &operator=(const LevelArena &) = delete;
+
+        // Recycling resource over the arena for data with a shorter lifetime than the level.
+        std::pmr::memory_resource *pool() { return &_pool; }
+
+        // Invalidate every allocation made from the arena and its pool. Containers still pointing
+        // into the arena must be destroyed or emptied first.
+        void reset();
+
+        // Bytes handed out since the last reset (alignment padding not included).
+        [[nodiscard]] std::size_t bytes_used() const noexcept { return _used; }
+        // Size of the block reused across resets.
+        [[nodiscard]] std::size_t block_bytes() const noexcept { return _block_bytes; }
+
+    private:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *, std::size_t, std::size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+        std::size_t _block_bytes;
+        std::unique_ptr<std::byte[]> _block;
+        // Bumps through _block, then through heap blocks that reset() returns.
+        std::optional<std::pmr::monotonic_buffer_resource> _buffer;
+        std::pmr::unsynchronized_pool_resource _pool;
+        std::size_t _used = 0;
+    };
+} // namespace zia::engine
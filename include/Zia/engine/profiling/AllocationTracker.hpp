@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+// Opt-in heap allocation tracking. Built with ZIA_TRACK_ALLOCATIONS=1 (CMake option
+// ZIA_TRACK_ALLOCATIONS=ON) the global operator new/delete are replaced by counting versions: every
+// thread keeps its own counters (read by profiler scopes to attribute allocations to a scope) and
+// process-wide totals give the allocations per frame. Without the option nothing is replaced, the
+// counters stay at zero and ZIA_ASSERT_NO_ALLOC compiles to nothing.
+#ifndef ZIA_TRACK_ALLOCATIONS
+#define ZIA_TRACK_ALLOCATIONS 0
+#endif
+
+namespace zia::engine::allocation_tracker {
+    struct Counters {
+        std::uint64_t allocations = 0;
+        std::uint64_t frees = 0;
+        // Bytes requested from operator new (frees are counted, not sized).
+        std::uint64_t bytes = 0;
+    };
+
+    // True when operator new/delete are replaced in this build.
+    constexpr bool compiled_in() { return ZIA_TRACK_ALLOCATIONS != 0; }
+
+    // Allocations made by the calling thread since it started.
+    [[nodiscard]] Counters thread_counters();
+    // Allocations made by all threads since the process started.
+    [[nodiscard]] Counters process_counters();
+
+    // While one of these is alive, any allocation on the constructing thread is reported on stderr
+    // with the scope's label and, in builds without NDEBUG, fails an assertion at the allocation site
+    // so a debugger stops on the offending call. Used through ZIA_ASSERT_NO_ALLOC.
+    class NoAllocScope {
+    public:
+        explicit NoAllocScope(const char* label);
+        ~NoAllocScope();
+
+        NoAllocScope(const NoAllocScope&) = delete;
+        NoAllocScope& operator=(const NoAllocScope&) = delete;
+
+    private:
+        const char* _previous_label;
+    };
+} // namespace zia::engine::allocation_tracker
+
+#if ZIA_TRACK_ALLOCATIONS
+#define ZIA_ALLOC_CONCAT_INNER(a, b) a##b
+#define ZIA_ALLOC_CONCAT(a, b) ZIA_ALLOC_CONCAT_INNER(a, b)
+#define ZIA_ASSERT_NO_ALLOC(label) ::zia::engine::allocation_tracker::NoAllocScope ZIA_ALLOC_CONCAT(zia_no_alloc_, __LINE__)(label)
+#else
+#define ZIA_ASSERT_NO_ALLOC(label) ((void)0)
+#endif
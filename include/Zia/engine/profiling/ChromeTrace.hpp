@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Zia/engine/profiling/Profiler.hpp"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace zia::engine {
+    // Writes profiler frames as a Chrome Trace Event file ({"traceEvents": [...]}), which opens in
+    // chrome://tracing and ui.perfetto.dev. Every scope becomes a complete ("X") event on its thread's
+    // track, named after 'thread_names'; each frame adds a "frame N" event on the main thread's track
+    // (lane 'frame_lane') that encloses that frame's scopes. Timestamps are microseconds relative to
+    // the first frame's start, so traces from different builds line up.
+    bool write_chrome_trace(const std::filesystem::path& path, const std::vector<const ProfileFrame*>& frames,
+                            const std::vector<std::string>& thread_names, std::uint16_t frame_lane = 0);
+} // namespace zia::engine
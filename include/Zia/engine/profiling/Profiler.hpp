@@ -0,0 +1,219 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Scoped CPU timers.
+//
+//   void CollisionSystem::update(...) {
+//       ZIA_PROFILE_SCOPE("collision");
+//       ...
+//   }
+//
+// A scope records its start and end time into a ring buffer owned by the calling thread; nothing is
+// locked or allocated on that path. Once per frame Profiler::mark_frame() (called by the main loop)
+// drains every thread's ring into a frame record, and the last HISTORY_FRAMES records are kept for
+// the profiler window. Scope names must be string literals (or otherwise outlive the profiler).
+//
+// Recorded frames can also be written as a Chrome trace (see ChromeTrace.hpp), either for a fixed
+// window of frames (capture_frames) or for the last N seconds (set_trace_retention).
+//
+// Built with ZIA_ENABLE_PROFILER=0 (CMake option ZIA_ENABLE_PROFILER=OFF) the macro expands to
+// nothing; at runtime Profiler::set_enabled(false) reduces a scope to one relaxed atomic load.
+#ifndef ZIA_ENABLE_PROFILER
+#define ZIA_ENABLE_PROFILER 1
+#endif
+
+namespace zia::engine {
+    // One timed scope. Times are nanoseconds on Profiler::now_ns()'s clock.
+    struct ProfileSample {
+        const char* name = nullptr;
+        std::int64_t start_ns = 0;
+        std::int64_t end_ns = 0;
+        // Nesting level on its thread (0 = outermost scope).
+        std::uint16_t depth = 0;
+        // Thread lane, index into Profiler::thread_names(). Lanes of exited threads are reused.
+        std::uint16_t thread = 0;
+        // Heap allocations made by the thread inside the scope (nested scopes included); always 0
+        // unless allocation tracking is compiled in (see AllocationTracker.hpp).
+        std::uint32_t allocations = 0;
+        std::uint64_t alloc_bytes = 0;
+    };
+
+    // Everything recorded between two mark_frame() calls.
+    struct ProfileFrame {
+        std::uint64_t index = 0;
+        std::int64_t begin_ns = 0;
+        std::int64_t end_ns = 0;
+        // Allocations by all threads during the frame (allocation tracking builds only).
+        std::uint64_t allocations = 0;
+        std::uint64_t alloc_bytes = 0;
+        // Sorted by thread, then start time.
+        std::vector<ProfileSample> samples;
+
+        double duration_ms() const { return static_cast<double>(end_ns - begin_ns) / 1.0e6; }
+    };
+
+    // Per-scope statistics over the frame history. A scope's time in one frame is the sum of all its
+    // calls in that frame; frames in which it did not run are not counted.
+    struct ProfileScopeStats {
+        const char* name = nullptr;
+        std::uint16_t thread = 0;
+        std::uint16_t depth = 0;
+        std::size_t frames = 0;
+        std::size_t last_calls = 0;
+        double last_ms = 0.0;
+        double min_ms = 0.0;
+        double avg_ms = 0.0;
+        double p99_ms = 0.0;
+        double max_ms = 0.0;
+        // Allocations in the newest frame and per frame on average (allocation tracking builds only).
+        std::uint64_t last_allocations = 0;
+        std::uint64_t last_alloc_bytes = 0;
+        double avg_allocations = 0.0;
+    };
+
+    class Profiler {
+    public:
+        // Frames kept for statistics and the timeline (four seconds at 60 fps).
+        static constexpr std::size_t HISTORY_FRAMES = 240;
+        // Samples a thread may record between two mark_frame() calls; further samples are dropped.
+        static constexpr std::size_t THREAD_RING_CAPACITY = 4096;
+        // Lane of the thread that records first (the main thread); frame events go on its track.
+        static constexpr std::uint16_t MAIN_LANE = 0;
+
+        static Profiler& instance();
+
+        static std::int64_t now_ns() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        void set_enabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+        bool enabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+        // Label the calling thread's timeline lane ("main", "render", ...). Threads that never call
+        // this are shown as "thread N".
+        void set_thread_name(const char* name);
+
+        // Close the current frame: drain every thread's ring into a new history record. Main thread only.
+        void mark_frame();
+
+        // Oldest to newest. Main thread only (the records are rewritten by mark_frame()).
+        std::size_t frame_count() const { return _frame_count; }
+        const ProfileFrame& frame(std::size_t age) const;
+        const ProfileFrame* last_frame() const { return _frame_count ? &frame(_frame_count - 1) : nullptr; }
+
+        // Statistics for every scope seen in the history, in first-seen order. Main thread only.
+        void compute_stats(std::vector<ProfileScopeStats>& out) const;
+
+        // Lane names by ProfileSample::thread.
+        std::vector<std::string> thread_names() const;
+
+        // Samples lost because a thread's ring was full.
+        std::uint64_t dropped_samples() const;
+
+        // Trace export. Files are written on the main thread from mark_frame() or the calls below.
+        //
+        // Record frames [first_frame, first_frame + count) (ProfileFrame::index; frame 0 includes
+        // everything before the first mark_frame(), such as the first level load) and write them to
+        // 'path' once the last one is recorded. Replaces a capture still in progress.
+        void capture_frames(std::uint64_t first_frame, std::size_t count, std::filesystem::path path);
+        // Index the frame being recorded now will get.
+        std::uint64_t next_frame_index() const { return _frame_index; }
+        bool capture_active() const { return _capture_count > 0; }
+        // Keep every frame of the last 'seconds' (0 disables) so it can be saved with save_retained_trace().
+        void set_trace_retention(double seconds);
+        double trace_retention() const { return _retention_seconds; }
+        // When set, finish_traces() writes the retained frames there.
+        void set_trace_exit_path(std::filesystem::path path) { _retention_exit_path = std::move(path); }
+        bool save_retained_trace(const std::filesystem::path& path) const;
+        // Called once at shutdown: writes an unfinished frame capture and the retained trace, if configured.
+        void finish_traces();
+
+        // Used by ProfileScope.
+        void record(const char* name, std::int64_t start_ns, std::int64_t end_ns, std::uint16_t depth,
+                    std::uint64_t allocations, std::uint64_t alloc_bytes);
+
+    private:
+        // Single-producer (the owning thread) / single-consumer (mark_frame) ring.
+        struct ThreadRing {
+            std::vector<ProfileSample> samples = std::vector<ProfileSample>(THREAD_RING_CAPACITY);
+            std::atomic<std::size_t> head{0};
+            std::atomic<std::size_t> tail{0};
+            std::uint16_t index = 0;
+        };
+
+        Profiler();
+
+        ThreadRing& thread_ring();
+        // Caller holds _threads_mutex. Moves everything recorded so far into 'out'; rings of threads
+        // that have exited are released afterwards and their lanes become free.
+        void drain_rings(std::vector<ProfileSample>& out);
+        void retain_for_trace(const ProfileFrame& frame);
+        // Write and end the fixed-window capture.
+        void finish_capture();
+
+        std::atomic<bool> _enabled{true};
+
+        // Guards the lane table; a thread registers once, on its first scope.
+        mutable std::mutex _threads_mutex;
+        // Indexed by lane; null for free lanes.
+        std::vector<std::shared_ptr<ThreadRing>> _threads;
+        std::vector<std::string> _thread_names;
+        std::atomic<std::uint64_t> _dropped{0};
+
+        std::vector<ProfileFrame> _history;
+        std::size_t _history_next = 0;
+        std::size_t _frame_count = 0;
+        std::uint64_t _frame_index = 0;
+        std::int64_t _frame_begin_ns = 0;
+        std::uint64_t _frame_begin_allocations = 0;
+        std::uint64_t _frame_begin_alloc_bytes = 0;
+
+        // Fixed-window capture.
+        std::uint64_t _capture_first = 0;
+        std::size_t _capture_count = 0;
+        std::filesystem::path _capture_path;
+        std::vector<ProfileFrame> _capture_frames;
+
+        // Last-N-seconds trace ring. Sample buffers of dropped frames are recycled.
+        double _retention_seconds = 0.0;
+        std::filesystem::path _retention_exit_path;
+        std::deque<ProfileFrame> _retained;
+        std::vector<std::vector<ProfileSample>> _spare_buffers;
+    };
+
+    // RAII timer behind ZIA_PROFILE_SCOPE.
+    class ProfileScope {
+    public:
+        explicit ProfileScope(const char* name);
+        ~ProfileScope();
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* _name;
+        std::int64_t _start_ns = 0;
+        std::uint64_t _start_allocations = 0;
+        std::uint64_t _start_alloc_bytes = 0;
+        bool _active = false;
+    };
+} // namespace zia::engine
+
+#if ZIA_ENABLE_PROFILER
+#define ZIA_PROFILE_CONCAT_INNER(a, b) a##b
+#define ZIA_PROFILE_CONCAT(a, b) ZIA_PROFILE_CONCAT_INNER(a, b)
+#define ZIA_PROFILE_SCOPE(name) ::zia::engine::ProfileScope ZIA_PROFILE_CONCAT(zia_profile_scope_, __LINE__)(name)
+#else
+#define ZIA_PROFILE_SCOPE(name) ((void)0)
+#endif
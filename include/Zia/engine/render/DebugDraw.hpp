@@ -0,0 +1,51 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+#include "Zia/engine/IRenderer.hpp"
+
+// Immediate-mode debug geometry. Any system may queue lines, boxes and text markers during the
+// frame; flush() submits all queued geometry as a single line list draw call (plus the text
+// markers through the UI text batch) and clears the queue. Everything is a no-op while disabled,
+// so producers only pay for a flag check when debug drawing is off.
+namespace zia::engine::debug_draw {
+    // Independent categories that can be switched on and off from the debug UI.
+    enum Channel : std::uint32_t {
+        Bounds = 1u << 0,          // entity bounding boxes
+        QuadtreeNodes = 1u << 1,   // every node of the collision quadtree
+        BroadphaseCells = 1u << 2, // quadtree nodes holding objects, with their object count
+        ContactNormals = 1u << 3,  // entity and tile contact normals from the collision pass
+        AllChannels = Bounds | QuadtreeNodes | BroadphaseCells | ContactNormals
+    };
+
+    void set_enabled(bool enabled);
+    [[nodiscard]] bool enabled();
+
+    void set_channels(std::uint32_t mask);
+    [[nodiscard]] std::uint32_t channels();
+    // True when debug drawing is enabled and the channel is switched on.
+    [[nodiscard]] bool active(Channel channel);
+
+    // World-space primitives.
+    void line(sf::Vector2f from, sf::Vector2f to, sf::Color color);
+    void box(const sf::FloatRect& rect, sf::Color color);
+    void cross(sf::Vector2f center, float half_size, sf::Color color);
+    // Line from 'origin' along 'direction' (need not be normalised) with a small arrow head.
+    void arrow(sf::Vector2f origin, sf::Vector2f direction, float length, sf::Color color);
+    // Text label anchored at a world-space position.
+    void text(sf::Vector2f position, std::string_view label, sf::Color color);
+
+    // Number of vertices queued for the current frame.
+    [[nodiscard]] std::size_t vertex_count();
+
+    // Draw everything queued this frame and clear the queue. camera_x/camera_y must be the camera
+    // used for the world view so text markers can be placed in screen space.
+    void flush(IRenderer& renderer, float camera_x, float camera_y);
+    // Drop queued geometry without drawing it.
+    void clear();
+} // namespace zia::engine::debug_draw
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Zia/engine/IRenderer.hpp"
+
+namespace zia::engine {
+    // One recorded draw call with fully resolved parameters (positions, sizes, colours, texture).
+    struct DrawCommand {
+        enum class Type : std::uint8_t {
+            SetCamera,
+            Rect,
+            Ellipse,
+            BBox,
+            Sprite,
+            ScreenSprite,
+            Lines,
+            Text,
+            CreateText,
+            UpdateText,
+            DestroyText,
+            SubmitText,
+            FlushText,
+            SetVsync
+        };
+
+        Type type = Type::Rect;
+        // Position and size. ScreenSprite stores its scale in width/height, SetVsync its flag in x (0/1).
+        float x = 0.0f;
+        float y = 0.0f;
+        float width = 0.0f;
+        float height = 0.0f;
+        float thickness = 0.0f;
+        sf::Color color = sf::Color::White;
+        sf::IntRect texture_rect;
+        // Textures are owned by the asset manager and must outlive the frame that references them.
+        std::optional<std::reference_wrapper<const sf::Texture>> texture;
+        // Text commands: recorder-side text handle, character size and index into the string table.
+        TextHandle text = INVALID_TEXT_HANDLE;
+        unsigned int text_size = 0;
+        std::uint32_t string_index = 0;
+        // Lines commands: index into the vertex batch table.
+        std::uint32_t vertex_batch = 0;
+    };
+
+    // Append-only list of draw commands for one frame. Once handed to a consumer it is treated as
+    // immutable; clear() keeps the allocated capacity (including string buffers) for the next frame.
+    class DrawCommandList {
+    public:
+        void clear();
+
+        // Append a command; returns it so the caller can fill in the fields.
+        DrawCommand& push(DrawCommand::Type type);
+
+        // Copy a string into the list-owned string table and return its index.
+        std::uint32_t store_string(std::string_view text);
+        [[nodiscard]] std::string_view string_at(std::uint32_t index) const;
+
+        // Copy a line-list vertex batch into list-owned storage and return its index.
+        std::uint32_t store_vertices(const std::vector<sf::Vertex>& vertices);
+
+        [[nodiscard]] const std::vector<DrawCommand>& commands() const noexcept { return _commands; }
+        [[nodiscard]] std::size_t size() const noexcept { return _commands.size(); }
+        [[nodiscard]] bool empty() const noexcept { return _commands.empty(); }
+
+        // Execute every command against a real renderer. Text handles stored in the commands belong to
+        // the recorder; text_handles maps them to handles of 'target' and is updated by Create/Destroy.
+        void replay(IRenderer& target, std::vector<TextHandle>& text_handles) const;
+
+    private:
+        std::vector<DrawCommand> _commands;
+        // String storage reused across frames: only the first _string_count entries are live.
+        std::vector<std::string> _strings;
+        std::size_t _string_count = 0;
+        // Vertex batches for Lines commands, reused the same way as strings.
+        std::vector<std::vector<sf::Vertex>> _vertex_batches;
+        std::size_t _vertex_batch_count = 0;
+    };
+} // namespace zia::engine
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Zia/engine/IRenderer.hpp"
+
+namespace zia::engine {
+    class IAssetManager;
+
+    // Headless IRenderer that draws nothing. Every call is appended to a compact binary command log,
+    // per-frame statistics are gathered, and the log can later be replayed against a real renderer,
+    // in the same process or from a saved log file. Used for render-path regression checks in CI and
+    // for benchmarks without a GPU.
+    class RecordingRenderer : public IRenderer {
+    public:
+        // Counters gathered between begin_frame() and end_frame().
+        struct FrameStats {
+            std::uint32_t commands = 0;
+            // Every primitive that would reach the GPU (rects, ellipses, bboxes, sprites, texts).
+            std::uint32_t draws = 0;
+            std::uint32_t sprite_draws = 0;
+            std::uint32_t text_draws = 0;
+            // Changes of the bound texture between consecutive draws (untextured shapes count as "none").
+            std::uint32_t texture_switches = 0;
+            // setView calls the real Renderer would perform (camera moves, world <-> screen space).
+            std::uint32_t view_switches = 0;
+        };
+
+        // virtual_window_size stands in for the window size when computing viewport_size().
+        explicit RecordingRenderer(sf::Vector2u virtual_window_size = {800u, 480u});
+
+        // Frame statistics: one entry per completed frame, oldest first.
+        [[nodiscard]] const std::vector<FrameStats>& frame_stats() const noexcept { return _frames; }
+        [[nodiscard]] const FrameStats& current_frame_stats() const noexcept { return _current; }
+        [[nodiscard]] std::size_t frame_count() const noexcept { return _frames.size(); }
+
+        // Raw command log: an opcode byte followed by a packed payload (native byte order) per command.
+        [[nodiscard]] const std::vector<std::uint8_t>& log() const noexcept { return _log; }
+
+        // Save the log as a file (e.g. a CI artifact): LogFileHeader, the string table, the asset id of
+        // every texture slot as looked up in 'assets' (-1 when the texture does not belong to it), one
+        // byte range + FrameStats per completed frame, then the command log. Returns false on I/O failure.
+        bool save_log(const std::filesystem::path& path, const IAssetManager& assets) const;
+        // Replace the log, tables and statistics with a saved log. Textures are rebound by id through
+        // 'assets', so they must be loaded first; draws of textures it cannot provide are skipped on
+        // replay. Returns false, leaving the recorder cleared, when the file is unreadable or invalid.
+        bool load_log(const std::filesystem::path& path, const IAssetManager& assets);
+        // Drop the log, string/texture tables and statistics (text handles stay valid).
+        void clear();
+
+        // Replay all recorded commands, or a single completed frame, against another renderer.
+        // Textures are referenced, not copied: they must still be alive when replaying.
+        void replay(IRenderer& target) const;
+        void replay_frame(std::size_t frame, IRenderer& target) const;
+
+        // Headless loops stop when is_open() turns false.
+        void set_open(bool open) { _open = open; }
+
+        // IRenderer implementation
+        sf::RenderWindow& window() override { return _null_window; }
+        void begin_frame() override;
+        void end_frame() override;
+
+        void set_camera(float x, float y) override;
+        [[nodiscard]] sf::Vector2f viewport_size() const override;
+        void set_camera_scale(float s) override { _camera_scale = s; }
+        [[nodiscard]] float camera_scale() const override { return _camera_scale; }
+        void set_top_inset_pixels(int px) override { _top_inset_pixels = px; }
+        [[nodiscard]] int top_inset_pixels() const override { return _top_inset_pixels; }
+
+        void draw_rect(float x, float y, float width, float height, sf::Color color) override;
+        void draw_sprite(const sf::Texture& texture, float x, float y, float width, float height, const sf::IntRect& texture_rect) override;
+        void draw_sprite(int sprite_id, float x, float y) override;
+        void draw_screen_sprite(const sf::Texture& texture, float x, float y, float scale_x, float scale_y, const sf::IntRect& texture_rect) override;
+        void draw_text(const std::string& text, float x, float y, unsigned int size, sf::Color color) override;
+        void draw_ellipse(float x, float y, float width, float height, sf::Color color) override;
+        void draw_bbox(float x, float y, float width, float height, sf::Color color, float thickness) override;
+        void draw_lines(const std::vector<sf::Vertex>& vertices) override;
+
+        TextHandle create_text() override;
+        void update_text(TextHandle handle, std::string_view text, float x, float y, unsigned int size, sf::Color color) override;
+        void destroy_text(TextHandle handle) override;
+        void submit_text(TextHandle handle) override;
+        void flush_text() override;
+
+        void set_vsync(bool) override {}
+
+        void toggle_debug_bboxes() override { _debug_bboxes = !_debug_bboxes; }
+        [[nodiscard]] bool is_debug_bboxes_enabled() const override { return _debug_bboxes; }
+        [[nodiscard]] bool is_open() const override { return _open; }
+
+    private:
+        enum class Op : std::uint8_t {
+            BeginFrame,
+            EndFrame,
+            SetCamera,
+            Rect,
+            Ellipse,
+            BBox,
+            Sprite,
+            ScreenSprite,
+            Text,
+            CreateText,
+            UpdateText,
+            DestroyText,
+            SubmitText,
+            FlushText,
+            Lines
+        };
+
+        // Texture slot used for untextured draws in the texture-switch statistic.
+        static constexpr std::uint32_t NO_TEXTURE = 0xFFFFFFFFu;
+
+        // Log encoding helpers.
+        void write_op(Op op);
+        template <typename T> void write(const T& value);
+        void write_color(sf::Color color);
+        void write_rect(const sf::IntRect& rect);
+
+        // Intern a texture / string into the side tables and return its index.
+        std::uint32_t texture_slot(const sf::Texture& texture);
+        std::uint32_t string_slot(std::string_view text);
+
+        // Statistics helpers mirroring the real Renderer's state changes.
+        void note_draw(std::uint32_t texture);
+        void note_world_space();
+        void note_screen_space();
+
+        // Decode and execute the commands in [begin, end) of the log.
+        void replay_range(std::size_t begin, std::size_t end, IRenderer& target) const;
+        // Check a loaded log: known opcodes, payloads inside the log, slots inside the side tables and
+        // frame ranges on command boundaries.
+        [[nodiscard]] bool validate_log() const;
+
+        sf::RenderWindow _null_window; // never opened; only satisfies window()
+        sf::Vector2u _virtual_window_size;
+        float _camera_scale = 1.0f;
+        float _camera_tiles_w = 50.0f;
+        int _top_inset_pixels = 0;
+        bool _debug_bboxes = false;
+        bool _open = true;
+
+        std::vector<std::uint8_t> _log;
+        // Byte offsets of each completed frame's BeginFrame and EndFrame (inclusive) records.
+        std::vector<std::pair<std::size_t, std::size_t>> _frame_ranges;
+        std::size_t _frame_begin = 0;
+
+        // Side tables referenced from the log. Recorded textures are identity only (not owned); slots of
+        // a loaded log hold the textures provided by the asset manager (null when it had none).
+        std::vector<const sf::Texture*> _textures;
+        std::unordered_map<const sf::Texture*, std::uint32_t> _texture_slots;
+        std::vector<std::shared_ptr<const sf::Texture>> _loaded_textures;
+        std::vector<std::string> _strings;
+        std::unordered_map<std::string, std::uint32_t> _string_slots;
+
+        // Retained text handles issued by this recorder (index = handle, slot 0 unused).
+        std::vector<bool> _text_alive;
+        std::vector<TextHandle> _free_texts;
+
+        // Statistics state.
+        std::vector<FrameStats> _frames;
+        FrameStats _current;
+        std::uint32_t _bound_texture = NO_TEXTURE;
+        bool _screen_space = false;
+    };
+} // namespace zia::engine
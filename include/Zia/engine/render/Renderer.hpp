@@ -2,15 +2,24 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "Zia/game/helpers/Constants.hpp"
 #include "Zia/engine/IRenderer.hpp" // Implement the engine renderer interface
+#include "Zia/engine/resources/AssetArchive.hpp"
 
 namespace zia {
     // Draw calls, sprites, layers, parallax
     // Make Renderer implement the engine-level IRenderer to remove the need for a separate adapter.
     class Renderer : public zia::engine::IRenderer {
     public:
-        Renderer();
+        // When an asset archive is given, the UI font is read from it (the renderer keeps the archive
+        // alive, since SFML streams font data from the mapping); otherwise it is loaded from disk.
+        explicit Renderer(std::shared_ptr<const zia::engine::AssetArchive> archive = nullptr);
 
         // IRenderer implementation
         // Called at the start of a frame to prepare drawing (clear, set view etc.).
@@ -32,10 +41,21 @@ namespace zia {
 
         void draw_sprite(int sprite_id, float x, float y) override;
 
+        void draw_screen_sprite(const sf::Texture& texture, float x, float y, float scale_x, float scale_y, const sf::IntRect& texture_rect) override;
+
         void draw_rect(float x, float y, float width, float height, sf::Color color) override;
 
+        // Immediate-mode text: reuses one retained text object per call slot and frame, so repeated
+        // identical calls every frame do not rebuild glyph geometry.
         void draw_text(const std::string& text, float x, float y, unsigned int size, sf::Color color) override;
 
+        // Retained text objects (see IRenderer).
+        zia::engine::TextHandle create_text() override;
+        void update_text(zia::engine::TextHandle handle, std::string_view text, float x, float y, unsigned int size, sf::Color color) override;
+        void destroy_text(zia::engine::TextHandle handle) override;
+        void submit_text(zia::engine::TextHandle handle) override;
+        void flush_text() override;
+
         // Access the underlying render window for event polling and ImGui integration.
         sf::RenderWindow& window() override { return _window; }
 
@@ -43,6 +63,8 @@ namespace zia {
 
         bool is_open() const override;
 
+        void set_vsync(bool enabled) override;
+
         // Camera scale controls zoom: multiply world viewport by this factor. Default is TILE_SCALE.
         // set_camera_scale / camera_scale already declared as overrides above.
 
@@ -55,13 +77,47 @@ namespace zia {
         // color: outline color. thickness: outline thickness in pixels.
         void draw_bbox(float x, float y, float width, float height, sf::Color color, float thickness) override;
 
+        // Draw a world-space line list with one draw call (used by the batched debug draw).
+        void draw_lines(const std::vector<sf::Vertex>& vertices) override;
+
         // Toggle and query debug bounding boxes rendering.
         void toggle_debug_bboxes() override;
         bool is_debug_bboxes_enabled() const override;
 
     private:
+        // Retained text object: the sf::Text caches its glyph vertices; the cached string/size/colour
+        // let update_text() skip all setters when nothing changed.
+        struct TextObject {
+            std::optional<sf::Text> text;
+            std::string string;
+            unsigned int size = 0;
+            sf::Color color = sf::Color::White;
+            bool alive = false;
+        };
+
+        // Lazily switch between the camera (world) view and the screen view so consecutive draws in the
+        // same space share one setView call.
+        void use_world_view();
+        void use_screen_view();
+
+        // Resolve a handle to its text object, or std::nullopt when the handle is invalid or destroyed.
+        std::optional<std::reference_wrapper<TextObject>> find_text(zia::engine::TextHandle handle);
+
+        // Declared first so it outlives _font, which reads from the archive mapping.
+        std::shared_ptr<const zia::engine::AssetArchive> _archive;
         sf::RenderWindow _window;
         sf::Font _font;
+        // Last camera view set by set_camera(); restored when world drawing resumes after screen draws.
+        sf::View _world_view;
+        bool _screen_view_active = false;
+        // Retained text storage: handle = index + 1. Destroyed slots are recycled through _free_texts.
+        std::vector<TextObject> _texts;
+        std::vector<zia::engine::TextHandle> _free_texts;
+        // Texts queued for the current frame's UI batch.
+        std::vector<zia::engine::TextHandle> _text_queue;
+        // Slots backing immediate-mode draw_text() calls, reused by call order each frame.
+        std::vector<zia::engine::TextHandle> _immediate_texts;
+        std::size_t _immediate_text_count = 0;
         int _top_inset_pixels = 0;
         sf::Color _clear_color = sf::Color(30, 30, 36);
         float _camera_x = 0.0f;
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Zia/engine/IRenderer.hpp"
+#include "Zia/engine/render/DrawCommandList.hpp"
+
+namespace zia::engine {
+    // IRenderer decorator that records draw calls into one of two command lists and replays them on a
+    // dedicated render thread owning the window's OpenGL context. end_frame() hands the recorded list
+    // over and returns immediately, so the caller can simulate the next frame while this one is drawn.
+    //
+    // Threading contract:
+    // - All IRenderer calls are made from the simulation (main) thread.
+    // - wait_idle() must be called before anything else touches the window's GL state or ImGui
+    //   (the application does this before the UI phase of each frame).
+    // - Textures referenced by recorded sprites must stay alive until the frame has been presented.
+    class ThreadedRenderer : public IRenderer {
+    public:
+        explicit ThreadedRenderer(std::shared_ptr<IRenderer> target);
+        ~ThreadedRenderer() override;
+
+        ThreadedRenderer(const ThreadedRenderer&) = delete;
+        ThreadedRenderer& operator=(const ThreadedRenderer&) = delete;
+
+        // Start/stop the render thread. start() releases the window context from the calling thread;
+        // stop() waits for the last frame, joins the thread and re-activates the context on the caller.
+        void start();
+        void stop();
+        [[nodiscard]] bool running() const noexcept { return _thread.joinable(); }
+
+        // Block until the render thread has finished presenting every submitted frame.
+        void wait_idle();
+
+        // Called on the render thread after the frame's commands and before display() (ImGui rendering).
+        void set_before_present(std::function<void(sf::RenderWindow&)> cb) { _before_present = std::move(cb); }
+
+        // Concrete renderer the commands are replayed on.
+        [[nodiscard]] IRenderer& target() { return *_target; }
+
+        // IRenderer: window/state queries are forwarded, draw calls are recorded.
+        sf::RenderWindow& window() override { return _target->window(); }
+        void begin_frame() override;
+        void end_frame() override;
+
+        void set_camera(float x, float y) override;
+        [[nodiscard]] sf::Vector2f viewport_size() const override { return _target->viewport_size(); }
+        void set_camera_scale(float s) override { _target->set_camera_scale(s); }
+        [[nodiscard]] float camera_scale() const override { return _target->camera_scale(); }
+        void set_top_inset_pixels(int px) override { _target->set_top_inset_pixels(px); }
+        [[nodiscard]] int top_inset_pixels() const override { return _target->top_inset_pixels(); }
+
+        void draw_rect(float x, float y, float width, float height, sf::Color color) override;
+        void draw_sprite(const sf::Texture& texture, float x, float y, float width, float height, const sf::IntRect& texture_rect) override;
+        void draw_sprite(int sprite_id, float x, float y) override { _target->draw_sprite(sprite_id, x, y); }
+        void draw_screen_sprite(const sf::Texture& texture, float x, float y, float scale_x, float scale_y, const sf::IntRect& texture_rect) override;
+        void draw_text(const std::string& text, float x, float y, unsigned int size, sf::Color color) override;
+        void draw_ellipse(float x, float y, float width, float height, sf::Color color) override;
+        void draw_bbox(float x, float y, float width, float height, sf::Color color, float thickness) override;
+        void draw_lines(const std::vector<sf::Vertex>& vertices) override;
+
+        TextHandle create_text() override;
+        void update_text(TextHandle handle, std::string_view text, float x, float y, unsigned int size, sf::Color color) override;
+        void destroy_text(TextHandle handle) override;
+        void submit_text(TextHandle handle) override;
+        void flush_text() override;
+
+        // Recorded: it activates the window's GL context, which belongs to the render thread.
+        void set_vsync(bool enabled) override;
+
+        void toggle_debug_bboxes() override { _target->toggle_debug_bboxes(); }
+        [[nodiscard]] bool is_debug_bboxes_enabled() const override { return _target->is_debug_bboxes_enabled(); }
+        [[nodiscard]] bool is_open() const override { return _target->is_open(); }
+
+    private:
+        // Last values sent for a text handle, so unchanged texts record no update command.
+        struct TextState {
+            std::string string;
+            float x = 0.0f;
+            float y = 0.0f;
+            unsigned int size = 0;
+            sf::Color color = sf::Color::White;
+            bool alive = false;
+        };
+
+        void render_loop();
+
+        std::shared_ptr<IRenderer> _target;
+        std::function<void(sf::RenderWindow&)> _before_present;
+
+        // Double buffer: the simulation thread records into _lists[_record_index] while the render
+        // thread replays the other list.
+        std::array<DrawCommandList, 2> _lists;
+        std::size_t _record_index = 0;
+
+        // Recorder-side text handles (index = handle) and the render-thread mapping to target handles.
+        std::vector<TextState> _texts;
+        std::vector<TextHandle> _free_texts;
+        std::vector<TextHandle> _target_texts;
+
+        // Hand-off state guarded by _mutex.
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        bool _frame_pending = false;
+        bool _busy = false;
+        bool _stop = false;
+        std::size_t _replay_index = 0;
+    };
+} // namespace zia::engine
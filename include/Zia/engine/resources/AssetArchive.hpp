@@ -0,0 +1,104 @@
+#pragma once
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Zia/engine/resources/MappedFile.hpp"
+
+namespace zia::engine {
+    // .zpak layout (little-endian, written by tools/asset_packer):
+    //   ArchiveHeader | file blobs (16-byte aligned) | ArchiveEntry[entry_count] sorted by path_hash
+    inline constexpr std::uint32_t ARCHIVE_MAGIC = 0x4B41505Au; // "ZPAK"
+    inline constexpr std::uint32_t ARCHIVE_VERSION = 1;
+    // Blob holds raw RGBA8 pixels (width * height * 4 bytes) instead of the encoded file.
+    inline constexpr std::uint32_t ARCHIVE_FLAG_PREDECODED_RGBA = 1u << 0;
+
+    struct ArchiveHeader {
+        std::uint32_t magic = ARCHIVE_MAGIC;
+        std::uint32_t version = ARCHIVE_VERSION;
+        std::uint32_t entry_count = 0;
+        std::uint32_t reserved = 0;
+        std::uint64_t toc_offset = 0;
+    };
+
+    struct ArchiveEntry {
+        std::uint64_t path_hash = 0;
+        std::uint64_t offset = 0;
+        std::uint64_t size = 0;
+        std::uint32_t flags = 0;
+        // Image size for pre-decoded entries, 0 otherwise.
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::uint32_t reserved = 0;
+    };
+
+    // 64-bit FNV-1a, used for archive path hashes.
+    constexpr std::uint64_t fnv1a64(std::string_view text) {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char c : text) {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    // Canonical archive key for an asset path: forward slashes, no leading "./".
+    std::string normalize_asset_path(std::string_view path);
+    inline std::uint64_t asset_path_hash(std::string_view path) { return fnv1a64(normalize_asset_path(path)); }
+
+    // Read-only view of a packed asset archive. The archive is memory-mapped once; lookups are a binary
+    // search over the table of contents and loads read straight from the mapping. Lookups and loads are
+    // safe to call from several threads once open() has returned.
+    class AssetArchive {
+    public:
+        // Non-owning view of one packed file; valid while the archive stays open.
+        struct Blob {
+            const std::uint8_t* data = nullptr;
+            std::size_t size = 0;
+            bool predecoded = false;
+            sf::Vector2u image_size;
+        };
+
+        bool open(const std::filesystem::path& path);
+        [[nodiscard]] bool is_open() const noexcept { return _file.is_open(); }
+        [[nodiscard]] std::size_t entry_count() const noexcept { return _entries.size(); }
+
+        // Path, size and modification time of the archive as it was mapped by open(); together they
+        // identify the packed contents (TextureCache keys decoded archive entries on them).
+        [[nodiscard]] const std::filesystem::path& path() const noexcept { return _path; }
+        [[nodiscard]] std::uint64_t size_bytes() const noexcept { return _file.size(); }
+        [[nodiscard]] std::int64_t write_time() const noexcept { return _write_time; }
+
+        [[nodiscard]] std::optional<Blob> find(std::string_view path) const;
+        [[nodiscard]] bool contains(std::string_view path) const { return find(path).has_value(); }
+
+        // Load helpers handling both encoded and pre-decoded entries. Return false when the path is
+        // not in the archive or the data cannot be decoded.
+        bool load_image(std::string_view path, sf::Image& image) const;
+        bool load_texture(std::string_view path, sf::Texture& texture) const;
+        // The font keeps reading from the mapping, so the archive must outlive it.
+        bool open_font(std::string_view path, sf::Font& font) const;
+
+    private:
+        MappedFile _file;
+        std::vector<ArchiveEntry> _entries;
+        std::filesystem::path _path;
+        std::int64_t _write_time = 0;
+    };
+
+    // Open the game's archive: $ZIA_ASSET_ARCHIVE when set, otherwise "assets.zpak" in the working
+    // directory (where the build places it). Returns null when there is no usable archive, in which
+    // case assets are read from loose files.
+    std::shared_ptr<const AssetArchive> open_default_asset_archive();
+} // namespace zia::engine
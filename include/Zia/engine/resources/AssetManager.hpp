@@ -2,25 +2,53 @@
 
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
 #include <mutex>
-#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Zia/engine/IAssetManager.hpp"
+
+namespace zia::engine {
+    class AssetArchive;
+    class TextureCache;
+}
 
 namespace zia {
 
     // Textures, audio, fonts, caching
     class AssetManager {
     public:
+        AssetManager() = default;
+        // Stops and joins the decode workers.
+        ~AssetManager();
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        // Read assets from a packed archive first, falling back to loose files for paths it does not
+        // contain. Call before the first load or request (the decode workers read it without locking).
+        void set_archive(std::shared_ptr<const engine::AssetArchive> archive) { _archive = std::move(archive); }
+        // Decode image files, loose or archived, through an on-disk RGBA cache. Same threading rule as set_archive.
+        void set_texture_cache(std::shared_ptr<const engine::TextureCache> cache) { _texture_cache = std::move(cache); }
+
         bool load_texture(int id, std::string_view path);
 
         std::shared_ptr<sf::Texture> get_mutable_texture(int id);
         std::shared_ptr<const sf::Texture> get_texture(int id) const;
 
         bool has_texture(int id) const;
+        // Reverse lookup over the loaded textures (linear; meant for tooling, not per-frame use).
+        int find_texture_id(const sf::Texture& texture) const;
 
         void load_sound(int id, std::string_view path);
 
@@ -30,17 +58,120 @@ namespace zia {
 
         void unload_all();
 
+        // Queue 'path' for asynchronous decoding into texture 'id'. Requesting an id that is already
+        // loaded from the same path returns Ready; a different path replaces it once decoded. Re-requesting
+        // a queued texture with a higher priority moves it up the queue.
+        engine::TextureHandle request_texture(int id, std::string_view path, engine::AssetPriority priority);
+        engine::AssetStatus texture_status(int id) const;
+        void set_upload_budget(std::size_t bytes_per_frame) { _upload_budget = bytes_per_frame; }
+        // Run 'job' on the decode workers, ordered with the decodes by priority.
+        void submit_job(engine::AssetPriority priority, std::function<void()> job);
+
+        // Reference counting: a retained texture is never evicted. Unretained textures stay cached until
+        // the memory budget is exceeded, then the least recently used ones are dropped and reloaded from
+        // their source path the next time they are drawn.
+        void retain_texture(int id);
+        void release_texture(int id);
+        // Texture memory budget in bytes (RGBA8 size of the resident textures); 0 disables eviction.
+        void set_memory_budget(std::size_t bytes) { _memory_budget = bytes; }
+        [[nodiscard]] std::size_t texture_memory_usage() const { return _texture_bytes; }
+
         // Push an already-decoded image from background thread. Main thread must call finalize_decoded_images to create textures.
         void push_decoded_image(int id, sf::Image &&image);
 
-        // Finalize any decoded images by creating sf::Texture objects on the main thread.
+        // Per-frame asset maintenance on the main thread: advance the LRU frame counter, re-request
+        // evicted textures that were used again, create sf::Texture objects from decoded images
+        // (highest priority first, until the upload budget is spent) and evict down to the memory budget.
         void finalize_decoded_images();
 
     private:
-        std::unordered_map<int, std::shared_ptr<sf::Texture>> _textures;
+        // Default per-frame upload budget: one 1024x1024 RGBA texture.
+        static constexpr std::size_t DEFAULT_UPLOAD_BUDGET = 4u * 1024u * 1024u;
+        static constexpr unsigned MAX_DECODE_WORKERS = 4;
+        // Default texture memory budget.
+        static constexpr std::size_t DEFAULT_MEMORY_BUDGET = 256u * 1024u * 1024u;
+        // Textures used within this many frames are never evicted (the render thread may still draw them).
+        static constexpr std::uint64_t EVICTION_GRACE_FRAMES = 2;
+
+        struct TextureEntry {
+            std::shared_ptr<sf::Texture> texture;
+            // Source file used to reload the texture after eviction; empty for pushed images.
+            std::string path;
+            std::size_t bytes = 0;
+            // Frame of the last get_texture() lookup (updated from const lookups).
+            mutable std::uint64_t last_use_frame = 0;
+        };
+
+        struct StreamRequest {
+            std::string path;
+            engine::AssetPriority priority = engine::AssetPriority::Normal;
+            engine::AssetStatus status = engine::AssetStatus::Queued;
+            std::uint32_t generation = 0;
+        };
+
+        // A file waiting for a decode worker, or a submitted job ('task' set, no request).
+        struct DecodeJob {
+            engine::AssetPriority priority = engine::AssetPriority::Normal;
+            std::uint64_t sequence = 0;
+            int id = 0;
+            std::uint32_t generation = 0;
+            std::string path;
+            std::function<void()> task;
+        };
+
+        // A decoded image waiting for upload. Generation 0 marks images pushed through
+        // push_decoded_image(), which are not tied to a streaming request.
+        struct DecodedImage {
+            engine::AssetPriority priority = engine::AssetPriority::Normal;
+            std::uint64_t sequence = 0;
+            int id = 0;
+            std::uint32_t generation = 0;
+            bool ok = false;
+            sf::Image image;
+        };
+
+        // Heap ordering shared by both queues: higher priority first, then first come first served.
+        template <typename T>
+        static bool lower_priority(const T& a, const T& b) {
+            if (a.priority != b.priority) return a.priority < b.priority;
+            return a.sequence > b.sequence;
+        }
+
+        void start_workers();
+        void worker_loop();
+        const std::shared_ptr<sf::Texture>& placeholder();
+        void store_texture(int id, std::shared_ptr<sf::Texture> texture, std::string path);
+        std::shared_ptr<sf::Texture> missing_texture(int id) const;
+        void evict_to_budget();
+
+        // Declared first so fonts streaming from the archive mapping are destroyed before it.
+        std::shared_ptr<const engine::AssetArchive> _archive;
+        std::shared_ptr<const engine::TextureCache> _texture_cache;
+        std::unordered_map<int, TextureEntry> _textures;
+        std::unordered_map<int, int> _texture_refs;
+        // Evicted ids and their source paths; a lookup queues them for reload.
+        std::unordered_map<int, std::string> _evicted;
+        mutable std::vector<int> _reload_queue;
+        std::uint64_t _frame = 0;
+        std::size_t _texture_bytes = 0;
+        std::size_t _memory_budget = DEFAULT_MEMORY_BUDGET;
         std::unordered_map<int, std::shared_ptr<sf::Font>> _fonts;
-        // Queue of decoded images waiting to be converted to textures on the main thread.
-        std::mutex _pending_mutex;
-        std::queue<std::pair<int, sf::Image>> _pending_images;
+
+        // Streaming state shared with the decode workers.
+        mutable std::mutex _stream_mutex;
+        std::condition_variable _jobs_cv;
+        std::unordered_map<int, StreamRequest> _requests;
+        std::vector<DecodeJob> _jobs;        // max-heap (see lower_priority)
+        std::vector<DecodedImage> _decoded;  // max-heap (see lower_priority)
+        std::uint64_t _next_sequence = 0;
+        std::uint32_t _next_generation = 1;
+        bool _stop = false;
+        std::vector<std::thread> _workers;
+
+        // Main-thread view of ids waiting for their first upload; get_texture() returns the
+        // placeholder for them without touching the stream mutex.
+        std::unordered_set<int> _streaming;
+        std::shared_ptr<sf::Texture> _placeholder;
+        std::size_t _upload_budget = DEFAULT_UPLOAD_BUDGET;
     };
 };
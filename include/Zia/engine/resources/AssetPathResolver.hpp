@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace zia::engine {
+    // Maps asset paths such as "assets/levels/level1.json" to files on disk.
+    //
+    // The resolver is configured with an ordered list of search roots. The "assets" directory of every
+    // root is walked once and each file is indexed by its root-relative path, so a lookup is a single
+    // hash-map probe instead of a series of filesystem checks; when two roots hold the same file the
+    // earlier root wins. Paths that are not in the index (absolute paths, files created after the walk)
+    // fall back to one probe per root.
+    //
+    // resolve() may be called from any thread (the asset workers do); set_roots() rebuilds the index.
+    class AssetPathResolver {
+    public:
+        // Replace the search roots and rebuild the index.
+        void set_roots(std::vector<std::filesystem::path> roots);
+
+        std::vector<std::filesystem::path> roots() const;
+
+        // File 'path' refers to, or std::nullopt when no root holds it. Indexes the default roots on
+        // first use when set_roots() was never called.
+        std::optional<std::filesystem::path> resolve(std::string_view path) const;
+
+        // Number of indexed files.
+        std::size_t indexed_count() const;
+
+        // Roots listed in ZIA_ASSET_ROOTS (separated by ':', or ';' on Windows), followed by the working
+        // directory and up to three of its parents, so the game runs from the build tree or an IDE
+        // output folder alike.
+        static std::vector<std::filesystem::path> default_roots();
+
+    private:
+        // Caller holds the unique lock.
+        void build_index(std::vector<std::filesystem::path> roots) const;
+
+        mutable std::shared_mutex _mutex;
+        mutable bool _configured = false;
+        mutable std::vector<std::filesystem::path> _roots;
+        mutable std::unordered_map<std::string, std::filesystem::path> _index;
+    };
+
+    // Process-wide resolver used by the asset manager, the renderer and the level loaders. main()
+    // configures it from --asset-root before the application is created.
+    AssetPathResolver& asset_path_resolver();
+} // namespace zia::engine
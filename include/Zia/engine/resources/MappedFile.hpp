@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace zia::engine {
+    // Read-only memory mapping of a whole file (mmap on POSIX, MapViewOfFile on Windows).
+    // Move-only; the mapping is released by the destructor or close().
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        // Map 'path' into memory. Returns false (and leaves the object closed) on failure.
+        bool open(const std::filesystem::path& path);
+        void close();
+
+        [[nodiscard]] bool is_open() const noexcept { return _data != nullptr; }
+        // Start of the mapped bytes; valid until close(). Non-owning.
+        [[nodiscard]] const std::uint8_t* data() const noexcept { return static_cast<const std::uint8_t*>(_data); }
+        [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+    private:
+        void* _data = nullptr;
+        std::size_t _size = 0;
+#ifdef _WIN32
+        // File mapping object handle (HANDLE), kept to close it with the view.
+        void* _mapping = nullptr;
+#endif
+    };
+} // namespace zia::engine
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+namespace zia::engine {
+    class AssetArchive;
+
+    // On-disk cache of decoded textures. Each source image gets one blob of raw RGBA8 texels named
+    // after the hash of its canonical path; the blob header records the source's size and modification
+    // time, so an edited file is a cache miss and its blob is rewritten on the next decode. Blobs are
+    // memory-mapped on load, skipping PNG decompression entirely.
+    //
+    // Encoded entries of an AssetArchive are cached the same way, keyed by the archive's canonical path
+    // plus the entry name and validated against the archive's size and modification time, so repacking
+    // the archive invalidates all of its blobs. Pre-decoded entries are already raw texels: they are read
+    // straight from the archive and never stored.
+    //
+    // Const member functions may be called concurrently (writes go through a temporary file + rename).
+    class TextureCache {
+    public:
+        explicit TextureCache(std::filesystem::path directory = default_directory());
+
+        // ".zia_cache/textures" under the working directory.
+        static std::filesystem::path default_directory();
+
+        [[nodiscard]] const std::filesystem::path& directory() const noexcept { return _directory; }
+
+        // Fill 'image' / 'texture' from a current cache entry for 'source'. False on a miss.
+        bool load_image(const std::filesystem::path& source, sf::Image& image) const;
+        bool load_texture(const std::filesystem::path& source, sf::Texture& texture) const;
+
+        // Write the decoded pixels of 'source' into the cache.
+        bool store(const std::filesystem::path& source, const sf::Image& image) const;
+
+        enum class DecodeResult { Failed, Hit, Miss };
+        // Decode 'source' through the cache: a hit reads the blob, a miss decodes the file and stores it.
+        DecodeResult decode(const std::filesystem::path& source, sf::Image& image) const;
+
+        // Same for the entry 'path' of 'archive'. Loads return false (decode: Failed) when the entry is
+        // not in the archive; a pre-decoded entry always counts as a hit.
+        bool load_image(const AssetArchive& archive, std::string_view path, sf::Image& image) const;
+        bool load_texture(const AssetArchive& archive, std::string_view path, sf::Texture& texture) const;
+        bool store(const AssetArchive& archive, std::string_view path, const sf::Image& image) const;
+        DecodeResult decode(const AssetArchive& archive, std::string_view path, sf::Image& image) const;
+
+        // Delete every blob; returns the number of files removed.
+        std::size_t clear() const;
+
+    private:
+        std::filesystem::path _directory;
+    };
+
+    // The game's cache: $ZIA_TEXTURE_CACHE names the directory when set, "0" disables caching (null).
+    std::shared_ptr<const TextureCache> open_default_texture_cache();
+} // namespace zia::engine
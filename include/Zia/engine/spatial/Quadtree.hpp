@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <vector>
 #include <SFML/Graphics/Rect.hpp>
 #include "Zia/engine/spatial/QuadTile.h"
@@ -7,6 +9,8 @@
 namespace zia::engine::spatial {
 
 // Quadtree: spatial index for broadphase collision / queries.
+// clear() and reset() keep every node's storage, so a tree rebuilt each frame (see CollisionSystem and
+// SpriteRenderSystem) stops allocating once it has reached its working size.
 class Quadtree {
 private:
     static constexpr int MAX_OBJECTS = 10;
@@ -14,7 +18,9 @@ private:
     int _level{};
     std::vector<QuadTile> _quadTiles;
     sf::FloatRect _bounds;
+    // Child nodes stay allocated after a clear(); only '_split' says whether they are in use.
     std::vector<Quadtree> _nodes;
+    bool _split = false;
 
 public:
     // Construct a quadtree node at a level with bounds.
@@ -23,10 +29,19 @@ public:
     [[nodiscard]] sf::FloatRect getBounds() const { return _bounds; }
     [[nodiscard]] int getIndex(const sf::FloatRect& rect) const;
 
+    // Remove every tile, keeping the node storage.
     void clear();
+    // clear() and move the tree to new bounds.
+    void reset(const sf::FloatRect& bounds);
     void split();
     void insert(const QuadTile& tile);
-    std::vector<QuadTile> retrieve(std::vector<QuadTile>& returnObjects, const sf::FloatRect& rect) const;
+    // Append the tiles that may overlap 'rect' to 'returnObjects'.
+    void retrieve(std::vector<QuadTile>& returnObjects, const sf::FloatRect& rect) const;
+    // Range query: append every stored tile whose bounds overlap 'area', descending into all
+    // overlapping child nodes (retrieve() only follows the single quadrant fully containing a rect).
+    void query(const sf::FloatRect& area, std::vector<QuadTile>& out) const;
+    // Depth-first walk over every node: visitor(bounds, level, number of tiles stored in the node).
+    void visit(const std::function<void(const sf::FloatRect&, int, std::size_t)>& visitor) const;
     void print(int level = 0) const;
 };
 
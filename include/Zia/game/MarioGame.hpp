@@ -13,14 +13,21 @@
 #include "Zia/engine/IAssetManager.hpp"
 #include "Zia/engine/IEntityManager.hpp"
 
+#include <cstdint>
+#include <filesystem>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <SFML/System/Clock.hpp>
 
 namespace zia {
     // forward
-    namespace engine { class EngineConfig; }
+    namespace engine {
+        class EngineConfig;
+        class InputRecorder;
+        class InputReplay;
+    }
 
     // Core application harness that owns the loop, managers, and active scene stack.
     // This Game class is now a thin wrapper that forwards to an engine::Application instance.
@@ -63,6 +70,20 @@ namespace zia {
         // Expose UI manager for querying menu height and other UI-related helpers
         zia::engine::UIManager& ui() { return _app->ui(); }
 
+        // Main loop pacing (rate and missed-frame statistics); the rate follows settings()->target_fps().
+        zia::engine::FramePacer& frame_pacer() { return _app->frame_pacer(); }
+
+        // Deterministic runs: both skip the menu, seed the spawner, stream chunks deterministically and
+        // use a fixed 1/60 s timestep, with the frame rate capped to match it.
+        // record_input plays 'level_path' with live input and writes the recording on shutdown();
+        // replay_input plays a recording back and reports on shutdown() whether the final world state
+        // matched. Call before run().
+        void record_input(const std::filesystem::path &path, std::string level_path);
+        bool replay_input(const std::filesystem::path &path);
+
+        // Hash of the simulated world (entity positions and velocities), used to compare runs.
+        [[nodiscard]] std::uint64_t world_state_hash() const;
+
     protected:
         // Hook for derived classes to prepare an initial scene before the loop begins.
         virtual void before_loop();
@@ -77,5 +98,11 @@ namespace zia {
 
         // UI state shared by overlay (e.g. whether settings window is open)
         bool _menu_show_settings = false;
+
+        // Level pushed instead of the menu by before_loop (set by record_input / replay_input).
+        std::string _start_level;
+        std::filesystem::path _recording_path;
+        std::shared_ptr<engine::InputRecorder> _recorder;
+        std::shared_ptr<engine::InputReplay> _replay;
     };
 } // namespace Zia
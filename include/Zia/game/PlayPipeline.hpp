@@ -0,0 +1,169 @@
+#pragma once
+
+#include "Zia/game/systems/PhysicsSystem.hpp"
+#include "Zia/game/systems/PlayerControllerSystem.hpp"
+#include "Zia/game/systems/EnemySystem.hpp"
+#include "Zia/game/systems/AnimationSystem.hpp"
+#include "Zia/game/systems/BackgroundSystem.hpp"
+#include "Zia/game/systems/CloudSystem.hpp"
+#include "Zia/game/systems/SpriteRenderSystem.hpp"
+#include "Zia/game/systems/CameraSystem.hpp"
+#include "Zia/game/systems/DebugDrawSystem.hpp"
+#include "Zia/game/world/Level.hpp"
+#include "Zia/game/world/WorldSnapshot.hpp"
+#include "Zia/game/ui/HUD.hpp"
+#include "Zia/engine/IAssetManager.hpp"
+#include "Zia/engine/IEntityManager.hpp"
+#include "Zia/engine/IInput.hpp"
+#include "Zia/engine/IRenderer.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace zia {
+    class Camera;
+
+    // The gameplay of a running level, independent of the window and UI: loads levels and spawns
+    // their entities, runs the ordered update and render system pipelines, prefetches the next level
+    // and restarts levels from a snapshot. PlayScene drives it from the game loop; the benchmarks drive
+    // the same pipeline headlessly.
+    class PlayPipeline {
+    public:
+        PlayPipeline(zia::engine::IEntityManager &registry, zia::engine::IRenderer &renderer,
+                     zia::engine::IAssetManager &assets, zia::engine::IInput &input, std::string level_path);
+        ~PlayPipeline();
+
+        PlayPipeline(const PlayPipeline&) = delete;
+        PlayPipeline& operator=(const PlayPipeline&) = delete;
+
+        // Load the current level synchronously, spawn its entities, build the system pipelines and
+        // start prefetching the level that follows it.
+        void enter();
+        // Drop the level, its entities and any prefetched level.
+        void exit();
+
+        // Simulate one frame: update systems, camera, chunk streaming, prefetch and level transitions.
+        void update(float dt);
+        // Draw the world and the HUD with the level camera (between the renderer's begin/end_frame).
+        void render();
+
+        void capture_snapshot(WorldSnapshot &snapshot) const;
+        // Restore 'snapshot', first reloading its level when another level (or the same level in the
+        // other background slot) is running.
+        bool restore_snapshot(const WorldSnapshot &snapshot);
+
+        // Screen pixels reserved at the top of the window (menu bar); the camera and HUD stay below it.
+        void set_top_inset(int pixels) { _top_inset = pixels; }
+
+        [[nodiscard]] const std::string& level_path() const noexcept { return _current_level_path; }
+        [[nodiscard]] EntityID player_id() const noexcept { return _player_id; }
+        [[nodiscard]] const Level& level() const noexcept { return _level; }
+        [[nodiscard]] const SpriteRenderSystem& sprite_render_system() const noexcept { return _sprite_render_system; }
+        // Level transitions handled since construction (restarts and advances to the next level).
+        [[nodiscard]] std::uint64_t transitions() const noexcept { return _transitions; }
+
+    private:
+        // A level parsed and populated ahead of time, ready to replace the running one.
+        struct PreparedLevel {
+            std::string path;
+            Level level;
+            // Standalone registry holding the level's entities until the switch.
+            std::shared_ptr<zia::EntityManager> entities;
+            EntityID player_id = 0;
+            int background_slot = 0;
+            std::vector<int> retained_textures;
+        };
+
+        // Stream the level's textures (retaining them into 'retained') and create its background,
+        // cloud and player entities in 'registry', then prime the chunks around the player.
+        // Returns the player entity.
+        EntityID populate_level(Level &level, const std::string &level_path, int background_slot,
+                                zia::engine::IEntityManager &registry, std::vector<int> &retained);
+
+        // Camera setup and pipeline build shared by enter and prepared-level switches.
+        void start_level();
+
+        // Parse the next level on a worker thread while the current one is played. The level is loaded
+        // into 'recycled' (a level that was just left), so its storage and arena are reused.
+        void start_prefetch(Level recycled = Level());
+        // Once the worker has finished, populate its level into a standalone registry (main thread).
+        void poll_prefetch();
+        // Wait for any running prefetch and drop the prepared level, releasing its textures.
+        void cancel_prefetch();
+        // Replace the running level with the prepared one: a registry swap and a Level move. The
+        // outgoing level is unloaded and handed to the next prefetch.
+        void switch_to_prepared_level();
+
+        void handle_level_transitions();
+
+        // World-space viewport height left below the top inset.
+        float view_height() const;
+
+        void setup_systems();
+
+        void run_update_systems(float dt);
+
+        void run_render_systems(const Camera &camera);
+
+        zia::engine::IEntityManager &_registry;
+        zia::engine::IRenderer &_renderer;
+        zia::engine::IAssetManager &_assets;
+        zia::engine::IInput &_input;
+
+        EntityID _player_id = 0;
+        PhysicsSystem _physics;
+        PlayerControllerSystem _player_controller;
+        EnemySystem _enemy_system;
+        AnimationSystem _animation_system;
+        BackgroundSystem _background_system;
+        CloudSystem _cloud_system;
+        SpriteRenderSystem _sprite_render_system;
+        CameraSystem _camera_system;
+        DebugDrawSystem _debug_draw_system;
+        Level _level;
+        HUD _hud;
+        float _level_transition_delay = 0.0f;
+        bool _level_transition_pending = false;
+        std::uint64_t _transitions = 0;
+        int _top_inset = 0;
+
+        std::string _current_level_path;
+
+        // Pipeline entry: the name labels the system's profiler scope and must be a string literal.
+        struct UpdateSystem {
+            const char* name;
+            std::function<void(zia::engine::IEntityManager&, float)> run;
+        };
+        struct RenderSystem {
+            const char* name;
+            std::function<void(zia::engine::IEntityManager&, zia::engine::IRenderer&, zia::engine::IAssetManager&, const Camera&)> run;
+        };
+
+        // Ordered update callbacks to keep the ECS steps deterministic.
+        std::vector<UpdateSystem> _update_systems;
+        // Render callbacks that rely on the camera context provided each frame.
+        std::vector<RenderSystem> _render_systems;
+
+        // Cached list of background entities sorted by parallax.
+        std::vector<EntityID> _sorted_backgrounds;
+        // Dirty flag to rebuild the background cache when entities change.
+        bool _background_cache_dirty = true;
+
+        // Background texture slot used by the current level (see constants::background_texture_id).
+        int _background_slot = 0;
+        // Texture ids retained by enter and released by exit.
+        std::vector<int> _retained_textures;
+
+        // Next level (constants::next_level_path) being parsed in the background, then prepared.
+        std::future<Level> _prefetch;
+        std::string _prefetch_path;
+        std::unique_ptr<PreparedLevel> _prepared;
+
+        // The level as start_level left it; restarts restore it instead of reloading the level.
+        WorldSnapshot _level_start;
+    };
+} // namespace zia
@@ -3,6 +3,7 @@
 #include <SFML/Graphics/Color.hpp>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <string_view>
 
 
@@ -58,6 +59,23 @@
         // Menu background texture id base: three variants for the settings dropdown (800x600, 1024x768, 1280x720)
         inline constexpr int MENU_BACKGROUND_TEXTURE_ID = 1001;
 
+        // Level background textures. Each level slot owns a block of ids (layer 0 is the main background,
+        // layers 1.. are the level's extra layers), so layers never overwrite each other or the menu
+        // backgrounds, and the next level can stream into the other slot while the current one is shown.
+        inline constexpr int LEVEL_BACKGROUND_TEXTURE_BASE_ID = 1100;
+        inline constexpr int LEVEL_BACKGROUND_SLOTS = 2;
+        inline constexpr int LEVEL_BACKGROUND_MAX_LAYERS = 32;
+        inline constexpr int background_texture_id(int slot, int layer) {
+            return LEVEL_BACKGROUND_TEXTURE_BASE_ID + slot * LEVEL_BACKGROUND_MAX_LAYERS + layer;
+        }
+
+        // Tileset images, one block of ids per level slot (same slots as the background textures).
+        inline constexpr int TILESET_TEXTURE_BASE_ID = 5000;
+        inline constexpr int TILESET_MAX_IMAGES = 64;
+        inline constexpr int tileset_texture_id(int slot, int image) {
+            return TILESET_TEXTURE_BASE_ID + slot * TILESET_MAX_IMAGES + image;
+        }
+
         // Clouds
         inline constexpr int CLOUD_BIG_ID = 2000;
         inline constexpr int CLOUD_MEDIUM_ID = 2001;
@@ -85,13 +103,29 @@
         inline constexpr std::string_view LEVEL1_PATH = "assets/levels/level1.json";
         inline constexpr std::string_view LEVEL2_PATH = "assets/levels/level2.json";
 
+        // Tileset used by levels that do not name one.
+        inline constexpr std::string_view DEFAULT_TILESET_PATH = "assets/tilesets/blocks.json";
+
         // Central list of available levels (single definition point)
         inline constexpr std::array<std::string_view, 2> LEVEL_PATHS = { LEVEL1_PATH, LEVEL2_PATH };
 
+        // Level reached by walking off the right edge of 'path': the next entry of LEVEL_PATHS, wrapping
+        // around. Unknown paths continue with the first level.
+        constexpr std::string_view next_level_path(std::string_view path) {
+            for (std::size_t i = 0; i < LEVEL_PATHS.size(); ++i) {
+                if (LEVEL_PATHS[i] == path) return LEVEL_PATHS[(i + 1) % LEVEL_PATHS.size()];
+            }
+            return LEVEL_PATHS[0];
+        }
+
         // Camera zoom scale: multiply world viewport to show more/less area. >1 = zoom out (show more tiles), <1 = zoom in.
         // Default: zoom out a bit so camera shows more area after switching to 32px tiles.
         inline constexpr float CAMERA_SCALE = 1.15f;
 
+        // Extra world-space margin (pixels) around the camera view when culling sprites, so sprites
+        // whose render offset pushes them slightly past the view edge do not pop in/out.
+        inline constexpr float SPRITE_CULL_MARGIN = 2.0f * static_cast<float>(TILE_SIZE);
+
         // Player Textures
         inline constexpr int PLAYER_IDLE_ID = 3000;
         inline constexpr int PLAYER_RUN_ID = 3001;
@@ -2,6 +2,8 @@
 
 #include "Zia/engine/IEntityManager.hpp"
 #include "Zia/engine/IAssetManager.hpp"
+#include <cstdint>
+#include <optional>
 #include <string>
 
 namespace zia {
@@ -14,5 +16,10 @@ namespace zia {
         static EntityID spawn_player_default(zia::engine::IEntityManager& registry, zia::engine::IAssetManager& assets);
         static void spawn_enemy(zia::engine::IEntityManager& registry, const EntitySpawn& spawn);
         static void spawn_clouds(zia::engine::IEntityManager& registry, zia::engine::IAssetManager& assets);
+
+        // Seed for the randomized spawns (cloud placement). Unset, every spawn draws a fresh seed;
+        // recordings and replays set it so a level starts identically each time.
+        static void set_random_seed(std::optional<std::uint32_t> seed);
+        [[nodiscard]] static std::optional<std::uint32_t> random_seed();
     };
 } // namespace Zia
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Zia/engine/IAssetManager.hpp"
+#include "Zia/engine/IEntityManager.hpp"
+
+namespace zia {
+    class Level;
+
+    // Keeps the level's tile chunks (TileMap::CHUNK_COLUMNS wide) resident around the view and the
+    // player, and spawns a chunk's enemies the first time it streams in.
+    //   - chunks covering the view and the player are loaded synchronously, so collision never sees
+    //     a missing chunk under the player;
+    //   - PREFETCH_CHUNKS further chunks on each side are read on the asset worker pool;
+    //   - chunks more than KEEP_CHUNKS away from that window are evicted, together with the enemies
+    //     standing in them.
+    class ChunkStreamingSystem {
+    public:
+        static constexpr int PREFETCH_CHUNKS = 2;
+        static constexpr int KEEP_CHUNKS = 4;
+
+        // Load the chunks covering [view_left, view_right] (world pixels) right away and spawn their
+        // enemies. Used when a level is populated, before the first frame.
+        static void prime(zia::engine::IEntityManager& registry, Level& level, float view_left, float view_right);
+
+        // Per-frame streaming step; 'player' (0 = none) is always kept resident. Prefetch reads are
+        // submitted to 'assets' (IAssetManager::submit_job). Cost follows the resident and in-flight
+        // chunks around the view, not the number of chunks in the level.
+        static void update(zia::engine::IEntityManager& registry, zia::engine::IAssetManager& assets, Level& level,
+                           float view_left, float view_right, EntityID player);
+
+        // When set, prefetched chunks are only installed once they enter the resident window, instead
+        // of on the frame their worker happens to finish, so enemies spawn on the same frame in every
+        // run. Used by input recording and replay.
+        static void set_deterministic(bool enabled);
+    };
+} // namespace Zia
@@ -6,12 +6,18 @@
 namespace zia {
     class Camera; // forward declaration
 
-    // System responsible for drawing debug overlays such as bounding boxes.
+    // System responsible for drawing debug overlays such as bounding boxes. It owns the per-frame
+    // flush of the engine debug draw queue (see Zia/engine/render/DebugDraw.hpp).
     class DebugDrawSystem {
     public:
         DebugDrawSystem() = default;
 
-        // Draw bounding boxes for entities that have Position and Size components.
+        // Draw bounding boxes for entities that have Position and Size components, together with any
+        // debug geometry queued by other systems this frame, as one batched line list.
         void render(zia::engine::IRenderer& renderer, const Camera& camera, zia::engine::IEntityManager& registry);
+
+    private:
+        // Queue one outline per entity with Position and Size into the debug draw batch.
+        static void queue_bounds(zia::engine::IEntityManager& registry);
     };
 }
@@ -24,6 +24,12 @@ namespace zia {
         // Configure how many entities to show to avoid overly large overlays
         void set_max_entries(size_t n) { _max_entries = n; }
 
+        // Sprite culling counters from the render pipeline, shown in the overlay header.
+        void set_render_stats(size_t visible_sprites, size_t culled_sprites) {
+            _visible_sprites = visible_sprites;
+            _culled_sprites = culled_sprites;
+        }
+
         // Global visibility helpers (menu can call these to toggle inspector across scenes)
         static void set_inspector_visible(bool v);
         static bool is_inspector_visible();
@@ -31,8 +37,17 @@ namespace zia {
     private:
         bool _enabled = true;
         size_t _max_entries = 32;
-
-        // Helper to build the overlay lines
-        void build_lines(const std::vector<EntityID>& entities, zia::engine::IEntityManager& registry, std::vector<std::string>& out_lines, zia::engine::IAssetManager& assets) const;
+        size_t _visible_sprites = 0;
+        size_t _culled_sprites = 0;
+
+        // Per-frame buffers reused across frames so the overlay does not allocate once warmed up.
+        std::vector<EntityID> _type_entities;
+        std::vector<EntityID> _enemy_entities;
+        std::vector<EntityID> _entities;
+        std::vector<std::string> _lines;
+
+        // Helper to build the overlay lines. Overwrites the first entries of out_lines (keeping their
+        // capacity) and returns how many were written.
+        size_t build_lines(const std::vector<EntityID>& entities, zia::engine::IEntityManager& registry, std::vector<std::string>& out_lines, zia::engine::IAssetManager& assets) const;
     };
 }
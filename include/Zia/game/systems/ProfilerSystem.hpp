@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Zia/engine/FramePacer.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
+
+#include <string>
+#include <vector>
+
+namespace zia {
+    // ImGui window over zia::engine::Profiler: frame-time graph, per-scope min/avg/p99 table and a
+    // timeline of the last recorded frame with one lane per thread. Allocation counts per frame and
+    // per scope are added when allocation tracking is compiled in, and the frame pacer's target and
+    // missed-frame counts when a pacer is given. Shown next to the inspector and toggled with it.
+    class ProfilerSystem {
+    public:
+        void render_ui(zia::engine::FramePacer* pacer = nullptr);
+
+        void set_enabled(bool en) { _enabled = en; }
+        bool enabled() const { return _enabled; }
+        void toggle_enabled() { _enabled = !_enabled; }
+
+    private:
+        void draw_stats_table();
+        void draw_timeline(const zia::engine::ProfileFrame& frame);
+        // Chrome trace export: capture the next frames or save the retained last seconds.
+        void draw_trace_controls();
+        void draw_pacing(zia::engine::FramePacer& pacer);
+
+        bool _enabled = true;
+        // Freeze the window on the frame shown when pausing; the profiler keeps recording.
+        bool _paused = false;
+        zia::engine::ProfileFrame _shown_frame;
+
+        // Scratch buffers reused between frames.
+        std::vector<float> _frame_times;
+        std::vector<float> _frame_allocations;
+        std::vector<zia::engine::ProfileScopeStats> _stats;
+        std::vector<std::string> _thread_names;
+
+        int _capture_frames = 300;
+        int _retention_seconds = 10;
+    };
+}
@@ -1,14 +1,33 @@
 #pragma once
 
+#include <cstddef>
+#include <vector>
+#include <SFML/Graphics/Rect.hpp>
+
 #include "Zia/game/world/Camera.hpp"
 #include "Zia/engine/IRenderer.hpp"
 #include "Zia/engine/IAssetManager.hpp"
 #include "Zia/engine/IEntityManager.hpp"
+#include "Zia/engine/ecs/components/SpriteComponent.hpp"
+#include "Zia/engine/ecs/components/PositionComponent.hpp"
+#include "Zia/engine/ecs/components/SizeComponent.hpp"
 
 namespace zia {
     class SpriteRenderSystem {
     public:
         // Render all entities that have a SpriteComponent, using Position/Size components.
+        // Only entities whose draw rectangle overlaps the camera view (plus a margin) are drawn.
         void render(zia::engine::IRenderer& renderer, const Camera& camera, zia::engine::IEntityManager& registry, zia::engine::IAssetManager& assets);
+
+        // Culling statistics from the last render() call (for profiling overlays).
+        [[nodiscard]] std::size_t visible_count() const noexcept { return _visible_count; }
+        [[nodiscard]] std::size_t culled_count() const noexcept { return _culled_count; }
+
+    private:
+        // Scratch buffer reused across frames to avoid reallocations.
+        std::vector<EntityID> _renderables;
+
+        std::size_t _visible_count = 0;
+        std::size_t _culled_count = 0;
     };
 } // namespace Zia
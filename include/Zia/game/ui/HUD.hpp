@@ -9,6 +9,11 @@ namespace zia {
     class HUD {
     public:
         HUD(zia::engine::IRenderer& renderer);
+        ~HUD();
+
+        // The HUD owns renderer text handles; copying would release them twice.
+        HUD(const HUD&) = delete;
+        HUD& operator=(const HUD&) = delete;
 
         void set_lives(int lives);
 
@@ -25,6 +30,8 @@ namespace zia {
 
     private:
         zia::engine::IRenderer& _renderer;
+        // Retained text for the level name; its geometry is only rebuilt when the name changes.
+        zia::engine::TextHandle _level_text = zia::engine::INVALID_TEXT_HANDLE;
         std::string _level_name;
         int _lives = 0;
         int _coins = 0;
@@ -32,9 +39,17 @@ namespace zia {
         int _timer = 0;
     };
 
+    // Retained text element backed by a renderer text handle (released on destruction).
     class Text {
     public:
         Text(zia::engine::IRenderer& renderer);
+        ~Text();
+
+        // Movable (so it can live in a std::vector) but not copyable: the handle has a single owner.
+        Text(Text&& other) noexcept;
+        Text(const Text&) = delete;
+        Text& operator=(const Text&) = delete;
+        Text& operator=(Text&&) = delete;
 
         void set_string(std::string_view text);
 
@@ -44,10 +59,12 @@ namespace zia {
 
         void set_color(sf::Color color);
 
+        // Submit the text to this frame's UI text batch.
         void render();
 
     private:
         zia::engine::IRenderer& _renderer;
+        zia::engine::TextHandle _handle = zia::engine::INVALID_TEXT_HANDLE;
         std::string _text;
         float _x = 0;
         float _y = 0;
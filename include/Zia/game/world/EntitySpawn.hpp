@@ -1,14 +1,30 @@
 #pragma once
 
+#include <memory_resource>
 #include <string>
+#include <utility>
 
 namespace zia {
     // Describes where to spawn an entity (tile coordinates) and what type it should be.
+    // Allocator-aware so a level's spawn table keeps its strings in the level's arena (see Level).
     struct EntitySpawn {
-        std::string type;
+        using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+        EntitySpawn() = default;
+        explicit EntitySpawn(const allocator_type &alloc) : type(alloc), name(alloc) {}
+        EntitySpawn(const EntitySpawn &other, const allocator_type &alloc)
+            : type(other.type, alloc), tile_x(other.tile_x), tile_y(other.tile_y), name(other.name, alloc) {}
+        EntitySpawn(EntitySpawn &&other, const allocator_type &alloc)
+            : type(std::move(other.type), alloc), tile_x(other.tile_x), tile_y(other.tile_y), name(std::move(other.name), alloc) {}
+        EntitySpawn(const EntitySpawn &) = default;
+        EntitySpawn(EntitySpawn &&) = default;
+        EntitySpawn &operator=(const EntitySpawn &) = default;
+        EntitySpawn &operator=(EntitySpawn &&) = default;
+
+        std::pmr::string type;
         int tile_x = 0;
         int tile_y = 0;
         // Optional name provided in level JSON (editor or authoring).
-        std::string name;
+        std::pmr::string name;
     };
 } // namespace Zia
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace zia {
+    class JsonDocument;
+
+    // Read-only view of one value inside a JsonDocument. Cheap to copy; valid while the document lives.
+    // Lookups on a missing key or a value of the wrong type yield an invalid value, so chains such as
+    // root["entities"][0]["type"] never need intermediate checks.
+    class JsonValue {
+    public:
+        enum class Type : std::uint8_t { Invalid, Null, Bool, Number, String, Array, Object };
+
+        // Iterates the elements of an array or the members of an object, in file order.
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = JsonValue;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = JsonValue;
+
+            Iterator(const JsonDocument* doc, std::uint32_t index) : _doc(doc), _index(index) {}
+            JsonValue operator*() const { return {_doc, _index}; }
+            Iterator& operator++();
+            bool operator==(const Iterator& other) const { return _index == other._index; }
+            bool operator!=(const Iterator& other) const { return _index != other._index; }
+
+        private:
+            const JsonDocument* _doc;
+            std::uint32_t _index;
+        };
+
+        JsonValue() = default;
+        JsonValue(const JsonDocument* doc, std::uint32_t index) : _doc(doc), _index(index) {}
+
+        Type type() const;
+        bool valid() const { return type() != Type::Invalid; }
+        explicit operator bool() const { return valid(); }
+        bool is_string() const { return type() == Type::String; }
+        bool is_number() const { return type() == Type::Number; }
+        bool is_bool() const { return type() == Type::Bool; }
+        bool is_array() const { return type() == Type::Array; }
+        bool is_object() const { return type() == Type::Object; }
+
+        // Key of this value when it is an object member, empty otherwise.
+        std::string_view key() const;
+
+        // Element count of an array or object, 0 for scalars.
+        std::size_t size() const;
+        Iterator begin() const;
+        Iterator end() const;
+
+        // Object member lookup (linear in the member count) and array indexing (linear in the index).
+        JsonValue operator[](std::string_view key) const;
+        JsonValue operator[](std::size_t index) const;
+        bool contains(std::string_view key) const { return (*this)[key].valid(); }
+
+        // Scalar accessors returning 'fallback' when the value has another type. Strings are views into
+        // the document buffer with escapes already decoded.
+        std::string_view as_string(std::string_view fallback = {}) const;
+        double as_number(double fallback = 0.0) const;
+        float as_float(float fallback = 0.0f) const { return static_cast<float>(as_number(fallback)); }
+        int as_int(int fallback = 0) const { return static_cast<int>(as_number(fallback)); }
+        bool as_bool(bool fallback = false) const;
+
+        // Member helpers mirroring the old JsonHelper::extract_* functions: set 'value' and return true
+        // only when 'key' exists with the expected type.
+        bool get(std::string_view key, std::string& value) const;
+        bool get(std::string_view key, std::pmr::string& value) const;
+        bool get(std::string_view key, float& value) const;
+        bool get(std::string_view key, int& value) const;
+        bool get(std::string_view key, bool& value) const;
+
+    private:
+        const JsonDocument* _doc = nullptr;
+        std::uint32_t _index = 0;
+    };
+
+    // JSON document parsed in one linear pass over a single owned buffer. Values are stored in a flat
+    // node array in document order; strings are string_views into the buffer (escape sequences are
+    // decoded in place, which never lengthens them), so parsing allocates only the node array.
+    class JsonDocument {
+    public:
+        // Parse 'text', taking ownership of the buffer. On failure root() is invalid and error()
+        // describes the first problem with its byte offset.
+        bool parse(std::string text);
+
+        // Read a level/scene file (resolved like every asset, see AssetPathResolver) and parse it.
+        bool load_file(std::string_view path);
+
+        JsonValue root() const { return _nodes.empty() ? JsonValue() : JsonValue(this, 0); }
+        const std::string& error() const { return _error; }
+
+    private:
+        friend class JsonValue;
+        friend class JsonParser;
+
+        struct Node {
+            JsonValue::Type type = JsonValue::Type::Null;
+            bool boolean = false;
+            // Array/object element count.
+            std::uint32_t count = 0;
+            // Index one past this node's last descendant, i.e. its next sibling.
+            std::uint32_t next = 0;
+            double number = 0.0;
+            std::string_view key;
+            std::string_view text;
+        };
+
+        std::string _buffer;
+        std::vector<Node> _nodes;
+        std::string _error;
+    };
+} // namespace zia
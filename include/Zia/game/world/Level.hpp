@@ -1,6 +1,10 @@
 #pragma once
 
+#include <filesystem>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <utility>
 #include <string_view>
 #include <vector>
 #include <string>
@@ -8,23 +12,58 @@
 #include "Zia/game/world/EntitySpawn.hpp"
 #include "Zia/engine/IRenderer.hpp"
 
+namespace zia::engine { class IAssetManager; }
+
 namespace zia {
     class TileMap;
     class Camera;
 
     // Loads tilemaps, spawns entities, manages checkpoints.
+    // The spawn table, background layers, their strings and the level's ECS component stores are
+    // allocated from the level's own engine::LevelArena, so unload() and the next load free and
+    // rebuild them without a heap allocation per spawn, string or map node.
     class Level {
     public:
+        // Allocator-aware like EntitySpawn, so the path lives in the level arena.
         struct BackgroundLayer {
-            std::string path;
+            using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+            BackgroundLayer() = default;
+            explicit BackgroundLayer(const allocator_type &alloc) : path(alloc) {}
+            BackgroundLayer(const BackgroundLayer &other, const allocator_type &alloc)
+                : path(other.path, alloc), scale(other.scale), parallax(other.parallax), repeat(other.repeat), repeat_x(other.repeat_x) {}
+            BackgroundLayer(BackgroundLayer &&other, const allocator_type &alloc)
+                : path(std::move(other.path), alloc), scale(other.scale), parallax(other.parallax), repeat(other.repeat), repeat_x(other.repeat_x) {}
+            BackgroundLayer(const BackgroundLayer &) = default;
+            BackgroundLayer(BackgroundLayer &&) = default;
+            BackgroundLayer &operator=(const BackgroundLayer &) = default;
+            BackgroundLayer &operator=(BackgroundLayer &&) = default;
+
+            std::pmr::string path;
             float scale = 1.0f;
             float parallax = 0.0f;
             bool repeat = false;
             bool repeat_x = false;
         };
 
+        Level();
+        ~Level();
+        Level(Level &&other) noexcept;
+        Level &operator=(Level &&other) noexcept;
+
+        // Load a level by path. A compiled .zlvl next to the JSON file (see tools/level_compiler) is used
+        // when it is at least as new as the JSON; otherwise the JSON is parsed.
         void load(std::string_view level_id);
 
+        // Load a compiled .zlvl file directly. Returns false, leaving the level untouched, when the file
+        // is missing or invalid.
+        bool load_compiled(const std::filesystem::path &path);
+
+        // Parse the JSON level file, ignoring any compiled counterpart (used by the level compiler).
+        void load_json(std::string_view level_id);
+
+        // Release everything the level loaded with one arena reset. Entities whose components were
+        // allocated from component_memory() must be destroyed first.
         void unload();
 
         void update(float dt);
@@ -32,26 +71,56 @@ namespace zia {
         void render(zia::engine::IRenderer &renderer);
 
         // Render with camera context so Level can compute visible tiles relative to camera viewport.
+        // Solid tiles are drawn as flat rectangles.
         void render(zia::engine::IRenderer &renderer, const Camera &camera);
 
+        // Render every tile layer with its tileset art (see bind_tileset_textures).
+        void render(zia::engine::IRenderer &renderer, const zia::engine::IAssetManager &assets, const Camera &camera);
+
+        // Texture id of the first tileset image; image i uses first_texture_id + i. The caller loads them.
+        void bind_tileset_textures(int first_texture_id);
+
         std::shared_ptr<TileMap> tile_map() const;
 
         std::shared_ptr<Camera> camera() const;
 
-        const std::vector<EntitySpawn>& entity_spawns() const;
+        // Resource for the ECS component stores of this level's entities (see
+        // EntityManager::set_memory_resource): a pool over the level arena, released by unload().
+        // nullptr before the first load.
+        std::pmr::memory_resource *component_memory();
+
+        // Spawns ordered by tile chunk (see TileMap::CHUNK_COLUMNS).
+        const std::pmr::vector<EntitySpawn>& entity_spawns() const;
+        // Indices [first, second) into entity_spawns() of the spawns lying in 'chunk'.
+        std::pair<std::size_t, std::size_t> spawn_range(int chunk) const;
+        // Mark a spawn as used. Returns false when it already was, so enemies killed or left behind are
+        // not spawned again when their chunk streams back in.
+        bool consume_spawn(std::size_t index);
+        // Consumed flags as a whole, for WorldSnapshot.
+        bool spawn_consumed(std::size_t index) const;
+        void set_spawn_consumed(std::size_t index, bool consumed);
+        std::optional<std::size_t> player_spawn_index() const;
 
-        const std::string& background_path() const { return _background_path; }
+        std::string_view background_path() const;
         float background_scale() const { return _background_scale; }
-        const std::vector<BackgroundLayer>& background_layers() const { return _background_layers; }
+        const std::pmr::vector<BackgroundLayer>& background_layers() const;
         bool clouds_enabled() const { return _clouds_enabled; }
 
     private:
-        std::shared_ptr<TileMap> _tile_map;
-        std::shared_ptr<Camera> _camera;
-        std::vector<EntitySpawn> _entity_spawns;
-        std::string _background_path;
+        // Everything allocated from the level arena, together with the arena itself (level.cpp).
+        struct Storage;
+
+        // Empty storage to fill, releasing whatever a previous load left in it.
+        Storage &begin_load();
+        // Fresh camera bounded by the tile map.
+        void reset_camera();
+        void index_spawns();
+
+        // Held by pointer so moving a Level (prefetch hand-over) keeps every container on its arena.
+        std::unique_ptr<Storage> _storage;
         float _background_scale = 1.0f;
-        std::vector<BackgroundLayer> _background_layers;
         bool _clouds_enabled = false;
+        // Texture id of tileset image 0, -1 while unbound.
+        int _tileset_texture_base = -1;
     };
 } // namespace Zia
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+namespace zia {
+    class Level;
+
+    // Compiled level (.zlvl) layout, little-endian, produced by tools/level_compiler from a level JSON:
+    //   LevelFileHeader | tiles (tile_layer_count layers of width * height uint16 tile ids, row-major,
+    //   0 = empty) | LevelSpawnRecord[spawn_count] | LevelLayerRecord[layer_count] | string table
+    // Every section starts on an 8-byte boundary. Strings are referenced by byte offset into the
+    // string table and are NUL-terminated; LEVEL_NO_STRING marks an absent string. The tileset is referenced
+    // by path and loaded from its JSON at run time. Version 2 replaced the 1-byte solid/empty grid.
+    inline constexpr std::uint32_t LEVEL_MAGIC = 0x4C564C5Au; // "ZLVL"
+    inline constexpr std::uint32_t LEVEL_VERSION = 2;
+    inline constexpr std::uint32_t LEVEL_NO_STRING = 0xFFFFFFFFu;
+    inline constexpr std::uint32_t LEVEL_FLAG_CLOUDS = 1u << 0;
+
+    struct LevelFileHeader {
+        std::uint32_t magic = LEVEL_MAGIC;
+        std::uint32_t version = LEVEL_VERSION;
+        std::int32_t width = 0;
+        std::int32_t height = 0;
+        std::int32_t tile_size = 0;
+        std::uint32_t flags = 0;
+        float background_scale = 1.0f;
+        std::uint32_t background_path = LEVEL_NO_STRING;
+        std::uint32_t spawn_count = 0;
+        std::uint32_t layer_count = 0;
+        std::uint32_t tile_layer_count = 1;
+        std::uint32_t tileset_path = LEVEL_NO_STRING;
+        std::uint64_t tiles_offset = 0;
+        std::uint64_t spawns_offset = 0;
+        std::uint64_t layers_offset = 0;
+        std::uint64_t strings_offset = 0;
+        std::uint64_t strings_size = 0;
+    };
+
+    // Entity spawn already resolved from the "entities" array and the enemy markers in "rows".
+    struct LevelSpawnRecord {
+        std::uint32_t type = LEVEL_NO_STRING;
+        std::uint32_t name = LEVEL_NO_STRING;
+        std::int32_t tile_x = 0;
+        std::int32_t tile_y = 0;
+    };
+
+    struct LevelLayerRecord {
+        std::uint32_t path = LEVEL_NO_STRING;
+        float scale = 1.0f;
+        float parallax = 0.0f;
+        std::uint8_t repeat = 0;
+        std::uint8_t repeat_x = 0;
+        std::uint8_t reserved[2] = {};
+    };
+
+    // Write 'level' (as loaded from its JSON source) to 'path' in the .zlvl format.
+    bool write_compiled_level(const Level &level, const std::filesystem::path &path);
+
+    // Compiled counterpart of a level path: same location with the ".zlvl" extension.
+    std::filesystem::path compiled_level_path(const std::filesystem::path &level_path);
+} // namespace zia
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace zia {
+    // How generated enemies are spread along the level.
+    enum class EnemyDistribution : std::uint8_t {
+        Uniform,   // evenly spaced over the places an enemy can stand
+        Random,    // uniformly random standing places
+        Clustered  // groups around random centres, as in hand-made enemy waves
+    };
+
+    // Parameters of a generated level. The same parameters and seed always produce the same file.
+    struct LevelGeneratorParams {
+        std::uint32_t seed = 1;
+        // Size in tiles. width * height is the tile count (6000 x 18 is a ~100k-tile level).
+        int width = 200;
+        int height = 18;
+        // Fraction of columns (0..1) covered by floating platforms.
+        float platform_density = 0.15f;
+        // Chance (0..1) for a ground column to start a 2-4 tile pit.
+        float gap_chance = 0.02f;
+        int enemy_count = 20;
+        EnemyDistribution distribution = EnemyDistribution::Uniform;
+        // Share of koopas among the enemies (the rest are goombas).
+        float koopa_ratio = 0.3f;
+        // Parallax layers drawn over the sky background, cycling through the shipped layer art.
+        int background_layers = 1;
+        bool clouds = true;
+    };
+
+    // Result of generating a level: the level JSON plus what ended up in it.
+    struct GeneratedLevel {
+        std::string json;
+        int enemies = 0;
+        // Enemies that had no free tile to stand on and were placed in the air (they fall on the first
+        // frame). Only happens when enemy_count exceeds the level's standing places.
+        int airborne_enemies = 0;
+        std::uint64_t solid_tiles = 0;
+    };
+
+    // Produces a level in the JSON schema Level::load_json reads ("rows" of '0'/'1' with 'G'/'K'
+    // enemy markers). The player spawns at the left edge, which is kept clear of pits and enemies.
+    GeneratedLevel generate_level(const LevelGeneratorParams &params);
+
+    // Writes the level JSON to 'json_path' and, when 'compile' is set, its compiled .zlvl next to it
+    // (see compiled_level_path), so Level::load maps it like a shipped level. Returns false on failure.
+    bool write_generated_level(const GeneratedLevel &level, const std::filesystem::path &json_path, bool compile = true);
+
+    // "uniform", "random" or "clustered"; false for anything else.
+    bool parse_enemy_distribution(std::string_view text, EnemyDistribution &out);
+} // namespace zia
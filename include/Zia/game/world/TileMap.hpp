@@ -1,18 +1,63 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <string_view>
 #include <optional>
 #include <functional>
+#include <future>
+#include <memory>
 
 #include "Zia/game/world/EntitySpawn.hpp"
+#include "Zia/game/world/Tileset.hpp"
+
+namespace zia::engine {
+    class IAssetManager;
+}
 
 namespace zia {
+    class JsonValue;
+
+    // Backing store a TileMap reads its chunks from. Reads may run on worker threads concurrently.
+    class TileSource {
+    public:
+        virtual ~TileSource() = default;
+
+        // Copy columns [first_column, first_column + count) of every row of 'layer' into 'out',
+        // row-major and 'count' tiles wide.
+        virtual void read_columns(int layer, int first_column, int count, TileId *out) const = 0;
+    };
+
     //  Tile grid data, collision layer, rendering chunks.
+    //
+    // The map holds one or more layers of 16-bit tile ids, drawn in order; the Tileset gives each id
+    // its art and property bits. A cell's properties are the union over its layers. Collision only
+    // asks is_solid, which reads a per-chunk bitset derived from those properties when the chunk is
+    // loaded, so the number of layers and tile kinds costs nothing in the physics loop.
+    //
+    // The grid is split into column chunks of CHUNK_COLUMNS tiles. Only resident chunks hold tile
+    // memory; is_solid reports empty space elsewhere. After a load no chunk is resident: the caller
+    // (ChunkStreamingSystem) loads the chunks around the player and evicts those left behind, so
+    // memory follows the window around the player rather than the level length. With a compiled
+    // level the source is the memory-mapped file, so untouched parts of the level are never read.
     class TileMap {
     public:
-        // Accept an optional reference to a vector to collect entity spawns (no raw pointer)
-        void load(std::string_view map_id, std::optional<std::reference_wrapper<std::vector<EntitySpawn>>> entity_spawns = std::nullopt);
+        static constexpr int CHUNK_COLUMNS = 32;
+
+        // Accept an optional reference to a vector to collect entity spawns (no raw pointer). Spawns are
+        // allocated with the vector's resource (the level arena when called from Level).
+        void load(std::string_view map_id, std::optional<std::reference_wrapper<std::pmr::vector<EntitySpawn>>> entity_spawns = std::nullopt);
+        // Build from the root object of an already parsed level file; 'map_id' is only used in warnings.
+        // "rows" is layer 0, written with the tileset's legend; "layers" may add further layers, each
+        // given as "rows" or as a row-major "tiles" id array. "tileset" names the tileset file
+        // (constants::DEFAULT_TILESET_PATH otherwise).
+        void load(const JsonValue &root, std::string_view map_id, std::optional<std::reference_wrapper<std::pmr::vector<EntitySpawn>>> entity_spawns = std::nullopt);
+
+        // Adopt in-memory tiles: 'layers' row-major grids of width * height ids, one after the other.
+        void assign(int width, int height, int layers, std::vector<TileId> tiles, std::shared_ptr<const Tileset> tileset);
+        // Read chunks on demand from 'source' (e.g. a memory-mapped compiled level).
+        void assign(int width, int height, int layers, std::shared_ptr<const TileSource> source, std::shared_ptr<const Tileset> tileset);
 
         void unload();
 
@@ -26,17 +71,83 @@ namespace zia {
 
         int tile_size() const;
 
+        int layer_count() const { return _layers; }
+
+        const std::shared_ptr<const Tileset>& tileset() const { return _tileset; }
+
         bool is_solid(int tx, int ty) const;
 
+        // Tile id of a cell in 'layer'; 0 outside the map or in a non-resident chunk.
+        TileId tile(int layer, int tx, int ty) const;
+
+        // Property bits of a cell (union over layers); 0 outside the map or in a non-resident chunk.
+        std::uint8_t tile_flags(int tx, int ty) const;
+
+        // Copy a whole layer (row-major) straight from the source, regardless of residency.
+        void copy_layer(int layer, std::vector<TileId> &out) const;
+
         int clamp_tile_x(int tx) const;
 
         int clamp_tile_y(int ty) const;
 
+        // Chunk residency, driven by ChunkStreamingSystem.
+        int chunk_count() const { return static_cast<int>(_chunks.size()); }
+        static int chunk_of_column(int tx) { return tx >= 0 ? tx / CHUNK_COLUMNS : -1; }
+        bool is_chunk_resident(int chunk) const;
+        int resident_chunk_count() const { return static_cast<int>(_resident.size()); }
+        // Indices of the resident chunks, in no particular order. Per-frame work walks this list (and
+        // the in-flight one) rather than every chunk, so it scales with the window, not the level.
+        const std::vector<int> &resident_chunks() const { return _resident; }
+        // Queue a read of 'chunk' on the asset worker pool; no-op when it is resident or already loading.
+        void request_chunk(int chunk, engine::IAssetManager &assets);
+        // Make 'chunk' resident now, finishing an in-flight request if there is one. A request no
+        // worker has started yet is taken over and read on the calling thread instead.
+        void load_chunk_now(int chunk);
+        // Install requests that have finished and append their chunk indices to 'loaded'.
+        void poll_chunks(std::vector<int> &loaded);
+        // Release a chunk's tiles (an in-flight request is cancelled, or waited for once started).
+        void evict_chunk(int chunk);
+
+        // Tiles and derived collision data of one resident chunk.
+        struct ChunkData {
+            // layer_count * height rows of the chunk's width, layer after layer.
+            std::vector<TileId> tiles;
+            // One bit per cell (row-major, chunk width), set when the cell is solid.
+            std::vector<std::uint64_t> solid;
+        };
+
     private:
+        // A queued chunk read, shared with the worker job. Whoever sets 'started' first does the read:
+        // the worker, or the main thread taking over (load_chunk_now) or cancelling it (evict_chunk).
+        struct PendingRead {
+            std::atomic<bool> started{false};
+            std::promise<ChunkData> result;
+        };
+
+        struct Chunk {
+            ChunkData data;
+            bool resident = false;
+            std::shared_ptr<PendingRead> read;
+            std::future<ChunkData> pending;
+        };
+
+        int chunk_width(int chunk) const;
+        ChunkData read_chunk(int chunk) const;
+        // Resolve the in-flight read of 'chunk': its data once a worker has started it, otherwise
+        // nothing (the read is cancelled). Clears the request either way.
+        std::optional<ChunkData> finish_read(int chunk);
+        void mark_resident(int chunk, ChunkData data);
+
         int _width = 0;
         int _height = 0;
+        int _layers = 0;
         // Fixed tile size (pixels). Per-level "tileSize" JSON field is deprecated and ignored.
         int _tile_size = 32;
-        std::vector<unsigned char> _tiles;
+        std::shared_ptr<const TileSource> _source;
+        std::shared_ptr<const Tileset> _tileset;
+        std::vector<Chunk> _chunks;
+        // Small lists mirroring Chunk::resident and Chunk::pending, for per-frame scans.
+        std::vector<int> _resident;
+        std::vector<int> _in_flight;
     };
 } // namespace Zia
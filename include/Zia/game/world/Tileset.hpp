@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace zia {
+    // Tile identifier stored in tile layers. 0 is always the empty tile.
+    using TileId = std::uint16_t;
+
+    // Packed per-tile property bits.
+    enum TileFlag : std::uint8_t {
+        TILE_SOLID = 1u << 0,
+        TILE_ONE_WAY = 1u << 1,
+        TILE_HAZARD = 1u << 2,
+        TILE_SLIPPERY = 1u << 3
+    };
+
+    // Where a tile's art lives: an image of the tileset and a rectangle inside it.
+    struct TileArt {
+        std::uint16_t image = 0;
+        std::uint16_t x = 0;
+        std::uint16_t y = 0;
+        std::uint16_t width = 0;
+        std::uint16_t height = 0;
+    };
+
+    // Maps tile ids to their art and properties. Loaded from a tileset JSON file:
+    //   { "tile_width": 40, "tile_height": 32,
+    //     "images": ["assets/Tiles/BlockA0.png", ...],
+    //     "tiles": [ { "id": 1, "image": 0, "x": 0, "y": 0, "char": "1", "flags": ["solid"] }, ... ] }
+    // "x"/"y" default to 0 and "width"/"height" to the tileset's tile size; "char" is the symbol that
+    // stands for the tile in a level's "rows" strings. Immutable once loaded, so it is shared between
+    // the tile map, the renderer and chunk reads on worker threads.
+    class Tileset {
+    public:
+        // Load 'path'; on failure a warning is printed and the builtin tileset is returned instead.
+        static std::shared_ptr<const Tileset> load(std::string_view path);
+
+        // Fallback with the historical legend: '1' is a solid tile without art (drawn as TILE_COLOR).
+        static std::shared_ptr<const Tileset> builtin();
+
+        // Source file, empty for the builtin tileset.
+        const std::string& path() const { return _path; }
+        const std::vector<std::string>& images() const { return _images; }
+
+        // Number of ids (including the empty id 0).
+        std::size_t size() const { return _flags.size(); }
+
+        // Property bits of 'id'; 0 for the empty tile and ids outside the table.
+        std::uint8_t flags(TileId id) const { return id < _flags.size() ? _flags[id] : 0; }
+        bool has_art(TileId id) const { return id < _art.size() && _art[id].width > 0 && _art[id].height > 0; }
+        const TileArt& art(TileId id) const { return _art[id < _art.size() ? id : 0]; }
+
+        // Tile written as 'symbol' in level rows, 0 when the symbol is not in the legend.
+        TileId id_for_char(char symbol) const;
+
+    private:
+        Tileset();
+
+        std::string _path;
+        std::vector<std::string> _images;
+        // Indexed by tile id. Properties are kept apart from the art so the table read while
+        // deriving collision data stays one byte per tile.
+        std::vector<std::uint8_t> _flags;
+        std::vector<TileArt> _art;
+        std::array<TileId, 128> _legend{};
+    };
+} // namespace zia
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Zia/engine/ecs/ComponentSnapshot.hpp"
+#include "Zia/engine/ecs/components/NameComponent.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace zia::engine {
+    // Names are the one component that is not trivially copyable: u32 length, then the characters.
+    template<>
+    struct SnapshotCodec<zia::NameComponent> {
+        static void write(SnapshotWriter &out, const zia::NameComponent &component);
+        static bool read(SnapshotReader &in, zia::NameComponent &component);
+    };
+} // namespace zia::engine
+
+namespace zia {
+    class Level;
+
+    // World snapshot layout (native byte order, in memory only):
+    //   WorldSnapshotHeader | level path (level_path_size bytes) | Camera bytes (if flagged)
+    //   | consumed spawn bits (spawn_count bits, padded to bytes) | resident chunk bits (chunk_count bits)
+    //   | ComponentSnapshot of every gameplay component type
+    inline constexpr std::uint32_t WORLD_SNAPSHOT_MAGIC = 0x504E535Au; // "ZSNP"
+    inline constexpr std::uint32_t WORLD_SNAPSHOT_VERSION = 1;
+
+    struct WorldSnapshotHeader {
+        std::uint32_t magic = WORLD_SNAPSHOT_MAGIC;
+        std::uint32_t version = WORLD_SNAPSHOT_VERSION;
+        std::uint32_t flags = 0;
+        std::uint32_t level_path_size = 0;
+        // Level layout the snapshot belongs to; restore refuses a level that does not match.
+        std::uint32_t spawn_count = 0;
+        std::uint32_t chunk_count = 0;
+        std::uint32_t entity_counter = 0;
+        std::uint32_t random_seed = 0;
+        // Scene state (see SceneSnapshotState).
+        std::uint32_t player_id = 0;
+        std::int32_t background_slot = 0;
+        float level_transition_delay = 0.0f;
+
+        static constexpr std::uint32_t HAS_CAMERA = 1u << 0;
+        static constexpr std::uint32_t HAS_RANDOM_SEED = 1u << 1;
+    };
+
+    // Play state that lives in the scene rather than in the ECS or the level.
+    struct SceneSnapshotState {
+        EntityID player_id = 0;
+        // Texture slot the level's background entities refer to (see constants::background_texture_id).
+        int background_slot = 0;
+        float level_transition_delay = 0.0f;
+    };
+
+    // A captured world: every gameplay component store, the entity counter, the camera, which spawns
+    // were consumed and which tile chunks were resident, the level path and the spawner's seed. Tile
+    // data is not copied: it never changes while playing and is read back from the level on restore.
+    // Capture and restore reuse the buffer and the components already in the registry, so taking a
+    // snapshot every frame does not allocate once the buffer has grown, and restoring a recent one
+    // takes microseconds (quick save/load, level restarts, rollback resimulation).
+    class WorldSnapshot {
+    public:
+        // Replace the contents with the current world.
+        void capture(const zia::EntityManager &entities, const Level &level, std::string_view level_path,
+                     const SceneSnapshotState &scene);
+
+        // Restore into 'entities' and 'level', which must be the level the snapshot was taken in (same
+        // spawns and chunks). Returns false, with a message on stderr and nothing changed, otherwise.
+        // Chunks resident at capture time are loaded again; the others are evicted.
+        bool restore(zia::EntityManager &entities, Level &level, SceneSnapshotState &scene) const;
+
+        [[nodiscard]] bool empty() const noexcept { return _data.empty(); }
+        [[nodiscard]] std::size_t size_bytes() const noexcept { return _data.size(); }
+        void clear() { _data.clear(); }
+
+        // Level path and scene state of the snapshot (empty / default when there is none).
+        [[nodiscard]] std::string_view level_path() const;
+        [[nodiscard]] SceneSnapshotState scene_state() const;
+
+    private:
+        [[nodiscard]] const WorldSnapshotHeader *header() const;
+
+        std::vector<std::byte> _data;
+    };
+
+    // Hash of the simulated world (entity ids, positions and velocities, compared bit for bit), used to
+    // check that two runs, or a world and its restored snapshot, are the same.
+    [[nodiscard]] std::uint64_t world_state_hash(const zia::EntityManager &entities);
+} // namespace zia
@@ -1,12 +1,82 @@
 // Include the Game class which provides the main application lifecycle (initialization, run loop, shutdown).
 #include "Zia/game/MarioGame.hpp"
+#include "Zia/engine/resources/AssetPathResolver.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
+#include "Zia/game/helpers/Constants.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
 
 // Program entry point.
 // Creates the game object, runs the main loop, performs shutdown, and returns an exit code.
-int main()
+// Options: --asset-root <dir> (repeatable) adds a directory holding an "assets" folder, searched
+// before the ZIA_ASSET_ROOTS and working-directory defaults.
+// Profiling: --trace-frames [first:]count writes frames first..first+count-1 (frame 0 includes the
+// first level load) as a Chrome trace; --trace-seconds <n> keeps the last n seconds and writes them on
+// exit. --trace <file> names the output (default zia_trace.json); give each mode its own run.
+// Deterministic runs: --record <file> [--level <path>] plays a level (default level 1) and writes the
+// per-tick input to <file> on exit; --replay <file> plays such a recording back with the same seed and
+// fixed timestep, quits when it ends and reports whether the final world state matched.
+int main(int argc, char* argv[])
 {
+    // Index the asset tree once, before any subsystem loads a file.
+    std::vector<std::filesystem::path> asset_roots;
+    std::filesystem::path trace_path = "zia_trace.json";
+    std::string trace_frames;
+    double trace_seconds = 0.0;
+    std::filesystem::path record_path;
+    std::filesystem::path replay_path;
+    std::string record_level(zia::constants::LEVEL1_PATH);
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg(argv[i]);
+        if (arg == "--asset-root" && i + 1 < argc) {
+            asset_roots.emplace_back(argv[++i]);
+        } else if (arg.rfind("--asset-root=", 0) == 0) {
+            asset_roots.emplace_back(std::string(arg.substr(std::string_view("--asset-root=").size())));
+        } else if (arg == "--trace" && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (arg == "--trace-frames" && i + 1 < argc) {
+            trace_frames = argv[++i];
+        } else if (arg == "--trace-seconds" && i + 1 < argc) {
+            trace_seconds = std::atof(argv[++i]);
+        } else if (arg == "--record" && i + 1 < argc) {
+            record_path = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            replay_path = argv[++i];
+        } else if (arg == "--level" && i + 1 < argc) {
+            record_level = argv[++i];
+        }
+    }
+
+    auto &profiler = zia::engine::Profiler::instance();
+    if (!trace_frames.empty()) {
+        const auto colon = trace_frames.find(':');
+        const auto first = colon == std::string::npos ? 0ull : std::strtoull(trace_frames.c_str(), nullptr, 10);
+        const auto count = std::strtoull(trace_frames.c_str() + (colon == std::string::npos ? 0 : colon + 1), nullptr, 10);
+        if (count > 0) {
+            profiler.capture_frames(first, static_cast<std::size_t>(count), trace_path);
+        }
+    }
+    if (trace_seconds > 0.0) {
+        profiler.set_trace_retention(trace_seconds);
+        profiler.set_trace_exit_path(trace_path);
+    }
+    const auto default_roots = zia::engine::AssetPathResolver::default_roots();
+    asset_roots.insert(asset_roots.end(), default_roots.begin(), default_roots.end());
+    zia::engine::asset_path_resolver().set_roots(std::move(asset_roots));
+
     // Construct the game instance. The constructor should initialize resources.
     zia::Game game;
+    if (!replay_path.empty()) {
+        if (!game.replay_input(replay_path)) {
+            return 1;
+        }
+    } else if (!record_path.empty()) {
+        game.record_input(record_path, record_level);
+    }
 
     // Run the main game loop. This should block until the game exits (e.g., window closed or game over).
     game.run();
@@ -14,6 +84,9 @@ int main()
     // Perform cleanup and release resources before exiting the process.
     game.shutdown();
 
+    // Write any trace requested on the command line that is still pending.
+    profiler.finish_traces();
+
     // Return zero to indicate successful execution to the operating system.
     return 0;
 }
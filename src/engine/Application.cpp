@@ -9,23 +9,32 @@
 #include "Zia/engine/adapters/InputAdapter.hpp"
 #include "Zia/engine/adapters/AssetManagerAdapter.hpp"
 #include "Zia/engine/adapters/EntityManagerAdapter.hpp"
+#include "Zia/engine/resources/AssetArchive.hpp"
+#include "Zia/engine/resources/TextureCache.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
 #include "Zia/editor/EditorUI.hpp"
 
 #include <iostream>
 
 #include <SFML/System/Clock.hpp>
-#include <SFML/System/Sleep.hpp>
 
 namespace zia::engine {
     Application::Application(std::string_view title) {
+        // Claim the profiler's first lane for this thread before any worker records a scope.
+        Profiler::instance().set_thread_name("main");
+        // Mount the packed asset archive when one was built; loose files remain the fallback.
+        auto archive = open_default_asset_archive();
+
         // Create owned concrete subsystems.
-        auto renderer = std::make_shared<zia::Renderer>();
+        auto renderer = std::make_shared<zia::Renderer>(archive);
         // If a title was provided, update the renderer window title.
         if (!title.empty()) {
             renderer->window().setTitle(sf::String(std::string(title)));
         }
         auto input = std::make_shared<zia::InputManager>();
         auto assets = std::make_shared<zia::AssetManager>();
+        assets->set_archive(archive);
+        assets->set_texture_cache(open_default_texture_cache());
         auto entities = std::make_shared<zia::EntityManager>();
 
         // Initialize interface adapters.
@@ -62,7 +71,12 @@ namespace zia::engine {
         }
     }
 
-    Application::~Application() = default;
+    Application::~Application() {
+        // The render thread calls back into _ui; make sure it is gone before members are destroyed.
+        if (_threaded_renderer) {
+            _threaded_renderer->stop();
+        }
+    }
 
     void Application::initialize() {
         _running = true;
@@ -70,13 +84,40 @@ namespace zia::engine {
         if (_ui && !_ui->init(_renderer_iface->window())) {
             std::cerr << "Warning: UI Manager failed to initialize. ImGui features will be unavailable." << std::endl;
         }
+        // Start the render thread last: ImGui initialization above still needs the context on this thread.
+        if (_threaded_renderer) {
+            _threaded_renderer->start();
+        }
+    }
+
+    void Application::set_threaded_rendering(bool enabled) {
+        if (!enabled || _threaded_renderer) {
+            return;
+        }
+        _threaded_renderer = std::make_shared<ThreadedRenderer>(_renderer_iface);
+        // ImGui draw data is rendered on the render thread, right before the frame is presented.
+        _threaded_renderer->set_before_present([this](sf::RenderWindow& window) {
+            if (_ui) _ui->render(window);
+        });
+        _renderer_iface = _threaded_renderer;
+    }
+
+    void Application::sync_render_thread() {
+        if (_threaded_renderer) {
+            _threaded_renderer->wait_idle();
+        }
     }
 
     void Application::shutdown() {
+        // Stop the render thread first so the window context is back on this thread for ImGui shutdown.
+        if (_threaded_renderer) {
+            _threaded_renderer->stop();
+        }
         if (_ui) _ui->shutdown();
+        // Entities first: a scene's level arena may hold their component stores.
+        _entities_iface->clear();
         _scenes.clear();
         _assets_iface->unload_all();
-        _entities_iface->clear();
         _running = false;
     }
 
@@ -89,6 +130,7 @@ namespace zia::engine {
 
     void Application::push_scene(std::shared_ptr<IScene> scene) {
         if (!scene) return;
+        sync_render_thread();
         if (const auto current = current_scene()) {
             current->on_exit();
         }
@@ -98,6 +140,7 @@ namespace zia::engine {
 
     void Application::pop_scene() {
         if (_scenes.empty()) return;
+        sync_render_thread();
         _scenes.back()->on_exit();
         _scenes.pop_back();
         if (_scenes.empty()) {
@@ -114,6 +157,10 @@ namespace zia::engine {
 
     IInput &Application::input() { return *_input_iface; }
 
+    void Application::set_input(std::shared_ptr<IInput> input) {
+        if (input) _input_iface = std::move(input);
+    }
+
     IAssetManager &Application::assets() { return *_assets_iface; }
 
     IEntityManager &Application::entity_manager() { return *_entities_iface; }
@@ -129,26 +176,54 @@ namespace zia::engine {
 
     void Application::main_loop() {
         sf::Clock clock;
-        constexpr sf::Time target_frame_time = sf::seconds(1.0f / 60.0f);
+        auto &profiler = Profiler::instance();
 
         while (_running) {
             const auto scene = current_scene();
             if (!scene) break;
 
-            // ImGui process events
+            // Poll window events now; they are forwarded to ImGui after the render thread is idle,
+            // since ImGui's context must not be touched while the previous frame is being rendered.
             sf::RenderWindow &window = _renderer_iface->window();
+            bool close_requested = false;
+            _pending_events.clear();
             while (const auto event = window.pollEvent()) {
-                if (_ui) _ui->process_event(window, *event);
                 if (event->is<sf::Event::Closed>()) {
-                    window.close();
+                    close_requested = true;
                 }
+                // Input only queues the event; the scene's poll() applies it during update.
+                _input_iface->handle_event(*event);
+                _pending_events.push_back(*event);
             }
 
-            const float dt = clock.restart().asSeconds();
+            const float measured_dt = clock.restart().asSeconds();
+            const float dt = _fixed_dt > 0.0f ? _fixed_dt : measured_dt;
 
-            scene->update(dt);
+            // In render-thread mode this overlaps with the previous frame being drawn.
+            {
+                ZIA_PROFILE_SCOPE("update");
+                scene->update(dt);
+            }
+
+            {
+                ZIA_PROFILE_SCOPE("wait_render_thread");
+                sync_render_thread();
+            }
+            // Upload textures decoded by the asset workers (within the per-frame budget). Done while the
+            // render thread is idle, since a streamed texture may replace one referenced by the last frame.
+            if (_assets_iface) {
+                ZIA_PROFILE_SCOPE("texture_uploads");
+                _assets_iface->finalize_decoded_images();
+            }
+            if (close_requested) {
+                window.close();
+            }
 
             if (_ui) {
+                ZIA_PROFILE_SCOPE("ui_build");
+                for (const auto &event : _pending_events) {
+                    _ui->process_event(window, event);
+                }
                 _ui->update(window, _imgui_clock);
                 _ui->build();
                 // Invoke optional global overlay builder while ImGui frame is active so callbacks may create windows/menus.
@@ -162,15 +237,24 @@ namespace zia::engine {
                 } catch (...) { /* best-effort */ }
             }
 
-            _renderer_iface->begin_frame();
-            scene->render();
-            if (_ui) _ui->render(window);
-            _renderer_iface->end_frame();
+            {
+                ZIA_PROFILE_SCOPE("render");
+                _renderer_iface->begin_frame();
+                scene->render();
+                // Draw the batched UI texts before ImGui so overlays stay on top.
+                _renderer_iface->flush_text();
+                // With a render thread, ImGui is rendered there just before presenting (see set_threaded_rendering).
+                if (_ui && !_threaded_renderer) _ui->render(window);
+                _renderer_iface->end_frame();
+            }
 
-            const sf::Time elapsed = clock.getElapsedTime();
-            if (elapsed < target_frame_time) {
-                sf::sleep(target_frame_time - elapsed);
+            {
+                ZIA_PROFILE_SCOPE("frame_sleep");
+                _pacer.wait();
             }
+
+            // Close the profiler frame; its duration matches the frame time including the sleep.
+            profiler.mark_frame();
         }
     }
 } // namespace Zia::engine
@@ -9,6 +9,10 @@ namespace zia::engine {
     int EngineConfig::window_height() const { return _height; }
     bool EngineConfig::fullscreen() const { return _fullscreen; }
     float EngineConfig::master_volume() const { return _master_volume; }
+    bool EngineConfig::render_thread() const { return _render_thread; }
+    int EngineConfig::texture_budget_mb() const { return _texture_budget_mb; }
+    bool EngineConfig::vsync() const { return _vsync; }
+    int EngineConfig::target_fps() const { return _target_fps; }
 
     void EngineConfig::set_window_size(int width, int height) {
         _width = std::max(1, width);
@@ -26,6 +30,26 @@ namespace zia::engine {
         notify_all();
     }
 
+    // Startup-only option: observers are not notified since it cannot change at runtime.
+    void EngineConfig::set_render_thread(bool enabled) {
+        _render_thread = enabled;
+    }
+
+    void EngineConfig::set_texture_budget_mb(int megabytes) {
+        _texture_budget_mb = std::max(0, megabytes);
+        notify_all();
+    }
+
+    void EngineConfig::set_vsync(bool enabled) {
+        _vsync = enabled;
+        notify_all();
+    }
+
+    void EngineConfig::set_target_fps(int fps) {
+        _target_fps = std::max(0, fps);
+        notify_all();
+    }
+
     EngineConfig::ObserverId EngineConfig::register_observer(Observer cb) {
         if (!cb) return 0;
         const auto id = _next_id++;
@@ -0,0 +1,87 @@
+#include "Zia/engine/FramePacer.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include <SFML/System/Sleep.hpp>
+
+namespace zia::engine {
+    namespace {
+        using namespace std::chrono_literals;
+
+        // Bounds of the adaptive sleep margin: below the minimum the spin cannot absorb scheduler
+        // jitter; above the maximum a machine with a coarse timer spins most of the frame anyway.
+        constexpr std::chrono::steady_clock::duration MIN_SLEEP_MARGIN = 250us;
+        constexpr std::chrono::steady_clock::duration MAX_SLEEP_MARGIN = 4ms;
+        constexpr std::chrono::steady_clock::duration INITIAL_SLEEP_MARGIN = 2ms;
+
+        double to_ms(std::chrono::steady_clock::duration d) {
+            return std::chrono::duration<double, std::milli>(d).count();
+        }
+    }
+
+    FramePacer::FramePacer(int target_fps) : _sleep_margin(INITIAL_SLEEP_MARGIN) {
+        set_target_fps(target_fps);
+    }
+
+    void FramePacer::set_target_fps(int fps) {
+        _target_fps = std::max(0, fps);
+        _period = _target_fps > 0
+                      ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / _target_fps))
+                      : Clock::duration::zero();
+        // Re-anchor the schedule on the next frame.
+        _started = false;
+    }
+
+    // Used by: Application::main_loop (end of frame)
+    void FramePacer::wait() {
+        const auto now = Clock::now();
+        if (!_started) {
+            // The first frame has no deadline; the schedule starts here.
+            _started = true;
+            _deadline = now + _period;
+            _last_frame_end = now;
+            return;
+        }
+        if (_period == Clock::duration::zero()) {
+            record_frame(now);
+            return;
+        }
+
+        if (now > _deadline) {
+            ++_stats.missed;
+        } else {
+            // Coarse sleep: sf::sleep raises the timer resolution on Windows, which std::this_thread does not.
+            const auto wake_at = _deadline - _sleep_margin;
+            if (now < wake_at) {
+                sf::sleep(sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(wake_at - now).count()));
+                const auto oversleep = Clock::now() - wake_at;
+                // Grow at once when the sleep ran into the margin, shrink slowly otherwise.
+                _sleep_margin = std::clamp(std::max(_sleep_margin - _sleep_margin / 16, oversleep + MIN_SLEEP_MARGIN),
+                                           MIN_SLEEP_MARGIN, MAX_SLEEP_MARGIN);
+            }
+            // Spin for the rest; yield keeps other threads (render, asset workers) running meanwhile.
+            while (Clock::now() < _deadline) {
+                std::this_thread::yield();
+            }
+            _stats.max_wake_error_us = std::max(_stats.max_wake_error_us, to_ms(Clock::now() - _deadline) * 1000.0);
+        }
+
+        const auto end = Clock::now();
+        _deadline += _period;
+        if (_deadline <= end) {
+            // More than a period behind: restart the schedule rather than running frames back to back.
+            _deadline = end + _period;
+        }
+        record_frame(end);
+    }
+
+    void FramePacer::record_frame(Clock::time_point end) {
+        const double frame_ms = to_ms(end - _last_frame_end);
+        _last_frame_end = end;
+        ++_stats.frames;
+        _stats.last_frame_ms = frame_ms;
+        _stats.max_frame_ms = std::max(_stats.max_frame_ms, frame_ms);
+        _stats.total_frame_ms += frame_ms;
+    }
+} // namespace zia::engine
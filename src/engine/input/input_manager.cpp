@@ -1,229 +1,346 @@
 #include "Zia/engine/input/InputManager.hpp"
 
-#include <SFML/Window/Keyboard.hpp>
-#include <SFML/Window/Joystick.hpp>
-#include <SFML/Window/Mouse.hpp>
-
 #include <fstream>
+#include <map>
 #include <sstream>
 #include <algorithm> // for std::remove_if
 #include <cmath>
 
 namespace zia {
-    // Helper: map old enum actions to string names for backward compatibility.
-    static std::string action_to_name(InputManager::Action a) {
+    namespace {
+        constexpr int ANY_JOYSTICK = 0xFF;
+
+        // Key of the bound-input index: device, joystick (ANY_JOYSTICK for -1) and device code.
+        // Keyboard and mouse bindings ignore the joystick id.
+        std::uint32_t input_key(InputDevice device, int joystick, int code) {
+            const bool gamepad = device == InputDevice::GamepadButton || device == InputDevice::GamepadAxis;
+            const int joy = !gamepad ? 0 : (joystick < 0 ? ANY_JOYSTICK : joystick);
+            return (static_cast<std::uint32_t>(device) << 24) | (static_cast<std::uint32_t>(joy & 0xFF) << 16) |
+                   static_cast<std::uint32_t>(code & 0xFFFF);
+        }
+
+        Binding key_binding(sf::Keyboard::Key key) {
+            Binding binding;
+            binding.device = InputDevice::Keyboard;
+            binding.code = static_cast<int>(key);
+            return binding;
+        }
+
+        bool axis_active(const Binding &binding, float position) {
+            // SFML axis range is -100 .. 100
+            const float normalized = (binding.axisPositive ? position : -position) / 100.f;
+            return normalized >= binding.axisThreshold;
+        }
+    }
+
+    InputManager::InputManager() {
+        for (int i = 0; i < static_cast<int>(Action::Count); ++i) {
+            intern(action_name(static_cast<Action>(i)));
+        }
+        // Default keys of the enum actions (H shows/hides the debug bounding boxes, F5/F9 quick save/load).
+        _bindings[action_id(Action::MoveLeft)] = {key_binding(sf::Keyboard::Key::Left), key_binding(sf::Keyboard::Key::A)};
+        _bindings[action_id(Action::MoveRight)] = {key_binding(sf::Keyboard::Key::Right), key_binding(sf::Keyboard::Key::D)};
+        _bindings[action_id(Action::Jump)] = {key_binding(sf::Keyboard::Key::Space), key_binding(sf::Keyboard::Key::Up)};
+        _bindings[action_id(Action::Escape)] = {key_binding(sf::Keyboard::Key::Escape)};
+        _bindings[action_id(Action::ToggleDebug)] = {key_binding(sf::Keyboard::Key::H)};
+        _bindings[action_id(Action::QuickSave)] = {key_binding(sf::Keyboard::Key::F5)};
+        _bindings[action_id(Action::QuickLoad)] = {key_binding(sf::Keyboard::Key::F9)};
+        rebuild_bindings();
+    }
+
+    // Map old enum actions to string names for backward compatibility. The names are built once and
+    // are the interned names of the enum actions.
+    const std::string& InputManager::action_name(Action a) {
+        static const std::string names[] = {"MoveLeft", "MoveRight", "Jump", "Escape", "ToggleDebug", "QuickSave", "QuickLoad"};
+        static const std::string unknown = "Unknown";
         switch (a) {
-            case InputManager::Action::MoveLeft: return "MoveLeft";
-            case InputManager::Action::MoveRight: return "MoveRight";
-            case InputManager::Action::Jump: return "Jump";
-            case InputManager::Action::Escape: return "Escape";
-            case InputManager::Action::ToggleDebug: return "ToggleDebug";
-            default: return "Unknown";
+            case InputManager::Action::MoveLeft: return names[0];
+            case InputManager::Action::MoveRight: return names[1];
+            case InputManager::Action::Jump: return names[2];
+            case InputManager::Action::Escape: return names[3];
+            case InputManager::Action::ToggleDebug: return names[4];
+            case InputManager::Action::QuickSave: return names[5];
+            case InputManager::Action::QuickLoad: return names[6];
+            default: return unknown;
+        }
+    }
+
+    ActionId InputManager::intern(std::string_view name) {
+        const std::string key(name);
+        if (const auto it = _ids.find(key); it != _ids.end()) {
+            return it->second;
+        }
+        if (_names.size() >= MAX_ACTIONS) {
+            return INVALID_ACTION;
+        }
+        const auto id = static_cast<ActionId>(_names.size());
+        _names.push_back(key);
+        _ids.emplace(key, id);
+        _bindings.resize(_names.size());
+        return id;
+    }
+
+    ActionId InputManager::find_action(std::string_view name) const {
+        const auto it = _ids.find(std::string(name));
+        return it != _ids.end() ? it->second : INVALID_ACTION;
+    }
+
+    // Used by: Application::main_loop (every pumped window event)
+    void InputManager::handle_event(const sf::Event &event) {
+        DeviceEvent device;
+        device.time = _clock.getElapsedTime();
+        if (const auto *key = event.getIf<sf::Event::KeyPressed>()) {
+            device = {InputDevice::Keyboard, static_cast<int>(key->code), 0, 1.0f, device.time};
+        } else if (const auto *key_up = event.getIf<sf::Event::KeyReleased>()) {
+            device = {InputDevice::Keyboard, static_cast<int>(key_up->code), 0, 0.0f, device.time};
+        } else if (const auto *mouse = event.getIf<sf::Event::MouseButtonPressed>()) {
+            device = {InputDevice::MouseButton, static_cast<int>(mouse->button), 0, 1.0f, device.time};
+        } else if (const auto *mouse_up = event.getIf<sf::Event::MouseButtonReleased>()) {
+            device = {InputDevice::MouseButton, static_cast<int>(mouse_up->button), 0, 0.0f, device.time};
+        } else if (const auto *button = event.getIf<sf::Event::JoystickButtonPressed>()) {
+            device = {InputDevice::GamepadButton, static_cast<int>(button->button), static_cast<int>(button->joystickId), 1.0f, device.time};
+        } else if (const auto *button_up = event.getIf<sf::Event::JoystickButtonReleased>()) {
+            device = {InputDevice::GamepadButton, static_cast<int>(button_up->button), static_cast<int>(button_up->joystickId), 0.0f, device.time};
+        } else if (const auto *moved = event.getIf<sf::Event::JoystickMoved>()) {
+            device = {InputDevice::GamepadAxis, static_cast<int>(moved->axis), static_cast<int>(moved->joystickId), moved->position, device.time};
+        } else if (const auto *disconnected = event.getIf<sf::Event::JoystickDisconnected>()) {
+            // code -1: every button and axis of the joystick goes back to rest.
+            device = {InputDevice::GamepadButton, -1, static_cast<int>(disconnected->joystickId), 0.0f, device.time};
+        } else if (event.is<sf::Event::FocusLost>()) {
+            device.reset = true;
+        } else {
+            return;
         }
+        _queue.push_back(device);
     }
 
+    // Used by: scenes, once per update
     void InputManager::poll() {
-        // Update legacy enum-based pressed states using keyboard hard-coded bindings.
-        set_action_state(Action::MoveLeft,
-                         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left) || sf::Keyboard::isKeyPressed(
-                             sf::Keyboard::Key::A));
-        set_action_state(Action::MoveRight,
-                         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right) || sf::Keyboard::isKeyPressed(
-                             sf::Keyboard::Key::D));
-        set_action_state(Action::Jump,
-                         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) || sf::Keyboard::isKeyPressed(
-                             sf::Keyboard::Key::Up));
-        set_action_state(Action::Escape,
-                         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Escape));
-
-        // Map the H key to ToggleDebug action to show/hide bounding boxes
-        set_action_state(Action::ToggleDebug,
-                         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::H));
-
-        // Update named actions based on bindings.
-        for (auto &pair : _bindings) {
-            const std::string &name = pair.first;
-            bool anyActive = false;
-            for (auto const &b : pair.second) {
-                switch (b.device) {
-                    case InputDevice::Keyboard:
-                        if (b.code >= 0) {
-                            // SFML Key codes are int convertible from sf::Keyboard::Key
-                            if (sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Key>(b.code))) {
-                                anyActive = true;
-                            }
-                        }
-                        break;
-                    case InputDevice::MouseButton:
-                        if (sf::Mouse::isButtonPressed(static_cast<sf::Mouse::Button>(b.code))) {
-                            anyActive = true;
-                        }
-                        break;
-                    case InputDevice::GamepadButton:
-                        // SFML uses joystick button checks; joystickId -1 means any joystick
-                        if (b.joystickId < 0) {
-                            // check all connected joysticks
-                            for (unsigned i = 0; i < sf::Joystick::Count; ++i) {
-                                if (sf::Joystick::isConnected(i) && sf::Joystick::isButtonPressed(i, b.code)) {
-                                    anyActive = true;
-                                    break;
-                                }
-                            }
-                        } else {
-                            if (b.joystickId < static_cast<int>(sf::Joystick::Count) && sf::Joystick::isConnected(b.joystickId) && sf::Joystick::isButtonPressed(b.joystickId, b.code)) {
-                                anyActive = true;
-                            }
-                        }
-                        break;
-                    case InputDevice::GamepadAxis: {
-                        float pos = 0.f;
-                        if (b.joystickId < 0) {
-                            for (unsigned i = 0; i < sf::Joystick::Count; ++i) {
-                                if (!sf::Joystick::isConnected(i)) continue;
-                                pos = sf::Joystick::getAxisPosition(i, static_cast<sf::Joystick::Axis>(b.code));
-                                // SFML axis range is -100 .. 100
-                                float normalized = (b.axisPositive ? pos : -pos) / 100.f;
-                                if (normalized >= b.axisThreshold) {
-                                    anyActive = true;
-                                    break;
-                                }
-                            }
-                        } else {
-                            if (b.joystickId >= 0 && b.joystickId < static_cast<int>(sf::Joystick::Count) && sf::Joystick::isConnected(b.joystickId)) {
-                                pos = sf::Joystick::getAxisPosition(b.joystickId, static_cast<sf::Joystick::Axis>(b.code));
-                                float normalized = (b.axisPositive ? pos : -pos) / 100.f;
-                                if (normalized >= b.axisThreshold) {
-                                    anyActive = true;
-                                }
-                            }
-                        }
-                        break;
-                    }
-                    default:
-                        break;
-                }
-                if (anyActive) break;
-            }
-            // Update edge state maps
-            bool prev = _pressed_by_name[name];
-            _pressed_by_name[name] = anyActive;
-            _down_by_name[name] = (!prev && anyActive);
-            _released_by_name[name] = (prev && !anyActive);
+        _down.reset();
+        _released.reset();
+        for (const auto &event : _queue) {
+            apply(event);
         }
+        _queue.clear();
+    }
 
-        // If capturing, poll for a pressed key/button to capture.
+    void InputManager::apply(const DeviceEvent &event) {
+        if (event.reset) {
+            _keys.reset();
+            _mouse_buttons.reset();
+            _joystick_buttons = {};
+            _joystick_axes = {};
+            release_all(event.time);
+            return;
+        }
         if (_capturing) {
-            // Poll keyboard: SFML does not expose a portable KeyCount constant in all versions; use a reasonable upper bound.
-            const int maxKey = 256; // safe bound for key codes
-            for (int k = 0; k < maxKey; ++k) {
-                if (sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Key>(k))) {
-                    Binding b;
-                    b.device = InputDevice::Keyboard;
-                    b.code = k;
-                    _captured_pending = b;
-                    _capturing = false; // stop capturing after first event
-                    break;
-                }
-            }
-            // Poll mouse buttons: assume up to 8 buttons
-            if (!_captured_pending.has_value()) {
-                const int maxMouse = 8;
-                for (int m = 0; m < maxMouse; ++m) {
-                    if (sf::Mouse::isButtonPressed(static_cast<sf::Mouse::Button>(m))) {
-                        Binding b;
-                        b.device = InputDevice::MouseButton;
-                        b.code = m;
-                        _captured_pending = b;
-                        _capturing = false;
-                        break;
-                    }
-                }
-            }
-            // Poll joystick buttons
-            if (!_captured_pending.has_value()) {
-                for (unsigned jid = 0; jid < sf::Joystick::Count; ++jid) {
-                    if (!sf::Joystick::isConnected(jid)) continue;
-                    unsigned btnCount = sf::Joystick::getButtonCount(jid);
-                    for (unsigned bi = 0; bi < btnCount; ++bi) {
-                        if (sf::Joystick::isButtonPressed(jid, bi)) {
-                            Binding b;
-                            b.device = InputDevice::GamepadButton;
-                            b.code = static_cast<int>(bi);
-                            b.joystickId = static_cast<int>(jid);
-                            _captured_pending = b;
-                            _capturing = false;
-                            break;
+            capture(event);
+        }
+
+        const bool on = event.value != 0.0f;
+        switch (event.device) {
+            case InputDevice::Keyboard:
+                if (event.code < 0 || event.code >= static_cast<int>(sf::Keyboard::KeyCount)) return;
+                _keys.set(static_cast<std::size_t>(event.code), on);
+                update_bound(input_key(event.device, 0, event.code), event.time);
+                break;
+            case InputDevice::MouseButton:
+                if (event.code < 0 || event.code >= static_cast<int>(sf::Mouse::ButtonCount)) return;
+                _mouse_buttons.set(static_cast<std::size_t>(event.code), on);
+                update_bound(input_key(event.device, 0, event.code), event.time);
+                break;
+            case InputDevice::GamepadButton:
+            case InputDevice::GamepadAxis: {
+                if (event.joystick < 0 || event.joystick >= static_cast<int>(sf::Joystick::Count)) return;
+                const auto joystick = static_cast<std::size_t>(event.joystick);
+                if (event.code < 0) {
+                    // Disconnected: re-evaluate every gamepad binding of that joystick (rare).
+                    _joystick_buttons[joystick].reset();
+                    _joystick_axes[joystick] = {};
+                    for (auto &bound : _bound) {
+                        const auto device = bound.binding.device;
+                        if ((device == InputDevice::GamepadButton || device == InputDevice::GamepadAxis) &&
+                            (bound.binding.joystickId < 0 || bound.binding.joystickId == event.joystick)) {
+                            update_binding(bound, event.time);
                         }
                     }
-                    if (_captured_pending.has_value()) break;
+                    return;
+                }
+                if (event.device == InputDevice::GamepadButton) {
+                    if (event.code >= static_cast<int>(sf::Joystick::ButtonCount)) return;
+                    _joystick_buttons[joystick].set(static_cast<std::size_t>(event.code), on);
+                } else {
+                    if (event.code >= static_cast<int>(sf::Joystick::AxisCount)) return;
+                    _joystick_axes[joystick][static_cast<std::size_t>(event.code)] = event.value;
                 }
+                update_bound(input_key(event.device, event.joystick, event.code), event.time);
+                update_bound(input_key(event.device, -1, event.code), event.time);
+                break;
             }
-            // Poll joystick axes roughly: assume up to 8 axes
-            if (!_captured_pending.has_value()) {
-                const int maxAxes = 8;
-                for (unsigned jid = 0; jid < sf::Joystick::Count; ++jid) {
-                    if (!sf::Joystick::isConnected(jid)) continue;
-                    for (int axis = 0; axis < maxAxes; ++axis) {
-                        float pos = sf::Joystick::getAxisPosition(jid, static_cast<sf::Joystick::Axis>(axis));
-                        if (std::abs(pos) > 50.f) { // only capture if moved significantly
-                            Binding b;
-                            b.device = InputDevice::GamepadAxis;
-                            b.code = axis;
-                            b.joystickId = static_cast<int>(jid);
-                            b.axisPositive = pos > 0.f;
-                            b.axisThreshold = 0.5f;
-                            _captured_pending = b;
-                            _capturing = false;
-                            break;
-                        }
-                    }
-                    if (_captured_pending.has_value()) break;
+            default:
+                break;
+        }
+    }
+
+    // Turn the first press (or axis pushed past half way) into the captured binding.
+    void InputManager::capture(const DeviceEvent &event) {
+        if (event.code < 0) return;
+        Binding b;
+        b.device = event.device;
+        b.code = event.code;
+        if (event.device == InputDevice::GamepadAxis) {
+            if (std::abs(event.value) <= 50.f) return; // only capture if moved significantly
+            b.joystickId = event.joystick;
+            b.axisPositive = event.value > 0.f;
+            b.axisThreshold = 0.5f;
+        } else {
+            if (event.value == 0.0f) return;
+            if (event.device == InputDevice::GamepadButton) b.joystickId = event.joystick;
+        }
+        _captured_pending = b;
+        _capturing = false; // stop capturing after first event
+    }
+
+    void InputManager::update_bound(std::uint32_t key, sf::Time time) {
+        const auto it = _bound_by_input.find(key);
+        if (it == _bound_by_input.end()) return;
+        for (const std::uint32_t index : it->second) {
+            update_binding(_bound[index], time);
+        }
+    }
+
+    void InputManager::update_binding(BoundInput &bound, sf::Time time) {
+        const bool active = binding_active(bound.binding);
+        if (active == bound.active) return;
+        bound.active = active;
+        auto &count = _active_bindings[bound.action];
+        if (active) {
+            if (count++ == 0) set_held(bound.action, true, time);
+        } else if (count > 0 && --count == 0) {
+            set_held(bound.action, false, time);
+        }
+    }
+
+    void InputManager::set_held(ActionId action, bool held, sf::Time time) {
+        if (_held[action] == held) return;
+        _held.set(action, held);
+        (held ? _down : _released).set(action);
+        _changed_at[action] = time;
+    }
+
+    bool InputManager::binding_active(const Binding &b) const {
+        switch (b.device) {
+            case InputDevice::Keyboard:
+                return b.code >= 0 && b.code < static_cast<int>(sf::Keyboard::KeyCount) && _keys[static_cast<std::size_t>(b.code)];
+            case InputDevice::MouseButton:
+                return b.code >= 0 && b.code < static_cast<int>(sf::Mouse::ButtonCount) && _mouse_buttons[static_cast<std::size_t>(b.code)];
+            case InputDevice::GamepadButton:
+            case InputDevice::GamepadAxis: {
+                const bool axis = b.device == InputDevice::GamepadAxis;
+                const int limit = static_cast<int>(axis ? sf::Joystick::AxisCount : sf::Joystick::ButtonCount);
+                if (b.code < 0 || b.code >= limit) return false;
+                const auto code = static_cast<std::size_t>(b.code);
+                // joystickId -1 means any joystick
+                for (unsigned j = 0; j < sf::Joystick::Count; ++j) {
+                    if (b.joystickId >= 0 && static_cast<int>(j) != b.joystickId) continue;
+                    if (axis ? axis_active(b, _joystick_axes[j][code]) : _joystick_buttons[j][code]) return true;
                 }
+                return false;
             }
+            default:
+                return false;
+        }
+    }
+
+    void InputManager::release_all(sf::Time time) {
+        for (auto &bound : _bound) {
+            bound.active = false;
+        }
+        _active_bindings.fill(0);
+        for (std::size_t action = 0; action < _names.size(); ++action) {
+            set_held(static_cast<ActionId>(action), false, time);
+        }
+    }
+
+    void InputManager::rebuild_bindings() {
+        _bound.clear();
+        _bound_by_input.clear();
+        _active_bindings.fill(0);
+        for (std::size_t action = 0; action < _bindings.size(); ++action) {
+            for (const auto &binding : _bindings[action]) {
+                BoundInput bound{binding, static_cast<ActionId>(action), binding_active(binding)};
+                if (bound.active) ++_active_bindings[action];
+                _bound_by_input[input_key(binding.device, binding.joystickId, binding.code)].push_back(static_cast<std::uint32_t>(_bound.size()));
+                _bound.push_back(bound);
+            }
+        }
+        const sf::Time now = _clock.getElapsedTime();
+        for (std::size_t action = 0; action < _bindings.size(); ++action) {
+            set_held(static_cast<ActionId>(action), _active_bindings[action] > 0, now);
         }
     }
 
     bool InputManager::is_pressed(Action action) const {
-        return _pressed[static_cast<std::size_t>(action)];
+        return _held[static_cast<std::size_t>(action)];
+    }
+
+    bool InputManager::is_pressed(ActionId action) const {
+        return action < MAX_ACTIONS && _held[action];
+    }
+
+    bool InputManager::is_down(ActionId action) const {
+        return action < MAX_ACTIONS && _down[action];
+    }
+
+    bool InputManager::is_released(ActionId action) const {
+        return action < MAX_ACTIONS && _released[action];
+    }
+
+    sf::Time InputManager::last_change(ActionId action) const {
+        return action < MAX_ACTIONS ? _changed_at[action] : sf::Time::Zero;
     }
 
     bool InputManager::is_pressed(const std::string &action) const {
-        auto it = _pressed_by_name.find(action);
-        return it != _pressed_by_name.end() ? it->second : false;
+        return is_pressed(find_action(action));
     }
 
     bool InputManager::is_down(const std::string &action) const {
-        auto it = _down_by_name.find(action);
-        return it != _down_by_name.end() ? it->second : false;
+        return is_down(find_action(action));
     }
 
     bool InputManager::is_released(const std::string &action) const {
-        auto it = _released_by_name.find(action);
-        return it != _released_by_name.end() ? it->second : false;
+        return is_released(find_action(action));
     }
 
     std::vector<Binding> InputManager::get_bindings(const std::string &action) const {
-        auto it = _bindings.find(action);
-        if (it == _bindings.end()) return {};
-        return it->second;
+        const ActionId id = find_action(action);
+        if (id == INVALID_ACTION) return {};
+        return _bindings[id];
     }
 
     void InputManager::set_bindings(const std::string &action, const std::vector<Binding> &bindings) {
-        _bindings[action] = bindings;
+        const ActionId id = intern(action);
+        if (id == INVALID_ACTION) return;
+        _bindings[id] = bindings;
+        rebuild_bindings();
     }
 
     void InputManager::add_binding(const std::string &action, Binding const &binding) {
-        auto &vec = _bindings[action];
+        const ActionId id = intern(action);
+        if (id == INVALID_ACTION) return;
+        auto &vec = _bindings[id];
         // avoid duplicates
         for (auto const &b : vec) if (b == binding) return;
         vec.push_back(binding);
+        rebuild_bindings();
     }
 
     void InputManager::remove_binding(const std::string &action, Binding const &binding) {
-        auto it = _bindings.find(action);
-        if (it == _bindings.end()) return;
-        auto &vec = it->second;
+        const ActionId id = find_action(action);
+        if (id == INVALID_ACTION) return;
+        auto &vec = _bindings[id];
         vec.erase(std::remove_if(vec.begin(), vec.end(), [&](Binding const &b) { return b == binding; }), vec.end());
+        rebuild_bindings();
     }
 
     // Simple persistence format: one binding per line: action device code joystick axisPositive axisThreshold
@@ -231,7 +348,7 @@ namespace zia {
     void InputManager::load_bindings_from_file(const std::string &path) {
         std::ifstream in(path);
         if (!in) return; // no file: silently ignore
-        _bindings.clear();
+        std::map<ActionId, std::vector<Binding>> loaded;
         std::string line;
         while (std::getline(in, line)) {
             if (line.empty()) continue;
@@ -243,22 +360,28 @@ namespace zia {
             int axisPosInt;
             float thresh;
             if (!(ss >> action >> device >> code >> jid >> axisPosInt >> thresh)) continue;
+            const ActionId id = intern(action);
+            if (id == INVALID_ACTION) continue;
             Binding b;
             b.device = static_cast<InputDevice>(device);
             b.code = code;
             b.joystickId = jid;
             b.axisPositive = (axisPosInt != 0);
             b.axisThreshold = thresh;
-            _bindings[action].push_back(b);
+            loaded[id].push_back(b);
+        }
+        for (auto &pair : loaded) {
+            _bindings[pair.first] = std::move(pair.second);
         }
+        rebuild_bindings();
     }
 
     void InputManager::save_bindings_to_file(const std::string &path) const {
         std::ofstream out(path);
         if (!out) return;
-        for (auto const &pair : _bindings) {
-            const auto &action = pair.first;
-            for (auto const &b : pair.second) {
+        for (std::size_t id = 0; id < _bindings.size(); ++id) {
+            const auto &action = _names[id];
+            for (auto const &b : _bindings[id]) {
                 out << action << ' ' << static_cast<int>(b.device) << ' ' << b.code << ' '
                     << b.joystickId << ' ' << (b.axisPositive ? 1 : 0) << ' ' << b.axisThreshold << '\n';
             }
@@ -289,15 +412,15 @@ namespace zia {
         return std::nullopt;
     }
 
+    // Used by: scripted input (zia_bench)
     void InputManager::set_action_state(Action action, bool pressed) {
-        _pressed[static_cast<std::size_t>(action)] = pressed;
-        // also mirror into named action map if exists
-        const std::string name = action_to_name(action);
-        if (!name.empty() && name != "Unknown") {
-            bool prev = _pressed_by_name[name];
-            _pressed_by_name[name] = pressed;
-            _down_by_name[name] = (!prev && pressed);
-            _released_by_name[name] = (prev && !pressed);
+        const auto id = static_cast<std::size_t>(action);
+        const bool prev = _held[id];
+        _held.set(id, pressed);
+        _down.set(id, !prev && pressed);
+        _released.set(id, prev && !pressed);
+        if (prev != pressed) {
+            _changed_at[id] = _clock.getElapsedTime();
         }
     }
 
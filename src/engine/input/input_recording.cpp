@@ -0,0 +1,86 @@
+// Implements the .zrep input recording format and the InputRecorder decorator.
+
+#include "Zia/engine/input/InputRecording.hpp"
+#include "Zia/engine/input/InputRecorder.hpp"
+
+#include <fstream>
+#include <iostream>
+
+namespace zia::engine {
+    std::uint8_t action_bits(const IInput &input) {
+        std::uint8_t bits = 0;
+        for (int i = 0; i < static_cast<int>(zia::InputManager::Action::Count); ++i) {
+            if (input.is_pressed(static_cast<zia::InputManager::Action>(i))) {
+                bits |= static_cast<std::uint8_t>(1u << i);
+            }
+        }
+        return bits;
+    }
+
+    bool load_input_recording(const std::filesystem::path &path, InputRecording &out) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            std::cerr << "load_input_recording: cannot open '" << path.string() << "'" << std::endl;
+            return false;
+        }
+        InputRecordingHeader header;
+        if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) || header.magic != INPUT_RECORDING_MAGIC) {
+            std::cerr << "load_input_recording: '" << path.string() << "' is not an input recording" << std::endl;
+            return false;
+        }
+        if (header.version != INPUT_RECORDING_VERSION) {
+            std::cerr << "load_input_recording: '" << path.string() << "' has version " << header.version
+                      << ", expected " << INPUT_RECORDING_VERSION << std::endl;
+            return false;
+        }
+
+        InputRecording recording;
+        recording.seed = header.seed;
+        recording.dt = header.dt;
+        recording.final_state_hash = header.final_state_hash;
+        recording.level_path.resize(header.level_path_size);
+        recording.ticks.resize(header.tick_count);
+        in.read(recording.level_path.data(), static_cast<std::streamsize>(recording.level_path.size()));
+        in.read(reinterpret_cast<char *>(recording.ticks.data()), static_cast<std::streamsize>(recording.ticks.size()));
+        if (!in || recording.dt <= 0.0f) {
+            std::cerr << "load_input_recording: '" << path.string() << "' is truncated or corrupt" << std::endl;
+            return false;
+        }
+        out = std::move(recording);
+        return true;
+    }
+
+    bool save_input_recording(const std::filesystem::path &path, const InputRecording &recording) {
+        InputRecordingHeader header;
+        header.tick_count = static_cast<std::uint32_t>(recording.ticks.size());
+        header.seed = recording.seed;
+        header.dt = recording.dt;
+        header.level_path_size = static_cast<std::uint32_t>(recording.level_path.size());
+        header.final_state_hash = recording.final_state_hash;
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(recording.level_path.data(), static_cast<std::streamsize>(recording.level_path.size()));
+        out.write(reinterpret_cast<const char *>(recording.ticks.data()), static_cast<std::streamsize>(recording.ticks.size()));
+        if (!out) {
+            std::cerr << "save_input_recording: cannot write '" << path.string() << "'" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    InputRecorder::InputRecorder(std::shared_ptr<IInput> live, InputRecording recording, std::function<std::uint64_t()> state_hash)
+        : _live(std::move(live)), _recording(std::move(recording)), _state_hash(std::move(state_hash)) {
+        _recording.ticks.clear();
+    }
+
+    // Used by: PlayScene::handle_input (once per update)
+    void InputRecorder::poll() {
+        // Hash the state the previous ticks produced; the value from the last poll is what a replay checks.
+        if (_state_hash) {
+            _recording.final_state_hash = _state_hash();
+        }
+        _live->poll();
+        _recording.ticks.push_back(action_bits(*_live));
+    }
+} // namespace zia::engine
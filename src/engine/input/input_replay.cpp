@@ -0,0 +1,86 @@
+// Implements InputReplay, the IInput that plays back a .zrep recording.
+
+#include "Zia/engine/input/InputReplay.hpp"
+
+namespace zia::engine {
+    namespace {
+        constexpr auto ESCAPE_BIT = static_cast<std::uint8_t>(1u << static_cast<int>(zia::InputManager::Action::Escape));
+
+        // Id of the enum action called 'name', INVALID_ACTION for any other name.
+        zia::ActionId enum_action(std::string_view name) {
+            for (int i = 0; i < static_cast<int>(zia::InputManager::Action::Count); ++i) {
+                if (zia::InputManager::action_name(static_cast<zia::InputManager::Action>(i)) == name) {
+                    return static_cast<zia::ActionId>(i);
+                }
+            }
+            return zia::INVALID_ACTION;
+        }
+    }
+
+    InputReplay::InputReplay(InputRecording recording, std::function<std::uint64_t()> state_hash)
+        : _recording(std::move(recording)), _state_hash(std::move(state_hash)) {}
+
+    // Used by: PlayScene::handle_input (once per update)
+    void InputReplay::poll() {
+        _previous_bits = _bits;
+        const std::size_t tick = _tick;
+        if (finished()) {
+            _bits = ESCAPE_BIT;
+        } else {
+            // The recorder hashed the world when it polled its last tick; compare at the same point.
+            if (_tick + 1 == _recording.ticks.size() && _state_hash) {
+                _replayed_hash = _state_hash();
+                if (_recording.final_state_hash != 0) {
+                    _state_matches = _replayed_hash == _recording.final_state_hash;
+                }
+            }
+            _bits = _recording.ticks[_tick++];
+        }
+        const std::uint8_t changed = _bits ^ _previous_bits;
+        for (std::size_t i = 0; i < _changed_at.size(); ++i) {
+            if (changed & (1u << i)) {
+                _changed_at[i] = sf::seconds(static_cast<float>(tick) * _recording.dt);
+            }
+        }
+    }
+
+    bool InputReplay::is_pressed(zia::InputManager::Action action) const {
+        return bit(_bits, zia::InputManager::action_id(action));
+    }
+
+    bool InputReplay::bit(std::uint8_t bits, zia::ActionId action) {
+        return action < static_cast<zia::ActionId>(zia::InputManager::Action::Count) && (bits & (1u << action)) != 0;
+    }
+
+    zia::ActionId InputReplay::action_id(std::string_view name) {
+        return enum_action(name);
+    }
+
+    bool InputReplay::is_pressed(zia::ActionId action) const {
+        return bit(_bits, action);
+    }
+
+    bool InputReplay::is_down(zia::ActionId action) const {
+        return bit(_bits, action) && !bit(_previous_bits, action);
+    }
+
+    bool InputReplay::is_released(zia::ActionId action) const {
+        return !bit(_bits, action) && bit(_previous_bits, action);
+    }
+
+    sf::Time InputReplay::last_change(zia::ActionId action) const {
+        return action < _changed_at.size() ? _changed_at[action] : sf::Time::Zero;
+    }
+
+    bool InputReplay::is_pressed(const std::string &action) const {
+        return is_pressed(enum_action(action));
+    }
+
+    bool InputReplay::is_down(const std::string &action) const {
+        return is_down(enum_action(action));
+    }
+
+    bool InputReplay::is_released(const std::string &action) const {
+        return is_released(enum_action(action));
+    }
+} // namespace zia::engine
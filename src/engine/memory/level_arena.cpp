@@ -0,0 +1,33 @@
+#include "Zia/engine/memory/LevelArena.hpp"
+
+#include <algorithm>
+
+namespace zia::engine {
+    LevelArena::LevelArena(std::size_t block_bytes)
+        : _block_bytes(std::max<std::size_t>(block_bytes, 1)),
+          _block(new std::byte[_block_bytes]),
+          _buffer(std::in_place, _block.get(), _block_bytes, std::pmr::get_default_resource()),
+          // Last: the pool may already allocate its bookkeeping here.
+          _pool(this) {}
+
+    void *LevelArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+        _used += bytes;
+        return _buffer->allocate(bytes, alignment);
+    }
+
+    // Used by: Level::unload (and Level::load before refilling the level)
+    void LevelArena::reset() {
+        // The pool's blocks came from the arena: forget them before rewinding it.
+        _pool.release();
+        if (_used > _block_bytes) {
+            // The level overflowed into heap blocks; size the first block so it fits next time.
+            _buffer.reset();
+            _block_bytes = _used + _used / 4;
+            _block.reset(new std::byte[_block_bytes]);
+            _buffer.emplace(_block.get(), _block_bytes, std::pmr::get_default_resource());
+        } else {
+            _buffer->release();
+        }
+        _used = 0;
+    }
+} // namespace zia::engine
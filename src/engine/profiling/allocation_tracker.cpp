@@ -0,0 +1,151 @@
+// Implements the allocation counters and, when ZIA_TRACK_ALLOCATIONS is set, the replacement global
+// operator new/delete that feed them. Nothing here may allocate: the replacements are re-entered by
+// any allocation they make.
+
+#include "Zia/engine/profiling/AllocationTracker.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace zia::engine::allocation_tracker {
+    namespace {
+        // Trivially constructible, so they are usable from operator new at any point of a thread's life.
+        thread_local Counters t_counters;
+        thread_local int t_no_alloc_depth = 0;
+        thread_local const char* t_no_alloc_label = nullptr;
+
+        std::atomic<std::uint64_t> g_allocations{0};
+        std::atomic<std::uint64_t> g_frees{0};
+        std::atomic<std::uint64_t> g_bytes{0};
+
+#if ZIA_TRACK_ALLOCATIONS
+        void report_forbidden_allocation(std::size_t size) {
+            // Reporting must not trip the check again.
+            const int depth = t_no_alloc_depth;
+            t_no_alloc_depth = 0;
+            std::fprintf(stderr, "ZIA_ASSERT_NO_ALLOC(%s): allocation of %zu bytes\n",
+                         t_no_alloc_label ? t_no_alloc_label : "", size);
+            assert(!"allocation inside ZIA_ASSERT_NO_ALLOC");
+            t_no_alloc_depth = depth;
+        }
+
+        void count_allocation(std::size_t size) {
+            ++t_counters.allocations;
+            t_counters.bytes += size;
+            g_allocations.fetch_add(1, std::memory_order_relaxed);
+            g_bytes.fetch_add(size, std::memory_order_relaxed);
+            if (t_no_alloc_depth > 0) {
+                report_forbidden_allocation(size);
+            }
+        }
+
+        void count_free() {
+            ++t_counters.frees;
+            g_frees.fetch_add(1, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    Counters thread_counters() { return t_counters; }
+
+    Counters process_counters() {
+        Counters counters;
+        counters.allocations = g_allocations.load(std::memory_order_relaxed);
+        counters.frees = g_frees.load(std::memory_order_relaxed);
+        counters.bytes = g_bytes.load(std::memory_order_relaxed);
+        return counters;
+    }
+
+    NoAllocScope::NoAllocScope(const char* label) : _previous_label(t_no_alloc_label) {
+        ++t_no_alloc_depth;
+        t_no_alloc_label = label;
+    }
+
+    NoAllocScope::~NoAllocScope() {
+        --t_no_alloc_depth;
+        t_no_alloc_label = _previous_label;
+    }
+} // namespace zia::engine::allocation_tracker
+
+#if ZIA_TRACK_ALLOCATIONS
+namespace {
+    using zia::engine::allocation_tracker::count_allocation;
+    using zia::engine::allocation_tracker::count_free;
+
+    void* allocate(std::size_t size) {
+        count_allocation(size);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* allocate_aligned(std::size_t size, std::align_val_t align) {
+        count_allocation(size);
+        const auto alignment = static_cast<std::size_t>(align);
+#ifdef _WIN32
+        return _aligned_malloc(size == 0 ? 1 : size, alignment);
+#else
+        // aligned_alloc requires the size to be a multiple of the alignment.
+        const std::size_t rounded = ((size == 0 ? 1 : size) + alignment - 1) / alignment * alignment;
+        return std::aligned_alloc(alignment, rounded);
+#endif
+    }
+
+    void release(void* ptr) {
+        if (!ptr) return;
+        count_free();
+        std::free(ptr);
+    }
+
+    void release_aligned(void* ptr) {
+        if (!ptr) return;
+        count_free();
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* ptr = allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* ptr = allocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    if (void* ptr = allocate_aligned(size, align)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    if (void* ptr = allocate_aligned(size, align)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return allocate_aligned(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return allocate_aligned(size, align); }
+
+void operator delete(void* ptr) noexcept { release(ptr); }
+void operator delete[](void* ptr) noexcept { release(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { release(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { release(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { release(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { release_aligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { release_aligned(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { release_aligned(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { release_aligned(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { release_aligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { release_aligned(ptr); }
+#endif
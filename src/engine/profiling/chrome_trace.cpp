@@ -0,0 +1,102 @@
+// Implements the Chrome Trace Event writer for profiler frames.
+
+#include "Zia/engine/profiling/ChromeTrace.hpp"
+#include "Zia/engine/profiling/AllocationTracker.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+namespace zia::engine {
+    namespace {
+        // Scope names are literals, but thread names may come from anywhere.
+        void write_json_string(std::ofstream& out, const char* text) {
+            out << '"';
+            for (const char* c = text; *c; ++c) {
+                const auto ch = static_cast<unsigned char>(*c);
+                if (ch == '"' || ch == '\\') {
+                    out << '\\' << *c;
+                } else if (ch < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", ch);
+                    out << escaped;
+                } else {
+                    out << *c;
+                }
+            }
+            out << '"';
+        }
+
+        // Allocation counts are attached as event arguments when allocation tracking is built in.
+        void write_allocation_args(std::ofstream& out, std::uint64_t allocations, std::uint64_t bytes) {
+            if constexpr (allocation_tracker::compiled_in()) {
+                out << ",\"args\":{\"allocations\":" << allocations << ",\"alloc_bytes\":" << bytes << '}';
+            }
+        }
+
+        // Nanoseconds since 'origin' as fractional microseconds.
+        void write_timestamp(std::ofstream& out, std::int64_t ns, std::int64_t origin) {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(ns - origin) / 1000.0);
+            out << buffer;
+        }
+    }
+
+    // Used by: Profiler (frame captures, retained trace)
+    bool write_chrome_trace(const std::filesystem::path& path, const std::vector<const ProfileFrame*>& frames,
+                            const std::vector<std::string>& thread_names, std::uint16_t frame_lane) {
+        std::ofstream out(path, std::ios::trunc);
+        if (!out) {
+            std::cerr << "write_chrome_trace: cannot write '" << path.string() << "'" << std::endl;
+            return false;
+        }
+
+        const std::int64_t origin = frames.empty() ? 0 : frames.front()->begin_ns;
+        std::set<std::uint16_t> lanes{frame_lane};
+        bool first = true;
+        const auto separator = [&]() {
+            out << (first ? "\n" : ",\n");
+            first = false;
+        };
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        for (const ProfileFrame* frame : frames) {
+            separator();
+            out << "{\"name\":\"frame " << frame->index << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":" << frame_lane << ",\"ts\":";
+            write_timestamp(out, frame->begin_ns, origin);
+            out << ",\"dur\":";
+            write_timestamp(out, frame->end_ns, frame->begin_ns);
+            write_allocation_args(out, frame->allocations, frame->alloc_bytes);
+            out << '}';
+
+            for (const auto& sample : frame->samples) {
+                lanes.insert(sample.thread);
+                separator();
+                out << "{\"name\":";
+                write_json_string(out, sample.name);
+                out << ",\"cat\":\"scope\",\"ph\":\"X\",\"pid\":1,\"tid\":" << sample.thread << ",\"ts\":";
+                write_timestamp(out, sample.start_ns, origin);
+                out << ",\"dur\":";
+                write_timestamp(out, sample.end_ns, sample.start_ns);
+                write_allocation_args(out, sample.allocations, sample.alloc_bytes);
+                out << '}';
+            }
+        }
+
+        // Track names and order: lanes sorted by index, so the main thread comes first.
+        for (const std::uint16_t lane : lanes) {
+            const std::string name = lane < thread_names.size() ? thread_names[lane] : "thread " + std::to_string(lane);
+            separator();
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << lane << ",\"args\":{\"name\":";
+            write_json_string(out, name.c_str());
+            out << "}}";
+            separator();
+            out << "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":" << lane << ",\"args\":{\"sort_index\":" << lane << "}}";
+        }
+        separator();
+        out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Zia\"}}";
+        out << "\n]}\n";
+        return static_cast<bool>(out);
+    }
+} // namespace zia::engine
@@ -0,0 +1,318 @@
+// Implements the scoped-timer profiler: per-thread sample rings drained once per frame into a fixed
+// history of frame records.
+
+#include "Zia/engine/profiling/Profiler.hpp"
+#include "Zia/engine/profiling/ChromeTrace.hpp"
+#include "Zia/engine/profiling/AllocationTracker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+namespace zia::engine {
+    namespace {
+        // Nesting depth of the calling thread's open scopes.
+        thread_local std::uint16_t t_depth = 0;
+
+        bool same_name(const char* a, const char* b) {
+            return a == b || std::strcmp(a, b) == 0;
+        }
+    }
+
+    Profiler::Profiler() : _history(HISTORY_FRAMES), _frame_begin_ns(now_ns()) {}
+
+    Profiler& Profiler::instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    Profiler::ThreadRing& Profiler::thread_ring() {
+        // The lane table holds a reference too, so samples of a thread that has exited are still drained.
+        thread_local std::shared_ptr<ThreadRing> ring;
+        if (!ring) {
+            auto created = std::make_shared<ThreadRing>();
+            std::lock_guard<std::mutex> lock(_threads_mutex);
+            const auto free_lane = std::find(_threads.begin(), _threads.end(), nullptr);
+            created->index = static_cast<std::uint16_t>(free_lane - _threads.begin());
+            if (free_lane == _threads.end()) {
+                _threads.push_back(created);
+                _thread_names.emplace_back();
+            } else {
+                *free_lane = created;
+            }
+            _thread_names[created->index].clear();
+            ring = std::move(created);
+        }
+        return *ring;
+    }
+
+    void Profiler::set_thread_name(const char* name) {
+        const auto index = thread_ring().index;
+        std::lock_guard<std::mutex> lock(_threads_mutex);
+        _thread_names[index] = name ? name : "";
+    }
+
+    std::vector<std::string> Profiler::thread_names() const {
+        std::lock_guard<std::mutex> lock(_threads_mutex);
+        std::vector<std::string> names;
+        names.reserve(_thread_names.size());
+        for (std::size_t lane = 0; lane < _thread_names.size(); ++lane) {
+            names.push_back(_thread_names[lane].empty() ? "thread " + std::to_string(lane) : _thread_names[lane]);
+        }
+        return names;
+    }
+
+    std::uint64_t Profiler::dropped_samples() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    // Used by: ProfileScope (any thread)
+    void Profiler::record(const char* name, std::int64_t start_ns, std::int64_t end_ns, std::uint16_t depth,
+                          std::uint64_t allocations, std::uint64_t alloc_bytes) {
+        auto& ring = thread_ring();
+        const std::size_t head = ring.head.load(std::memory_order_relaxed);
+        const std::size_t next = (head + 1) % THREAD_RING_CAPACITY;
+        if (next == ring.tail.load(std::memory_order_acquire)) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        auto& sample = ring.samples[head];
+        sample.name = name;
+        sample.start_ns = start_ns;
+        sample.end_ns = end_ns;
+        sample.depth = depth;
+        sample.thread = ring.index;
+        sample.allocations = static_cast<std::uint32_t>(std::min<std::uint64_t>(allocations, UINT32_MAX));
+        sample.alloc_bytes = alloc_bytes;
+        ring.head.store(next, std::memory_order_release);
+    }
+
+    // Used by: Application::main_loop (once per frame)
+    void Profiler::mark_frame() {
+        const std::int64_t end_ns = now_ns();
+        const auto allocations = allocation_tracker::process_counters();
+
+        // Records are reused in place so their sample vectors keep their capacity.
+        ProfileFrame& frame = _history[_history_next];
+        frame.index = _frame_index++;
+        frame.begin_ns = _frame_begin_ns;
+        frame.end_ns = end_ns;
+        frame.allocations = allocations.allocations - _frame_begin_allocations;
+        frame.alloc_bytes = allocations.bytes - _frame_begin_alloc_bytes;
+        frame.samples.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(_threads_mutex);
+            drain_rings(frame.samples);
+        }
+        // Samples are pushed when a scope closes, so nested scopes arrive before their parents.
+        std::sort(frame.samples.begin(), frame.samples.end(), [](const ProfileSample& a, const ProfileSample& b) {
+            if (a.thread != b.thread) return a.thread < b.thread;
+            if (a.start_ns != b.start_ns) return a.start_ns < b.start_ns;
+            return a.depth < b.depth;
+        });
+
+        _history_next = (_history_next + 1) % HISTORY_FRAMES;
+        _frame_count = std::min(_frame_count + 1, HISTORY_FRAMES);
+        _frame_begin_ns = end_ns;
+        // Read before the bookkeeping below, so the frame's own trace copies count towards the next one.
+        _frame_begin_allocations = allocations.allocations;
+        _frame_begin_alloc_bytes = allocations.bytes;
+
+        if (_capture_count > 0 && frame.index >= _capture_first) {
+            _capture_frames.push_back(frame);
+            if (_capture_frames.size() >= _capture_count) {
+                finish_capture();
+            }
+        }
+        if (_retention_seconds > 0.0) {
+            retain_for_trace(frame);
+        }
+    }
+
+    void Profiler::drain_rings(std::vector<ProfileSample>& out) {
+        for (auto& ring : _threads) {
+            if (!ring) continue;
+            std::size_t tail = ring->tail.load(std::memory_order_relaxed);
+            const std::size_t head = ring->head.load(std::memory_order_acquire);
+            while (tail != head) {
+                out.push_back(ring->samples[tail]);
+                tail = (tail + 1) % THREAD_RING_CAPACITY;
+            }
+            ring->tail.store(tail, std::memory_order_release);
+            // Only the table still refers to the ring: its thread has exited (worker threads started
+            // with std::async come and go), and everything it recorded has just been drained.
+            if (ring.use_count() == 1) {
+                ring.reset();
+            }
+        }
+    }
+
+    void Profiler::retain_for_trace(const ProfileFrame& frame) {
+        ProfileFrame copy;
+        copy.index = frame.index;
+        copy.begin_ns = frame.begin_ns;
+        copy.end_ns = frame.end_ns;
+        copy.allocations = frame.allocations;
+        copy.alloc_bytes = frame.alloc_bytes;
+        if (!_spare_buffers.empty()) {
+            copy.samples = std::move(_spare_buffers.back());
+            _spare_buffers.pop_back();
+        }
+        copy.samples.assign(frame.samples.begin(), frame.samples.end());
+        _retained.push_back(std::move(copy));
+
+        const auto window_ns = static_cast<std::int64_t>(_retention_seconds * 1.0e9);
+        while (!_retained.empty() && _retained.front().end_ns < frame.end_ns - window_ns) {
+            _spare_buffers.push_back(std::move(_retained.front().samples));
+            _spare_buffers.back().clear();
+            _retained.pop_front();
+        }
+    }
+
+    // Used by: main (--trace-frames), ProfilerSystem (capture button)
+    void Profiler::capture_frames(std::uint64_t first_frame, std::size_t count, std::filesystem::path path) {
+        _capture_first = first_frame;
+        _capture_count = count;
+        _capture_path = std::move(path);
+        _capture_frames.clear();
+        _capture_frames.reserve(count);
+    }
+
+    void Profiler::finish_capture() {
+        std::vector<const ProfileFrame*> frames;
+        frames.reserve(_capture_frames.size());
+        for (const auto& frame : _capture_frames) frames.push_back(&frame);
+        if (write_chrome_trace(_capture_path, frames, thread_names(), MAIN_LANE)) {
+            std::cout << "Profiler: wrote " << frames.size() << " frames to " << _capture_path.string() << std::endl;
+        }
+        _capture_count = 0;
+        _capture_frames.clear();
+    }
+
+    // Used by: main (--trace-seconds)
+    void Profiler::set_trace_retention(double seconds) {
+        _retention_seconds = std::max(0.0, seconds);
+        if (_retention_seconds == 0.0) {
+            _retained.clear();
+            _spare_buffers.clear();
+        }
+    }
+
+    // Used by: ProfilerSystem (save button), finish_traces
+    bool Profiler::save_retained_trace(const std::filesystem::path& path) const {
+        std::vector<const ProfileFrame*> frames;
+        frames.reserve(_retained.size());
+        for (const auto& frame : _retained) frames.push_back(&frame);
+        if (!write_chrome_trace(path, frames, thread_names(), MAIN_LANE)) return false;
+        std::cout << "Profiler: wrote the last " << frames.size() << " frames to " << path.string() << std::endl;
+        return true;
+    }
+
+    // Used by: main (after the game loop)
+    void Profiler::finish_traces() {
+        if (_capture_count > 0 && !_capture_frames.empty()) {
+            finish_capture();
+        }
+        _capture_count = 0;
+        if (_retention_seconds > 0.0 && !_retention_exit_path.empty()) {
+            save_retained_trace(_retention_exit_path);
+        }
+    }
+
+    const ProfileFrame& Profiler::frame(std::size_t age) const {
+        // 'age' 0 is the oldest record still in the history.
+        const std::size_t oldest = (_history_next + HISTORY_FRAMES - _frame_count) % HISTORY_FRAMES;
+        return _history[(oldest + age) % HISTORY_FRAMES];
+    }
+
+    // Used by: ProfilerSystem (profiler window)
+    void Profiler::compute_stats(std::vector<ProfileScopeStats>& out) const {
+        out.clear();
+        // Per-scope time of every frame it ran in, parallel to 'out'.
+        std::vector<std::vector<double>> totals;
+        std::vector<std::uint64_t> allocation_totals;
+
+        for (std::size_t age = 0; age < _frame_count; ++age) {
+            const ProfileFrame& frame = this->frame(age);
+            const bool newest = age + 1 == _frame_count;
+            // Scopes whose total for this frame has already been started.
+            std::vector<bool> touched(totals.size(), false);
+
+            for (const auto& sample : frame.samples) {
+                std::size_t slot = 0;
+                while (slot < out.size() && !(out[slot].thread == sample.thread && same_name(out[slot].name, sample.name))) {
+                    ++slot;
+                }
+                if (slot == out.size()) {
+                    ProfileScopeStats stats;
+                    stats.name = sample.name;
+                    stats.thread = sample.thread;
+                    stats.depth = sample.depth;
+                    out.push_back(stats);
+                    totals.emplace_back();
+                    allocation_totals.push_back(0);
+                    touched.push_back(false);
+                }
+                const double ms = static_cast<double>(sample.end_ns - sample.start_ns) / 1.0e6;
+                if (!touched[slot]) {
+                    touched[slot] = true;
+                    totals[slot].push_back(ms);
+                } else {
+                    totals[slot].back() += ms;
+                }
+                out[slot].depth = std::min(out[slot].depth, sample.depth);
+                allocation_totals[slot] += sample.allocations;
+                if (newest) {
+                    ++out[slot].last_calls;
+                    out[slot].last_allocations += sample.allocations;
+                    out[slot].last_alloc_bytes += sample.alloc_bytes;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            auto& values = totals[i];
+            auto& stats = out[i];
+            stats.frames = values.size();
+            if (values.empty()) continue;
+            stats.last_ms = stats.last_calls > 0 ? values.back() : 0.0;
+            double sum = 0.0;
+            for (const double v : values) sum += v;
+            stats.avg_ms = sum / static_cast<double>(values.size());
+            stats.avg_allocations = static_cast<double>(allocation_totals[i]) / static_cast<double>(values.size());
+            std::sort(values.begin(), values.end());
+            stats.min_ms = values.front();
+            stats.max_ms = values.back();
+            const auto rank = static_cast<std::size_t>(std::ceil(0.99 * static_cast<double>(values.size())));
+            stats.p99_ms = values[std::min(values.size() - 1, rank > 0 ? rank - 1 : 0)];
+        }
+    }
+
+    ProfileScope::ProfileScope(const char* name) : _name(name) {
+        if (!Profiler::instance().enabled()) return;
+        _active = true;
+        if constexpr (allocation_tracker::compiled_in()) {
+            const auto counters = allocation_tracker::thread_counters();
+            _start_allocations = counters.allocations;
+            _start_alloc_bytes = counters.bytes;
+        }
+        _start_ns = Profiler::now_ns();
+        ++t_depth;
+    }
+
+    ProfileScope::~ProfileScope() {
+        if (!_active) return;
+        const std::int64_t end_ns = Profiler::now_ns();
+        std::uint64_t allocations = 0;
+        std::uint64_t alloc_bytes = 0;
+        if constexpr (allocation_tracker::compiled_in()) {
+            const auto counters = allocation_tracker::thread_counters();
+            allocations = counters.allocations - _start_allocations;
+            alloc_bytes = counters.bytes - _start_alloc_bytes;
+        }
+        --t_depth;
+        Profiler::instance().record(_name, _start_ns, end_ns, t_depth, allocations, alloc_bytes);
+    }
+} // namespace zia::engine
@@ -0,0 +1,158 @@
+// Implements the immediate-mode debug draw queue: geometry is accumulated into one line list
+// per frame and submitted with a single draw call.
+
+#include "Zia/engine/render/DebugDraw.hpp"
+
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace zia::engine::debug_draw {
+    namespace {
+        // Character size used for text markers.
+        constexpr unsigned int MARKER_TEXT_SIZE = 12;
+
+        struct TextMarker {
+            sf::Vector2f position;
+            std::string label;
+            sf::Color color;
+        };
+
+        // Per-frame queue. Debug drawing happens on the main thread only; the buffers keep their
+        // capacity between frames so a steady debug view does not allocate.
+        struct Queue {
+            bool enabled = false;
+            std::uint32_t channels = AllChannels;
+            std::vector<sf::Vertex> lines;
+            std::vector<TextMarker> markers;
+            std::size_t marker_count = 0;
+        };
+
+        Queue& queue() {
+            static Queue instance;
+            return instance;
+        }
+
+        void push_segment(Queue& q, sf::Vector2f from, sf::Vector2f to, sf::Color color) {
+            q.lines.push_back(sf::Vertex{from, color});
+            q.lines.push_back(sf::Vertex{to, color});
+        }
+    }
+
+    void set_enabled(bool enabled) {
+        auto& q = queue();
+        if (q.enabled && !enabled) {
+            clear();
+        }
+        q.enabled = enabled;
+    }
+
+    bool enabled() { return queue().enabled; }
+
+    void set_channels(std::uint32_t mask) { queue().channels = mask; }
+
+    std::uint32_t channels() { return queue().channels; }
+
+    bool active(Channel channel) {
+        const auto& q = queue();
+        return q.enabled && (q.channels & channel) != 0;
+    }
+
+    void line(sf::Vector2f from, sf::Vector2f to, sf::Color color) {
+        auto& q = queue();
+        if (!q.enabled) return;
+        push_segment(q, from, to, color);
+    }
+
+    void box(const sf::FloatRect& rect, sf::Color color) {
+        auto& q = queue();
+        if (!q.enabled) return;
+        const sf::Vector2f tl = rect.position;
+        const sf::Vector2f tr{rect.position.x + rect.size.x, rect.position.y};
+        const sf::Vector2f br = rect.position + rect.size;
+        const sf::Vector2f bl{rect.position.x, rect.position.y + rect.size.y};
+        push_segment(q, tl, tr, color);
+        push_segment(q, tr, br, color);
+        push_segment(q, br, bl, color);
+        push_segment(q, bl, tl, color);
+    }
+
+    void cross(sf::Vector2f center, float half_size, sf::Color color) {
+        auto& q = queue();
+        if (!q.enabled) return;
+        push_segment(q, {center.x - half_size, center.y}, {center.x + half_size, center.y}, color);
+        push_segment(q, {center.x, center.y - half_size}, {center.x, center.y + half_size}, color);
+    }
+
+    void arrow(sf::Vector2f origin, sf::Vector2f direction, float length, sf::Color color) {
+        auto& q = queue();
+        if (!q.enabled) return;
+        const float norm = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        if (norm <= 0.0f) return;
+        const sf::Vector2f d{direction.x / norm, direction.y / norm};
+        const sf::Vector2f tip{origin.x + d.x * length, origin.y + d.y * length};
+        push_segment(q, origin, tip, color);
+        // Arrow head: two short strokes folded back from the tip.
+        const float head = length * 0.3f;
+        const sf::Vector2f back{-d.x * head, -d.y * head};
+        const sf::Vector2f side{-d.y * head * 0.5f, d.x * head * 0.5f};
+        push_segment(q, tip, {tip.x + back.x + side.x, tip.y + back.y + side.y}, color);
+        push_segment(q, tip, {tip.x + back.x - side.x, tip.y + back.y - side.y}, color);
+    }
+
+    void text(sf::Vector2f position, std::string_view label, sf::Color color) {
+        auto& q = queue();
+        if (!q.enabled) return;
+        // Reuse marker slots (and their string capacity) from previous frames.
+        if (q.marker_count == q.markers.size()) {
+            q.markers.emplace_back();
+        }
+        auto& marker = q.markers[q.marker_count++];
+        marker.position = position;
+        marker.label.assign(label.data(), label.size());
+        marker.color = color;
+    }
+
+    std::size_t vertex_count() { return queue().lines.size(); }
+
+    void flush(IRenderer& renderer, float camera_x, float camera_y) {
+        auto& q = queue();
+        if (!q.enabled) {
+            clear();
+            return;
+        }
+
+        if (!q.lines.empty()) {
+            renderer.set_camera(camera_x, camera_y);
+            renderer.draw_lines(q.lines);
+        }
+
+        if (q.marker_count > 0) {
+            // Text is drawn in screen space: map world positions through the camera view, which
+            // stretches viewport_size() world units over the whole window.
+            const sf::Vector2f viewport = renderer.viewport_size();
+            const sf::Vector2f screen = renderer.window().getDefaultView().getSize();
+            if (viewport.x > 0.0f && viewport.y > 0.0f) {
+                const float sx = screen.x / viewport.x;
+                const float sy = screen.y / viewport.y;
+                for (std::size_t i = 0; i < q.marker_count; ++i) {
+                    const auto& marker = q.markers[i];
+                    const float x = (marker.position.x - camera_x) * sx;
+                    const float y = (marker.position.y - camera_y) * sy;
+                    if (x < 0.0f || y < 0.0f || x > screen.x || y > screen.y) continue;
+                    renderer.draw_text(marker.label, x, y, MARKER_TEXT_SIZE, marker.color);
+                }
+            }
+        }
+
+        clear();
+    }
+
+    void clear() {
+        auto& q = queue();
+        q.lines.clear();
+        q.marker_count = 0;
+    }
+} // namespace zia::engine::debug_draw
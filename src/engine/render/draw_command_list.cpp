@@ -0,0 +1,111 @@
+// Implements DrawCommandList: recording storage and replay of per-frame draw commands.
+
+#include "Zia/engine/render/DrawCommandList.hpp"
+
+namespace zia::engine {
+    void DrawCommandList::clear() {
+        _commands.clear();
+        _string_count = 0;
+        _vertex_batch_count = 0;
+    }
+
+    DrawCommand& DrawCommandList::push(DrawCommand::Type type) {
+        auto& command = _commands.emplace_back();
+        command.type = type;
+        return command;
+    }
+
+    std::uint32_t DrawCommandList::store_string(std::string_view text) {
+        // Reuse an existing string slot when possible so its capacity survives between frames.
+        if (_string_count == _strings.size()) {
+            _strings.emplace_back();
+        }
+        _strings[_string_count].assign(text.data(), text.size());
+        return static_cast<std::uint32_t>(_string_count++);
+    }
+
+    std::string_view DrawCommandList::string_at(std::uint32_t index) const {
+        if (index >= _string_count) {
+            return {};
+        }
+        return _strings[index];
+    }
+
+    std::uint32_t DrawCommandList::store_vertices(const std::vector<sf::Vertex>& vertices) {
+        if (_vertex_batch_count == _vertex_batches.size()) {
+            _vertex_batches.emplace_back();
+        }
+        _vertex_batches[_vertex_batch_count].assign(vertices.begin(), vertices.end());
+        return static_cast<std::uint32_t>(_vertex_batch_count++);
+    }
+
+    void DrawCommandList::replay(IRenderer& target, std::vector<TextHandle>& text_handles) const {
+        // Map a recorder-side text handle to the target's handle (INVALID when unknown).
+        auto target_text = [&text_handles](TextHandle handle) {
+            return handle < text_handles.size() ? text_handles[handle] : INVALID_TEXT_HANDLE;
+        };
+
+        for (const auto& command : _commands) {
+            switch (command.type) {
+                case DrawCommand::Type::SetCamera:
+                    target.set_camera(command.x, command.y);
+                    break;
+                case DrawCommand::Type::Rect:
+                    target.draw_rect(command.x, command.y, command.width, command.height, command.color);
+                    break;
+                case DrawCommand::Type::Ellipse:
+                    target.draw_ellipse(command.x, command.y, command.width, command.height, command.color);
+                    break;
+                case DrawCommand::Type::BBox:
+                    target.draw_bbox(command.x, command.y, command.width, command.height, command.color, command.thickness);
+                    break;
+                case DrawCommand::Type::Sprite:
+                    if (command.texture) {
+                        target.draw_sprite(command.texture->get(), command.x, command.y, command.width, command.height, command.texture_rect);
+                    }
+                    break;
+                case DrawCommand::Type::ScreenSprite:
+                    if (command.texture) {
+                        target.draw_screen_sprite(command.texture->get(), command.x, command.y, command.width, command.height, command.texture_rect);
+                    }
+                    break;
+                case DrawCommand::Type::Lines:
+                    if (command.vertex_batch < _vertex_batch_count) {
+                        target.draw_lines(_vertex_batches[command.vertex_batch]);
+                    }
+                    break;
+                case DrawCommand::Type::Text: {
+                    // draw_text takes a std::string; reuse one buffer instead of allocating per command.
+                    static thread_local std::string scratch;
+                    scratch.assign(string_at(command.string_index));
+                    target.draw_text(scratch, command.x, command.y, command.text_size, command.color);
+                    break;
+                }
+                case DrawCommand::Type::CreateText:
+                    if (command.text >= text_handles.size()) {
+                        text_handles.resize(command.text + 1, INVALID_TEXT_HANDLE);
+                    }
+                    text_handles[command.text] = target.create_text();
+                    break;
+                case DrawCommand::Type::UpdateText:
+                    target.update_text(target_text(command.text), string_at(command.string_index), command.x, command.y, command.text_size, command.color);
+                    break;
+                case DrawCommand::Type::DestroyText:
+                    target.destroy_text(target_text(command.text));
+                    if (command.text < text_handles.size()) {
+                        text_handles[command.text] = INVALID_TEXT_HANDLE;
+                    }
+                    break;
+                case DrawCommand::Type::SubmitText:
+                    target.submit_text(target_text(command.text));
+                    break;
+                case DrawCommand::Type::FlushText:
+                    target.flush_text();
+                    break;
+                case DrawCommand::Type::SetVsync:
+                    target.set_vsync(command.x != 0.0f);
+                    break;
+            }
+        }
+    }
+} // namespace zia::engine
@@ -0,0 +1,663 @@
+// Implements RecordingRenderer: a headless IRenderer that logs draw calls into a compact binary
+// command log, gathers per-frame statistics and replays the log onto another renderer. Logs can be
+// saved to and loaded from files, textures being stored as asset ids.
+
+#include "Zia/engine/render/RecordingRenderer.hpp"
+#include "Zia/engine/IAssetManager.hpp"
+#include "Zia/game/helpers/Constants.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include <type_traits>
+
+namespace zia::engine {
+    namespace {
+        // Pseudo texture slot for the font atlas used by text draws.
+        constexpr std::uint32_t FONT_TEXTURE = 0xFFFFFFFEu;
+
+        constexpr std::uint32_t LOG_MAGIC = 0x474C525Au; // "ZRLG"
+        constexpr std::uint32_t LOG_VERSION = 1;
+
+        struct LogFileHeader {
+            std::uint32_t magic = LOG_MAGIC;
+            std::uint32_t version = LOG_VERSION;
+            std::uint32_t string_count = 0;
+            std::uint32_t texture_count = 0;
+            std::uint64_t frame_count = 0;
+            std::uint64_t log_bytes = 0;
+        };
+
+        // One completed frame in the file's frame table.
+        struct FrameRecord {
+            std::uint64_t begin = 0;
+            std::uint64_t end = 0;
+            RecordingRenderer::FrameStats stats;
+        };
+
+        template <typename T>
+        void write_value(std::ostream& out, const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>, "log values must be trivially copyable");
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool read_value(std::istream& in, T& value) {
+            static_assert(std::is_trivially_copyable_v<T>, "log values must be trivially copyable");
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+
+        // Sequential reader over the binary log.
+        class LogReader {
+        public:
+            LogReader(const std::vector<std::uint8_t>& log, std::size_t begin, std::size_t end)
+                : _log(log), _pos(begin), _end(end) {}
+
+            [[nodiscard]] bool done() const { return _pos >= _end; }
+
+            template <typename T>
+            T read() {
+                static_assert(std::is_trivially_copyable_v<T>, "log values must be trivially copyable");
+                T value{};
+                std::memcpy(&value, _log.data() + _pos, sizeof(T));
+                _pos += sizeof(T);
+                return value;
+            }
+
+            sf::Color read_color() {
+                const auto packed = read<std::uint32_t>();
+                return sf::Color(static_cast<std::uint8_t>(packed >> 24), static_cast<std::uint8_t>(packed >> 16),
+                                 static_cast<std::uint8_t>(packed >> 8), static_cast<std::uint8_t>(packed));
+            }
+
+            sf::IntRect read_rect() {
+                const auto x = read<std::int32_t>();
+                const auto y = read<std::int32_t>();
+                const auto w = read<std::int32_t>();
+                const auto h = read<std::int32_t>();
+                return sf::IntRect({x, y}, {w, h});
+            }
+
+        private:
+            const std::vector<std::uint8_t>& _log;
+            std::size_t _pos;
+            std::size_t _end;
+        };
+    }
+
+    RecordingRenderer::RecordingRenderer(sf::Vector2u virtual_window_size)
+        : _virtual_window_size(virtual_window_size),
+          _camera_scale(zia::constants::TILE_SCALE * zia::constants::CAMERA_SCALE) {
+        // Slot 0 is reserved so that INVALID_TEXT_HANDLE never refers to a live text.
+        _text_alive.push_back(false);
+    }
+
+    template <typename T>
+    void RecordingRenderer::write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "log values must be trivially copyable");
+        const auto offset = _log.size();
+        _log.resize(offset + sizeof(T));
+        std::memcpy(_log.data() + offset, &value, sizeof(T));
+    }
+
+    void RecordingRenderer::write_op(Op op) {
+        write(static_cast<std::uint8_t>(op));
+        if (op != Op::BeginFrame && op != Op::EndFrame) {
+            ++_current.commands;
+        }
+    }
+
+    void RecordingRenderer::write_color(sf::Color color) {
+        write((static_cast<std::uint32_t>(color.r) << 24) | (static_cast<std::uint32_t>(color.g) << 16) |
+              (static_cast<std::uint32_t>(color.b) << 8) | static_cast<std::uint32_t>(color.a));
+    }
+
+    void RecordingRenderer::write_rect(const sf::IntRect& rect) {
+        write(static_cast<std::int32_t>(rect.position.x));
+        write(static_cast<std::int32_t>(rect.position.y));
+        write(static_cast<std::int32_t>(rect.size.x));
+        write(static_cast<std::int32_t>(rect.size.y));
+    }
+
+    std::uint32_t RecordingRenderer::texture_slot(const sf::Texture& texture) {
+        const auto it = _texture_slots.find(&texture);
+        if (it != _texture_slots.end()) {
+            return it->second;
+        }
+        const auto slot = static_cast<std::uint32_t>(_textures.size());
+        _textures.push_back(&texture);
+        _texture_slots.emplace(&texture, slot);
+        return slot;
+    }
+
+    std::uint32_t RecordingRenderer::string_slot(std::string_view text) {
+        std::string key(text);
+        const auto it = _string_slots.find(key);
+        if (it != _string_slots.end()) {
+            return it->second;
+        }
+        const auto slot = static_cast<std::uint32_t>(_strings.size());
+        _strings.push_back(key);
+        _string_slots.emplace(std::move(key), slot);
+        return slot;
+    }
+
+    void RecordingRenderer::note_draw(std::uint32_t texture) {
+        ++_current.draws;
+        if (texture != _bound_texture) {
+            ++_current.texture_switches;
+            _bound_texture = texture;
+        }
+    }
+
+    void RecordingRenderer::note_world_space() {
+        if (_screen_space) {
+            ++_current.view_switches;
+            _screen_space = false;
+        }
+    }
+
+    void RecordingRenderer::note_screen_space() {
+        if (!_screen_space) {
+            ++_current.view_switches;
+            _screen_space = true;
+        }
+    }
+
+    bool RecordingRenderer::save_log(const std::filesystem::path& path, const IAssetManager& assets) const {
+        std::ofstream out(path, std::ios::binary);
+        if (!out) {
+            std::cerr << "RecordingRenderer: cannot write log '" << path.string() << "'" << std::endl;
+            return false;
+        }
+
+        LogFileHeader header;
+        header.string_count = static_cast<std::uint32_t>(_strings.size());
+        header.texture_count = static_cast<std::uint32_t>(_textures.size());
+        header.frame_count = _frame_ranges.size();
+        header.log_bytes = _log.size();
+        write_value(out, header);
+
+        for (const auto& text : _strings) {
+            write_value(out, static_cast<std::uint32_t>(text.size()));
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+        for (const auto* texture : _textures) {
+            write_value(out, static_cast<std::int32_t>(texture ? assets.find_texture_id(*texture) : -1));
+        }
+        for (std::size_t i = 0; i < _frame_ranges.size(); ++i) {
+            write_value(out, FrameRecord{_frame_ranges[i].first, _frame_ranges[i].second, _frames[i]});
+        }
+        out.write(reinterpret_cast<const char*>(_log.data()), static_cast<std::streamsize>(_log.size()));
+        return static_cast<bool>(out);
+    }
+
+    bool RecordingRenderer::load_log(const std::filesystem::path& path, const IAssetManager& assets) {
+        clear();
+        std::error_code ec;
+        const auto file_size = std::filesystem::file_size(path, ec);
+        std::ifstream in(path, std::ios::binary);
+        if (ec || !in) {
+            std::cerr << "RecordingRenderer: cannot read log '" << path.string() << "'" << std::endl;
+            return false;
+        }
+        auto invalid = [&] {
+            std::cerr << "RecordingRenderer: '" << path.string() << "' is not a valid v" << LOG_VERSION << " render log" << std::endl;
+            clear();
+            return false;
+        };
+
+        // Counts are checked against the file size before anything is allocated for them.
+        LogFileHeader header;
+        if (!read_value(in, header) || header.magic != LOG_MAGIC || header.version != LOG_VERSION ||
+            header.string_count > file_size || header.texture_count > file_size ||
+            header.frame_count > file_size / sizeof(FrameRecord) || header.log_bytes > file_size) {
+            return invalid();
+        }
+
+        _strings.reserve(header.string_count);
+        for (std::uint32_t i = 0; i < header.string_count; ++i) {
+            std::uint32_t length = 0;
+            if (!read_value(in, length) || length > file_size) return invalid();
+            std::string text(length, '\0');
+            if (!in.read(text.data(), static_cast<std::streamsize>(length))) return invalid();
+            _string_slots.emplace(text, i);
+            _strings.push_back(std::move(text));
+        }
+
+        _textures.reserve(header.texture_count);
+        for (std::uint32_t i = 0; i < header.texture_count; ++i) {
+            std::int32_t id = -1;
+            if (!read_value(in, id)) return invalid();
+            auto texture = id >= 0 ? assets.get_texture(id) : nullptr;
+            _textures.push_back(texture.get());
+            if (texture) {
+                _texture_slots.emplace(texture.get(), i);
+                _loaded_textures.push_back(std::move(texture));
+            }
+        }
+
+        _frame_ranges.reserve(static_cast<std::size_t>(header.frame_count));
+        _frames.reserve(static_cast<std::size_t>(header.frame_count));
+        for (std::uint64_t i = 0; i < header.frame_count; ++i) {
+            FrameRecord record;
+            if (!read_value(in, record)) return invalid();
+            _frame_ranges.emplace_back(static_cast<std::size_t>(record.begin), static_cast<std::size_t>(record.end));
+            _frames.push_back(record.stats);
+        }
+
+        _log.resize(static_cast<std::size_t>(header.log_bytes));
+        if (!in.read(reinterpret_cast<char*>(_log.data()), static_cast<std::streamsize>(_log.size())) || !validate_log()) {
+            return invalid();
+        }
+        _frame_begin = _log.size();
+        return true;
+    }
+
+    bool RecordingRenderer::validate_log() const {
+        // starts[i]: a command begins at byte i (the end of the log counts as one).
+        std::vector<bool> starts(_log.size() + 1, false);
+        std::size_t pos = 0;
+        auto read_u32 = [this](std::size_t at) {
+            std::uint32_t value = 0;
+            std::memcpy(&value, _log.data() + at, sizeof(value));
+            return value;
+        };
+        while (pos < _log.size()) {
+            starts[pos] = true;
+            const auto raw = _log[pos++];
+            if (raw > static_cast<std::uint8_t>(Op::Lines)) return false;
+            const auto remaining = _log.size() - pos;
+            std::size_t payload = 0;
+            switch (static_cast<Op>(raw)) {
+                case Op::BeginFrame:
+                case Op::EndFrame:
+                case Op::FlushText:
+                    break;
+                case Op::SetCamera:
+                    payload = 2 * sizeof(float);
+                    break;
+                case Op::Rect:
+                case Op::Ellipse:
+                    payload = 4 * sizeof(float) + sizeof(std::uint32_t);
+                    break;
+                case Op::BBox:
+                    payload = 5 * sizeof(float) + sizeof(std::uint32_t);
+                    break;
+                case Op::Sprite:
+                case Op::ScreenSprite:
+                    payload = sizeof(std::uint32_t) + 4 * sizeof(float) + 4 * sizeof(std::int32_t);
+                    if (remaining < payload || read_u32(pos) >= _textures.size()) return false;
+                    break;
+                case Op::Text:
+                    payload = sizeof(std::uint32_t) + 2 * sizeof(float) + 2 * sizeof(std::uint32_t);
+                    if (remaining < payload || read_u32(pos) >= _strings.size()) return false;
+                    break;
+                case Op::CreateText:
+                case Op::DestroyText:
+                case Op::SubmitText:
+                    payload = sizeof(TextHandle);
+                    break;
+                case Op::UpdateText:
+                    payload = sizeof(TextHandle) + sizeof(std::uint32_t) + 2 * sizeof(float) + 2 * sizeof(std::uint32_t);
+                    if (remaining < payload || read_u32(pos + sizeof(TextHandle)) >= _strings.size()) return false;
+                    break;
+                case Op::Lines: {
+                    if (remaining < sizeof(std::uint32_t)) return false;
+                    const std::uint64_t count = read_u32(pos);
+                    const std::uint64_t vertex_bytes = 2 * sizeof(float) + sizeof(std::uint32_t);
+                    if (count > (remaining - sizeof(std::uint32_t)) / vertex_bytes) return false;
+                    payload = sizeof(std::uint32_t) + static_cast<std::size_t>(count * vertex_bytes);
+                    break;
+                }
+            }
+            if (remaining < payload) return false;
+            pos += payload;
+        }
+        starts[_log.size()] = true;
+
+        for (const auto& [begin, end] : _frame_ranges) {
+            if (begin >= end || end > _log.size() || !starts[begin] || !starts[end] ||
+                _log[begin] != static_cast<std::uint8_t>(Op::BeginFrame)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void RecordingRenderer::clear() {
+        _log.clear();
+        _frame_ranges.clear();
+        _frame_begin = 0;
+        _textures.clear();
+        _texture_slots.clear();
+        _loaded_textures.clear();
+        _strings.clear();
+        _string_slots.clear();
+        _frames.clear();
+        _current = FrameStats{};
+    }
+
+    void RecordingRenderer::begin_frame() {
+        _frame_begin = _log.size();
+        _current = FrameStats{};
+        write_op(Op::BeginFrame);
+    }
+
+    void RecordingRenderer::end_frame() {
+        write_op(Op::EndFrame);
+        _frame_ranges.emplace_back(_frame_begin, _log.size());
+        _frames.push_back(_current);
+    }
+
+    void RecordingRenderer::set_camera(float x, float y) {
+        write_op(Op::SetCamera);
+        write(x);
+        write(y);
+        // The real renderer calls setView on every set_camera, even for an unchanged position.
+        ++_current.view_switches;
+        _screen_space = false;
+    }
+
+    sf::Vector2f RecordingRenderer::viewport_size() const {
+        // Same computation as zia::Renderer, using the virtual window size.
+        const float w = static_cast<float>(_virtual_window_size.x);
+        const float h = static_cast<float>(static_cast<int>(_virtual_window_size.y) - _top_inset_pixels);
+        if (_camera_tiles_w > 0.0f) {
+            const float world_w = _camera_tiles_w * static_cast<float>(zia::constants::TILE_SIZE);
+            const float aspect = h > 0.0f ? (w / h) : 1.0f;
+            return {world_w, world_w / aspect};
+        }
+        return {w * _camera_scale, h * _camera_scale};
+    }
+
+    void RecordingRenderer::draw_rect(float x, float y, float width, float height, sf::Color color) {
+        write_op(Op::Rect);
+        write(x);
+        write(y);
+        write(width);
+        write(height);
+        write_color(color);
+        note_world_space();
+        note_draw(NO_TEXTURE);
+    }
+
+    void RecordingRenderer::draw_sprite(const sf::Texture& texture, float x, float y, float width, float height, const sf::IntRect& texture_rect) {
+        const auto slot = texture_slot(texture);
+        write_op(Op::Sprite);
+        write(slot);
+        write(x);
+        write(y);
+        write(width);
+        write(height);
+        write_rect(texture_rect);
+        note_world_space();
+        note_draw(slot);
+        ++_current.sprite_draws;
+    }
+
+    void RecordingRenderer::draw_sprite(int sprite_id, float x, float y) {
+        // The real renderer does not implement id-based sprites yet; nothing to record.
+        (void) sprite_id;
+        (void) x;
+        (void) y;
+    }
+
+    void RecordingRenderer::draw_screen_sprite(const sf::Texture& texture, float x, float y, float scale_x, float scale_y, const sf::IntRect& texture_rect) {
+        const auto slot = texture_slot(texture);
+        write_op(Op::ScreenSprite);
+        write(slot);
+        write(x);
+        write(y);
+        write(scale_x);
+        write(scale_y);
+        write_rect(texture_rect);
+        note_screen_space();
+        note_draw(slot);
+        ++_current.sprite_draws;
+    }
+
+    void RecordingRenderer::draw_text(const std::string& text, float x, float y, unsigned int size, sf::Color color) {
+        const auto slot = string_slot(text);
+        write_op(Op::Text);
+        write(slot);
+        write(x);
+        write(y);
+        write(static_cast<std::uint32_t>(size));
+        write_color(color);
+        // Immediate text is drawn with the UI batch in screen space.
+        note_screen_space();
+        note_draw(FONT_TEXTURE);
+        ++_current.text_draws;
+    }
+
+    void RecordingRenderer::draw_ellipse(float x, float y, float width, float height, sf::Color color) {
+        write_op(Op::Ellipse);
+        write(x);
+        write(y);
+        write(width);
+        write(height);
+        write_color(color);
+        note_world_space();
+        note_draw(NO_TEXTURE);
+    }
+
+    void RecordingRenderer::draw_bbox(float x, float y, float width, float height, sf::Color color, float thickness) {
+        write_op(Op::BBox);
+        write(x);
+        write(y);
+        write(width);
+        write(height);
+        write_color(color);
+        write(thickness);
+        note_world_space();
+        note_draw(NO_TEXTURE);
+    }
+
+    void RecordingRenderer::draw_lines(const std::vector<sf::Vertex>& vertices) {
+        if (vertices.empty()) {
+            return;
+        }
+        write_op(Op::Lines);
+        write(static_cast<std::uint32_t>(vertices.size()));
+        for (const auto& vertex : vertices) {
+            write(vertex.position.x);
+            write(vertex.position.y);
+            write_color(vertex.color);
+        }
+        // The whole line list is one draw call, however many segments it holds.
+        note_world_space();
+        note_draw(NO_TEXTURE);
+    }
+
+    TextHandle RecordingRenderer::create_text() {
+        TextHandle handle;
+        if (!_free_texts.empty()) {
+            handle = _free_texts.back();
+            _free_texts.pop_back();
+            _text_alive[handle] = true;
+        } else {
+            handle = static_cast<TextHandle>(_text_alive.size());
+            _text_alive.push_back(true);
+        }
+        write_op(Op::CreateText);
+        write(handle);
+        return handle;
+    }
+
+    void RecordingRenderer::update_text(TextHandle handle, std::string_view text, float x, float y, unsigned int size, sf::Color color) {
+        if (handle >= _text_alive.size() || !_text_alive[handle]) {
+            return;
+        }
+        const auto slot = string_slot(text);
+        write_op(Op::UpdateText);
+        write(handle);
+        write(slot);
+        write(x);
+        write(y);
+        write(static_cast<std::uint32_t>(size));
+        write_color(color);
+    }
+
+    void RecordingRenderer::destroy_text(TextHandle handle) {
+        if (handle >= _text_alive.size() || !_text_alive[handle]) {
+            return;
+        }
+        _text_alive[handle] = false;
+        _free_texts.push_back(handle);
+        write_op(Op::DestroyText);
+        write(handle);
+    }
+
+    void RecordingRenderer::submit_text(TextHandle handle) {
+        if (handle >= _text_alive.size() || !_text_alive[handle]) {
+            return;
+        }
+        write_op(Op::SubmitText);
+        write(handle);
+        note_screen_space();
+        note_draw(FONT_TEXTURE);
+        ++_current.text_draws;
+    }
+
+    void RecordingRenderer::flush_text() {
+        write_op(Op::FlushText);
+    }
+
+    void RecordingRenderer::replay(IRenderer& target) const {
+        replay_range(0, _log.size(), target);
+    }
+
+    void RecordingRenderer::replay_frame(std::size_t frame, IRenderer& target) const {
+        if (frame >= _frame_ranges.size()) {
+            return;
+        }
+        replay_range(_frame_ranges[frame].first, _frame_ranges[frame].second, target);
+    }
+
+    void RecordingRenderer::replay_range(std::size_t begin, std::size_t end, IRenderer& target) const {
+        // Recorder text handle -> target text handle. Texts first seen mid-log (e.g. when replaying a
+        // single frame) are created on demand; everything created here is destroyed at the end.
+        std::unordered_map<TextHandle, TextHandle> texts;
+        auto target_text = [&](TextHandle handle) {
+            auto it = texts.find(handle);
+            if (it == texts.end()) {
+                it = texts.emplace(handle, target.create_text()).first;
+            }
+            return it->second;
+        };
+        auto texture_at = [this](std::uint32_t slot) { return _textures[slot]; };
+        std::string scratch;
+        std::vector<sf::Vertex> lines;
+
+        LogReader reader(_log, begin, end);
+        while (!reader.done()) {
+            const auto op = static_cast<Op>(reader.read<std::uint8_t>());
+            switch (op) {
+                case Op::BeginFrame:
+                    target.begin_frame();
+                    break;
+                case Op::EndFrame:
+                    target.end_frame();
+                    break;
+                case Op::SetCamera: {
+                    const auto x = reader.read<float>();
+                    const auto y = reader.read<float>();
+                    target.set_camera(x, y);
+                    break;
+                }
+                case Op::Rect:
+                case Op::Ellipse:
+                case Op::BBox: {
+                    const auto x = reader.read<float>();
+                    const auto y = reader.read<float>();
+                    const auto w = reader.read<float>();
+                    const auto h = reader.read<float>();
+                    const auto color = reader.read_color();
+                    if (op == Op::Rect) {
+                        target.draw_rect(x, y, w, h, color);
+                    } else if (op == Op::Ellipse) {
+                        target.draw_ellipse(x, y, w, h, color);
+                    } else {
+                        target.draw_bbox(x, y, w, h, color, reader.read<float>());
+                    }
+                    break;
+                }
+                case Op::Sprite:
+                case Op::ScreenSprite: {
+                    const auto slot = reader.read<std::uint32_t>();
+                    const auto x = reader.read<float>();
+                    const auto y = reader.read<float>();
+                    const auto w = reader.read<float>();
+                    const auto h = reader.read<float>();
+                    const auto rect = reader.read_rect();
+                    // Null for textures a loaded log could not rebind.
+                    const sf::Texture* texture = texture_at(slot);
+                    if (!texture) {
+                        break;
+                    }
+                    if (op == Op::Sprite) {
+                        target.draw_sprite(*texture, x, y, w, h, rect);
+                    } else {
+                        target.draw_screen_sprite(*texture, x, y, w, h, rect);
+                    }
+                    break;
+                }
+                case Op::Lines: {
+                    const auto count = reader.read<std::uint32_t>();
+                    lines.resize(count);
+                    for (auto& vertex : lines) {
+                        const auto x = reader.read<float>();
+                        const auto y = reader.read<float>();
+                        vertex.position = {x, y};
+                        vertex.color = reader.read_color();
+                    }
+                    target.draw_lines(lines);
+                    break;
+                }
+                case Op::Text: {
+                    const auto slot = reader.read<std::uint32_t>();
+                    const auto x = reader.read<float>();
+                    const auto y = reader.read<float>();
+                    const auto size = reader.read<std::uint32_t>();
+                    const auto color = reader.read_color();
+                    scratch.assign(_strings[slot]);
+                    target.draw_text(scratch, x, y, size, color);
+                    break;
+                }
+                case Op::CreateText:
+                    (void) target_text(reader.read<TextHandle>());
+                    break;
+                case Op::UpdateText: {
+                    const auto handle = reader.read<TextHandle>();
+                    const auto slot = reader.read<std::uint32_t>();
+                    const auto x = reader.read<float>();
+                    const auto y = reader.read<float>();
+                    const auto size = reader.read<std::uint32_t>();
+                    const auto color = reader.read_color();
+                    target.update_text(target_text(handle), _strings[slot], x, y, size, color);
+                    break;
+                }
+                case Op::DestroyText: {
+                    const auto handle = reader.read<TextHandle>();
+                    if (const auto it = texts.find(handle); it != texts.end()) {
+                        target.destroy_text(it->second);
+                        texts.erase(it);
+                    }
+                    break;
+                }
+                case Op::SubmitText:
+                    target.submit_text(target_text(reader.read<TextHandle>()));
+                    break;
+                case Op::FlushText:
+                    target.flush_text();
+                    break;
+            }
+        }
+
+        for (const auto& entry : texts) {
+            target.destroy_text(entry.second);
+        }
+    }
+} // namespace zia::engine
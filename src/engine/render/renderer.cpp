@@ -1,31 +1,24 @@
 // cpp
 #include "Zia/engine/render/Renderer.hpp"
 #include "Zia/game/helpers/Constants.hpp"
+#include "Zia/engine/resources/AssetPathResolver.hpp"
 #include <iostream>
 
 namespace zia {
-    Renderer::Renderer()
-        : _window(sf::VideoMode({800u, 480u}), "Mario Prototype", sf::Style::Titlebar | sf::Style::Close),
+    Renderer::Renderer(std::shared_ptr<const zia::engine::AssetArchive> archive)
+        : _archive(std::move(archive)),
+          _window(sf::VideoMode({800u, 480u}), "Mario Prototype", sf::Style::Titlebar | sf::Style::Close),
           _camera_scale(zia::constants::TILE_SCALE * zia::constants::CAMERA_SCALE)
     {
-        _window.setVerticalSyncEnabled(true);
-
-        const std::vector<std::string> font_paths = {
-            "assets/fonts/arial.ttf",
-            "../assets/fonts/arial.ttf",
-            "../../assets/fonts/arial.ttf"
-        };
-
-        bool loaded = false;
-        for (const auto& path : font_paths) {
-            if (_font.openFromFile(path)) {
-                loaded = true;
-                break;
-            }
+        _world_view = _window.getView();
+
+        if (_archive && _archive->open_font("assets/fonts/arial.ttf", _font)) {
+            return;
         }
 
-        if (!loaded) {
-            std::cerr << "Failed to load font from any of the standard paths." << std::endl;
+        const auto font_path = zia::engine::asset_path_resolver().resolve("assets/fonts/arial.ttf");
+        if (!font_path || !_font.openFromFile(*font_path)) {
+            std::cerr << "Failed to load font assets/fonts/arial.ttf from any asset root." << std::endl;
         }
     }
 
@@ -35,6 +28,8 @@ namespace zia {
         }
 
         _window.clear(_clear_color);
+        // Immediate-mode text slots are reassigned by call order each frame.
+        _immediate_text_count = 0;
     }
 
     void Renderer::end_frame() {
@@ -42,6 +37,8 @@ namespace zia {
             return;
         }
 
+        // Draw any UI text that was not flushed explicitly before presenting.
+        flush_text();
         _window.display();
     }
 
@@ -70,7 +67,9 @@ namespace zia {
             view.setSize({world_w, world_h});
             // setCenter expects the center point in world coords: camera x/y are top-left, so add half-size
             view.setCenter({x + world_w * 0.5f, y + world_h * 0.5f});
-            _window.setView(view);
+            _world_view = view;
+            _window.setView(_world_view);
+            _screen_view_active = false;
         }
     }
 
@@ -78,6 +77,7 @@ namespace zia {
         if (!_window.isOpen()) {
             return;
         }
+        use_world_view();
 
         sf::Sprite sprite(texture);
 
@@ -106,6 +106,35 @@ namespace zia {
         _window.draw(sprite);
     }
 
+    void Renderer::draw_screen_sprite(const sf::Texture& texture, float x, float y, float scale_x, float scale_y, const sf::IntRect& texture_rect) {
+        if (!_window.isOpen()) {
+            return;
+        }
+        use_screen_view();
+
+        sf::Sprite sprite(texture);
+        if (texture_rect.size.x != 0 && texture_rect.size.y != 0) {
+            sprite.setTextureRect(texture_rect);
+        }
+        sprite.setScale({scale_x, scale_y});
+        sprite.setPosition({x, y});
+        _window.draw(sprite);
+    }
+
+    void Renderer::use_world_view() {
+        if (_screen_view_active) {
+            _window.setView(_world_view);
+            _screen_view_active = false;
+        }
+    }
+
+    void Renderer::use_screen_view() {
+        if (!_screen_view_active) {
+            _window.setView(_window.getDefaultView());
+            _screen_view_active = true;
+        }
+    }
+
     void Renderer::draw_sprite(int sprite_id, float x, float y) {
         (void) sprite_id;
         (void) x;
@@ -116,6 +145,7 @@ namespace zia {
         if (!_window.isOpen()) {
             return;
         }
+        use_world_view();
 
         sf::RectangleShape shape({width, height});
         // Positions are world-space; the current SFML view (set in set_camera) handles camera transform.
@@ -129,26 +159,115 @@ namespace zia {
             return;
         }
 
-        // Draw text in screen/UI space: temporarily switch to default view
-        sf::RenderWindow& window = _window;
-        auto old_view = window.getView();
-        window.setView(window.getDefaultView());
+        // The n-th draw_text call of a frame always lands in the n-th slot, so a HUD drawing the same
+        // strings every frame keeps hitting unchanged text objects.
+        if (_immediate_text_count == _immediate_texts.size()) {
+            _immediate_texts.push_back(create_text());
+        }
+        const zia::engine::TextHandle handle = _immediate_texts[_immediate_text_count++];
+        update_text(handle, text, x, y, size, color);
+        submit_text(handle);
+    }
+
+    std::optional<std::reference_wrapper<Renderer::TextObject>> Renderer::find_text(zia::engine::TextHandle handle) {
+        if (handle == zia::engine::INVALID_TEXT_HANDLE || handle > _texts.size()) {
+            return std::nullopt;
+        }
+        auto& object = _texts[handle - 1];
+        if (!object.alive) {
+            return std::nullopt;
+        }
+        return object;
+    }
+
+    zia::engine::TextHandle Renderer::create_text() {
+        zia::engine::TextHandle handle;
+        if (!_free_texts.empty()) {
+            handle = _free_texts.back();
+            _free_texts.pop_back();
+        } else {
+            _texts.emplace_back();
+            handle = static_cast<zia::engine::TextHandle>(_texts.size());
+        }
 
-        // Construct sf::Text using the overload that accepts sf::Font first (compatible with some SFML versions)
-        sf::Text sf_text(_font);
-        sf_text.setString(text);
-        sf_text.setCharacterSize(size);
-        sf_text.setFillColor(color);
+        auto& object = _texts[handle - 1];
+        // sf::Text keeps a reference to the font; _font lives as long as the renderer.
+        object.text.emplace(_font);
+        object.string.clear();
+        object.size = object.text->getCharacterSize();
+        object.color = object.text->getFillColor();
+        object.alive = true;
+        return handle;
+    }
+
+    void Renderer::update_text(zia::engine::TextHandle handle, std::string_view text, float x, float y, unsigned int size, sf::Color color) {
+        auto object_opt = find_text(handle);
+        if (!object_opt) {
+            return;
+        }
+        auto& object = object_opt->get();
+        auto& sf_text = *object.text;
+
+        // Only touch the properties that changed: string and size invalidate the glyph geometry,
+        // colour rewrites vertex colours, position only changes the transform.
+        if (object.string != text) {
+            object.string.assign(text.data(), text.size());
+            sf_text.setString(object.string);
+        }
+        if (object.size != size) {
+            object.size = size;
+            sf_text.setCharacterSize(size);
+        }
+        if (object.color != color) {
+            object.color = color;
+            sf_text.setFillColor(color);
+        }
         sf_text.setPosition({x, y}); // UI-space
-        window.draw(sf_text);
+    }
 
-        window.setView(old_view);
+    void Renderer::destroy_text(zia::engine::TextHandle handle) {
+        auto object_opt = find_text(handle);
+        if (!object_opt) {
+            return;
+        }
+        auto& object = object_opt->get();
+        object.alive = false;
+        object.text.reset();
+        object.string.clear();
+        _free_texts.push_back(handle);
+    }
+
+    void Renderer::submit_text(zia::engine::TextHandle handle) {
+        if (find_text(handle)) {
+            _text_queue.push_back(handle);
+        }
+    }
+
+    void Renderer::flush_text() {
+        if (_text_queue.empty()) {
+            return;
+        }
+        if (!_window.isOpen()) {
+            _text_queue.clear();
+            return;
+        }
+
+        // Draw the whole batch in screen/UI space with (at most) a single view switch.
+        use_screen_view();
+        for (const auto handle : _text_queue) {
+            // Texts destroyed after being queued are skipped.
+            if (auto object_opt = find_text(handle)) {
+                _window.draw(*object_opt->get().text);
+            }
+        }
+        _text_queue.clear();
     }
 
     void Renderer::draw_ellipse(float x, float y, float width, float height, sf::Color color) {
         if (!_window.isOpen()) {
             return;
         }
+        use_world_view();
 
         sf::CircleShape shape(0.5f);
         shape.setScale({width, height});
@@ -163,6 +282,7 @@ namespace zia {
         if (!_window.isOpen()) {
             return;
         }
+        use_world_view();
         sf::RectangleShape outline({width, height});
         // Transparent fill and colored outline
         outline.setFillColor(sf::Color::Transparent);
@@ -172,6 +292,14 @@ namespace zia {
         _window.draw(outline);
     }
 
+    void Renderer::draw_lines(const std::vector<sf::Vertex>& vertices) {
+        if (!_window.isOpen() || vertices.empty()) {
+            return;
+        }
+        use_world_view();
+        _window.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Lines);
+    }
+
     void Renderer::toggle_debug_bboxes() {
         _debug_bboxes = !_debug_bboxes;
     }
@@ -180,6 +308,8 @@ namespace zia {
 
     bool Renderer::is_open() const { return _window.isOpen(); }
 
+    void Renderer::set_vsync(bool enabled) { _window.setVerticalSyncEnabled(enabled); }
+
     sf::Vector2f Renderer::viewport_size() const {
         const auto size = _window.getSize();
         const float w = static_cast<float>(size.x);
@@ -0,0 +1,255 @@
+// Implements ThreadedRenderer: records draw calls on the simulation thread and replays them on a
+// dedicated render thread that owns the window's OpenGL context.
+
+#include "Zia/engine/render/ThreadedRenderer.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
+
+#include <utility>
+
+namespace zia::engine {
+    ThreadedRenderer::ThreadedRenderer(std::shared_ptr<IRenderer> target) : _target(std::move(target)) {
+        // Slot 0 is reserved so that INVALID_TEXT_HANDLE never maps to a live text.
+        _texts.emplace_back();
+    }
+
+    ThreadedRenderer::~ThreadedRenderer() {
+        stop();
+    }
+
+    void ThreadedRenderer::start() {
+        if (running()) {
+            return;
+        }
+        // An OpenGL context can only be current on one thread: hand the window's context to the render thread.
+        (void)_target->window().setActive(false);
+        _stop = false;
+        _thread = std::thread(&ThreadedRenderer::render_loop, this);
+    }
+
+    void ThreadedRenderer::stop() {
+        if (!running()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        _thread.join();
+        // Take the context back so shutdown code (ImGui, texture release) can use it on this thread.
+        (void)_target->window().setActive(true);
+    }
+
+    void ThreadedRenderer::wait_idle() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return !_frame_pending && !_busy; });
+    }
+
+    void ThreadedRenderer::begin_frame() {
+        // Nothing to do: the render thread clears the window when it starts replaying the frame.
+        // Commands recorded since the previous end_frame() (e.g. text created during update) belong to this frame.
+    }
+
+    void ThreadedRenderer::end_frame() {
+        if (!running()) {
+            // Render thread not started: behave like a plain renderer and present synchronously.
+            auto& list = _lists[_record_index];
+            _target->begin_frame();
+            list.replay(*_target, _target_texts);
+            if (_before_present) _before_present(_target->window());
+            _target->end_frame();
+            list.clear();
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            // Never have more than one frame in flight: the other list may still be replayed.
+            _cv.wait(lock, [this] { return !_frame_pending && !_busy; });
+            _replay_index = _record_index;
+            _frame_pending = true;
+        }
+        _cv.notify_all();
+
+        // Record the next frame into the other buffer.
+        _record_index ^= 1u;
+        _lists[_record_index].clear();
+    }
+
+    void ThreadedRenderer::render_loop() {
+        sf::RenderWindow& window = _target->window();
+        (void)window.setActive(true);
+        Profiler::instance().set_thread_name("render");
+
+        while (true) {
+            std::size_t index = 0;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this] { return _frame_pending || _stop; });
+                if (!_frame_pending) {
+                    break; // stop requested and nothing left to draw
+                }
+                _frame_pending = false;
+                _busy = true;
+                index = _replay_index;
+            }
+
+            {
+                ZIA_PROFILE_SCOPE("replay");
+                _target->begin_frame();
+                _lists[index].replay(*_target, _target_texts);
+                if (_before_present) _before_present(window);
+                _target->end_frame();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _busy = false;
+            }
+            _cv.notify_all();
+        }
+
+        (void)window.setActive(false);
+    }
+
+    void ThreadedRenderer::set_camera(float x, float y) {
+        auto& command = _lists[_record_index].push(DrawCommand::Type::SetCamera);
+        command.x = x;
+        command.y = y;
+    }
+
+    void ThreadedRenderer::draw_rect(float x, float y, float width, float height, sf::Color color) {
+        auto& command = _lists[_record_index].push(DrawCommand::Type::Rect);
+        command.x = x;
+        command.y = y;
+        command.width = width;
+        command.height = height;
+        command.color = color;
+    }
+
+    void ThreadedRenderer::draw_sprite(const sf::Texture& texture, float x, float y, float width, float height, const sf::IntRect& texture_rect) {
+        auto& command = _lists[_record_index].push(DrawCommand::Type::Sprite);
+        command.x = x;
+        command.y = y;
+        command.width = width;
+        command.height = height;
+        command.texture_rect = texture_rect;
+        command.texture = std::cref(texture);
+    }
+
+    void ThreadedRenderer::draw_screen_sprite(const sf::Texture& texture, float x, float y, float scale_x, float scale_y, const sf::IntRect& texture_rect) {
+        auto& command = _lists[_record_index].push(DrawCommand::Type::ScreenSprite);
+        command.x = x;
+        command.y = y;
+        command.width = scale_x;
+        command.height = scale_y;
+        command.texture_rect = texture_rect;
+        command.texture = std::cref(texture);
+    }
+
+    void ThreadedRenderer::draw_text(const std::string& text, float x, float y, unsigned int size, sf::Color color) {
+        auto& list = _lists[_record_index];
+        const auto string_index = list.store_string(text);
+        auto& command = list.push(DrawCommand::Type::Text);
+        command.x = x;
+        command.y = y;
+        command.text_size = size;
+        command.color = color;
+        command.string_index = string_index;
+    }
+
+    void ThreadedRenderer::draw_ellipse(float x, float y, float width, float height, sf::Color color) {
+        auto& command = _lists[_record_index].push(DrawCommand::Type::Ellipse);
+        command.x = x;
+        command.y = y;
+        command.width = width;
+        command.height = height;
+        command.color = color;
+    }
+
+    void ThreadedRenderer::draw_bbox(float x, float y, float width, float height, sf::Color color, float thickness) {
+        auto& command = _lists[_record_index].push(DrawCommand::Type::BBox);
+        command.x = x;
+        command.y = y;
+        command.width = width;
+        command.height = height;
+        command.color = color;
+        command.thickness = thickness;
+    }
+
+    void ThreadedRenderer::draw_lines(const std::vector<sf::Vertex>& vertices) {
+        if (vertices.empty()) {
+            return;
+        }
+        auto& list = _lists[_record_index];
+        const auto batch = list.store_vertices(vertices);
+        list.push(DrawCommand::Type::Lines).vertex_batch = batch;
+    }
+
+    TextHandle ThreadedRenderer::create_text() {
+        TextHandle handle;
+        if (!_free_texts.empty()) {
+            handle = _free_texts.back();
+            _free_texts.pop_back();
+        } else {
+            handle = static_cast<TextHandle>(_texts.size());
+            _texts.emplace_back();
+        }
+        _texts[handle] = TextState{};
+        _texts[handle].alive = true;
+
+        // The target-side text is created when the render thread reaches this command.
+        _lists[_record_index].push(DrawCommand::Type::CreateText).text = handle;
+        return handle;
+    }
+
+    void ThreadedRenderer::update_text(TextHandle handle, std::string_view text, float x, float y, unsigned int size, sf::Color color) {
+        if (handle == INVALID_TEXT_HANDLE || handle >= _texts.size() || !_texts[handle].alive) {
+            return;
+        }
+        auto& state = _texts[handle];
+        // Unchanged texts (the common case for HUD labels) record nothing.
+        if (state.string == text && state.x == x && state.y == y && state.size == size && state.color == color) {
+            return;
+        }
+        state.string.assign(text.data(), text.size());
+        state.x = x;
+        state.y = y;
+        state.size = size;
+        state.color = color;
+
+        auto& list = _lists[_record_index];
+        const auto string_index = list.store_string(text);
+        auto& command = list.push(DrawCommand::Type::UpdateText);
+        command.text = handle;
+        command.x = x;
+        command.y = y;
+        command.text_size = size;
+        command.color = color;
+        command.string_index = string_index;
+    }
+
+    void ThreadedRenderer::destroy_text(TextHandle handle) {
+        if (handle == INVALID_TEXT_HANDLE || handle >= _texts.size() || !_texts[handle].alive) {
+            return;
+        }
+        _texts[handle].alive = false;
+        _free_texts.push_back(handle);
+        _lists[_record_index].push(DrawCommand::Type::DestroyText).text = handle;
+    }
+
+    void ThreadedRenderer::submit_text(TextHandle handle) {
+        if (handle == INVALID_TEXT_HANDLE || handle >= _texts.size() || !_texts[handle].alive) {
+            return;
+        }
+        _lists[_record_index].push(DrawCommand::Type::SubmitText).text = handle;
+    }
+
+    void ThreadedRenderer::flush_text() {
+        _lists[_record_index].push(DrawCommand::Type::FlushText);
+    }
+
+    void ThreadedRenderer::set_vsync(bool enabled) {
+        _lists[_record_index].push(DrawCommand::Type::SetVsync).x = enabled ? 1.0f : 0.0f;
+    }
+} // namespace zia::engine
@@ -0,0 +1,140 @@
+// Implements AssetArchive: table-of-contents lookup and loading from a memory-mapped .zpak file.
+
+#include "Zia/engine/resources/AssetArchive.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <system_error>
+
+namespace zia::engine {
+    std::string normalize_asset_path(std::string_view path) {
+        std::string key(path);
+        std::replace(key.begin(), key.end(), '\\', '/');
+        while (key.rfind("./", 0) == 0) {
+            key.erase(0, 2);
+        }
+        return key;
+    }
+
+    bool AssetArchive::open(const std::filesystem::path& path) {
+        _entries.clear();
+        _path.clear();
+        _write_time = 0;
+        if (!_file.open(path)) {
+            return false;
+        }
+
+        ArchiveHeader header;
+        if (_file.size() < sizeof(header)) {
+            std::cerr << "AssetArchive: '" << path.string() << "' is too small" << std::endl;
+            _file.close();
+            return false;
+        }
+        std::memcpy(&header, _file.data(), sizeof(header));
+        const std::uint64_t toc_bytes = static_cast<std::uint64_t>(header.entry_count) * sizeof(ArchiveEntry);
+        if (header.magic != ARCHIVE_MAGIC || header.version != ARCHIVE_VERSION ||
+            header.toc_offset > _file.size() || toc_bytes > _file.size() - header.toc_offset) {
+            std::cerr << "AssetArchive: '" << path.string() << "' is not a valid v" << ARCHIVE_VERSION << " archive" << std::endl;
+            _file.close();
+            return false;
+        }
+
+        // Copy the table of contents so entries are properly aligned regardless of the file layout.
+        _entries.resize(header.entry_count);
+        std::memcpy(_entries.data(), _file.data() + header.toc_offset, static_cast<std::size_t>(toc_bytes));
+        for (const auto& entry : _entries) {
+            if (entry.offset > _file.size() || entry.size > _file.size() - entry.offset) {
+                std::cerr << "AssetArchive: '" << path.string() << "' has an entry outside the file" << std::endl;
+                _entries.clear();
+                _file.close();
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        const auto write_time = std::filesystem::last_write_time(path, ec);
+        _write_time = ec ? 0 : static_cast<std::int64_t>(write_time.time_since_epoch().count());
+        _path = path;
+        return true;
+    }
+
+    std::optional<AssetArchive::Blob> AssetArchive::find(std::string_view path) const {
+        if (_entries.empty()) {
+            return std::nullopt;
+        }
+        const std::uint64_t hash = asset_path_hash(path);
+        const auto it = std::lower_bound(_entries.begin(), _entries.end(), hash,
+                                         [](const ArchiveEntry& entry, std::uint64_t value) { return entry.path_hash < value; });
+        if (it == _entries.end() || it->path_hash != hash) {
+            return std::nullopt;
+        }
+        Blob blob;
+        blob.data = _file.data() + it->offset;
+        blob.size = static_cast<std::size_t>(it->size);
+        blob.predecoded = (it->flags & ARCHIVE_FLAG_PREDECODED_RGBA) != 0;
+        blob.image_size = {it->width, it->height};
+        return blob;
+    }
+
+    namespace {
+        // Pre-decoded blobs must hold exactly width * height RGBA8 pixels.
+        bool valid_pixels(const AssetArchive::Blob& blob) {
+            const auto expected = static_cast<std::size_t>(blob.image_size.x) * blob.image_size.y * 4u;
+            return expected > 0 && blob.size == expected;
+        }
+    }
+
+    bool AssetArchive::load_image(std::string_view path, sf::Image& image) const {
+        const auto blob = find(path);
+        if (!blob || (blob->predecoded && !valid_pixels(*blob))) {
+            return false;
+        }
+        if (blob->predecoded) {
+            image.resize(blob->image_size, blob->data);
+            return true;
+        }
+        return image.loadFromMemory(blob->data, blob->size);
+    }
+
+    bool AssetArchive::load_texture(std::string_view path, sf::Texture& texture) const {
+        const auto blob = find(path);
+        if (!blob || (blob->predecoded && !valid_pixels(*blob))) {
+            return false;
+        }
+        if (blob->predecoded) {
+            // Upload the pixels directly from the mapping, skipping the intermediate sf::Image.
+            if (!texture.resize(blob->image_size)) {
+                return false;
+            }
+            texture.update(blob->data);
+            return true;
+        }
+        return texture.loadFromMemory(blob->data, blob->size);
+    }
+
+    bool AssetArchive::open_font(std::string_view path, sf::Font& font) const {
+        const auto blob = find(path);
+        if (!blob || blob->predecoded) {
+            return false;
+        }
+        return font.openFromMemory(blob->data, blob->size);
+    }
+
+    std::shared_ptr<const AssetArchive> open_default_asset_archive() {
+        std::filesystem::path path("assets.zpak");
+        if (const char* env = std::getenv("ZIA_ASSET_ARCHIVE")) {
+            path = env;
+        }
+        if (!std::filesystem::exists(path)) {
+            return nullptr;
+        }
+        auto archive = std::make_shared<AssetArchive>();
+        if (!archive->open(path)) {
+            return nullptr;
+        }
+        std::cout << "AssetArchive: mounted " << path.string() << " (" << archive->entry_count() << " files)" << std::endl;
+        return archive;
+    }
+} // namespace zia::engine
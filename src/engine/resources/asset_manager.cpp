@@ -1,8 +1,15 @@
 // Implements the AssetManager class, which loads and manages textures and other assets for the game.
-// Handles loading textures from disk, searching multiple locations, and reporting errors if assets are missing.
+// Handles loading textures from disk (paths resolved by AssetPathResolver) and reporting errors if assets are missing.
+// Textures can also be streamed: files are decoded on a small worker pool and uploaded on the main
+// thread within a per-frame byte budget.
 
-#include "zia/engine/resources/AssetManager.hpp"
+#include "Zia/engine/resources/AssetManager.hpp"
+#include "Zia/engine/resources/AssetArchive.hpp"
+#include "Zia/engine/resources/TextureCache.hpp"
+#include "Zia/engine/resources/AssetPathResolver.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <optional>
@@ -11,97 +18,395 @@
 
 namespace zia {
 
+    // Loose-file lookup through the process-wide index (see AssetPathResolver).
     static std::optional<std::filesystem::path> resolve_asset_path(std::string_view path) {
-        std::filesystem::path base(path);
-
-        const std::filesystem::path cwd = std::filesystem::current_path();
-        const std::filesystem::path tries[] = {
-            base,
-            cwd / base,
-            cwd / ".." / base,
-            cwd / ".." / ".." / base,
-            cwd / ".." / ".." / ".." / base,
-        };
-
-        for (const auto& candidate : tries) {
-            if (std::filesystem::exists(candidate)) {
-                return candidate;
+        return engine::asset_path_resolver().resolve(path);
+    }
+
+    // Archive first, then loose files. With a texture cache, encoded data from either source is
+    // decoded once and read back as raw texels on later launches.
+    static bool load_texture_from(const engine::AssetArchive* archive, const engine::TextureCache* cache,
+                                  std::string_view path, sf::Texture& texture) {
+        if (archive && archive->contains(path)) {
+            if (!cache) return archive->load_texture(path, texture);
+            if (cache->load_texture(*archive, path, texture)) return true;
+            sf::Image image;
+            if (cache->decode(*archive, path, image) != engine::TextureCache::DecodeResult::Failed) {
+                return texture.loadFromImage(image);
             }
         }
+        const auto resolved_path = resolve_asset_path(path);
+        if (!resolved_path) return false;
+        if (!cache) return texture.loadFromFile(resolved_path->string());
+        if (cache->load_texture(*resolved_path, texture)) return true;
+        sf::Image image;
+        if (cache->decode(*resolved_path, image) == engine::TextureCache::DecodeResult::Failed) return false;
+        return texture.loadFromImage(image);
+    }
+
+    // Worker-side counterpart of load_texture_from: CPU pixels only, no GPU upload.
+    static bool load_image_from(const engine::AssetArchive* archive, const engine::TextureCache* cache,
+                                std::string_view path, sf::Image& image) {
+        if (archive && archive->contains(path)) {
+            const bool ok = cache ? cache->decode(*archive, path, image) != engine::TextureCache::DecodeResult::Failed
+                                  : archive->load_image(path, image);
+            if (ok) return true;
+        }
+        const auto resolved = resolve_asset_path(path);
+        if (!resolved) return false;
+        return cache ? cache->decode(*resolved, image) != engine::TextureCache::DecodeResult::Failed
+                     : image.loadFromFile(*resolved);
+    }
 
-        return std::nullopt;
+    AssetManager::~AssetManager() {
+        {
+            std::lock_guard<std::mutex> lock(_stream_mutex);
+            _stop = true;
+        }
+        _jobs_cv.notify_all();
+        for (auto& worker : _workers) {
+            if (worker.joinable()) worker.join();
+        }
     }
 
     // Loads a texture from disk and stores it with the given ID. Returns true on success.
     bool AssetManager::load_texture(int id, std::string_view path) {
         if (path.empty()) return false;
-        if (has_texture(id)) return true;
-
-        const auto resolved_path = resolve_asset_path(path);
-        if (!resolved_path) return false;
+        if (const auto it = _textures.find(id); it != _textures.end()) {
+            if (it->second.path.empty() || it->second.path == path) return true;
+        }
 
         auto tex = std::make_shared<sf::Texture>();
-        if (!tex->loadFromFile(resolved_path->string())) return false;
+        if (!load_texture_from(_archive.get(), _texture_cache.get(), path, *tex)) return false;
         tex->setSmooth(true);
-        _textures[id] = tex;
+        store_texture(id, std::move(tex), std::string(path));
+
+        // A synchronous load supersedes any streaming request for the same id.
+        {
+            std::lock_guard<std::mutex> lock(_stream_mutex);
+            _requests.erase(id);
+        }
+        _streaming.erase(id);
         return true;
     }
 
+    engine::TextureHandle AssetManager::request_texture(int id, std::string_view path, engine::AssetPriority priority) {
+        if (path.empty()) return {id, engine::AssetStatus::Failed};
+
+        {
+            std::lock_guard<std::mutex> lock(_stream_mutex);
+            auto it = _requests.find(id);
+            if (it != _requests.end() && it->second.path == path) {
+                auto& request = it->second;
+                // Still waiting for a worker: re-queue at the higher priority. The stale job is
+                // skipped by the worker because the request is no longer Queued when it gets there.
+                if (request.status == engine::AssetStatus::Queued && priority > request.priority) {
+                    request.priority = priority;
+                    _jobs.push_back(DecodeJob{priority, _next_sequence++, id, request.generation, request.path, {}});
+                    std::push_heap(_jobs.begin(), _jobs.end(), lower_priority<DecodeJob>);
+                    _jobs_cv.notify_one();
+                }
+                return {id, request.status};
+            }
+
+            if (it == _requests.end()) {
+                const auto tex_it = _textures.find(id);
+                if (tex_it != _textures.end() && (tex_it->second.path.empty() || tex_it->second.path == path)) {
+                    return {id, engine::AssetStatus::Ready};
+                }
+            }
+
+            // New request (or a different file for this id): results of older requests are
+            // recognised by their generation and discarded.
+            StreamRequest request;
+            request.path = std::string(path);
+            request.priority = priority;
+            request.generation = _next_generation++;
+            _jobs.push_back(DecodeJob{priority, _next_sequence++, id, request.generation, request.path, {}});
+            std::push_heap(_jobs.begin(), _jobs.end(), lower_priority<DecodeJob>);
+            _requests[id] = std::move(request);
+        }
+        _jobs_cv.notify_one();
+
+        start_workers();
+        (void)placeholder();
+        if (!has_texture(id)) {
+            _streaming.insert(id);
+        }
+        return {id, engine::AssetStatus::Queued};
+    }
+
+    engine::AssetStatus AssetManager::texture_status(int id) const {
+        {
+            std::lock_guard<std::mutex> lock(_stream_mutex);
+            const auto it = _requests.find(id);
+            if (it != _requests.end()) return it->second.status;
+        }
+        return has_texture(id) ? engine::AssetStatus::Ready : engine::AssetStatus::Missing;
+    }
+
+    void AssetManager::submit_job(engine::AssetPriority priority, std::function<void()> job) {
+        if (!job) return;
+        {
+            std::lock_guard<std::mutex> lock(_stream_mutex);
+            DecodeJob entry;
+            entry.priority = priority;
+            entry.sequence = _next_sequence++;
+            entry.task = std::move(job);
+            _jobs.push_back(std::move(entry));
+            std::push_heap(_jobs.begin(), _jobs.end(), lower_priority<DecodeJob>);
+        }
+        _jobs_cv.notify_one();
+        start_workers();
+    }
+
+    void AssetManager::start_workers() {
+        if (!_workers.empty()) return;
+        const unsigned hw = std::thread::hardware_concurrency();
+        const unsigned count = std::clamp(hw / 2u, 1u, MAX_DECODE_WORKERS);
+        _workers.reserve(count);
+        for (unsigned i = 0; i < count; ++i) {
+            _workers.emplace_back(&AssetManager::worker_loop, this);
+        }
+    }
+
+    void AssetManager::worker_loop() {
+        engine::Profiler::instance().set_thread_name("asset_worker");
+        for (;;) {
+            DecodeJob job;
+            {
+                std::unique_lock<std::mutex> lock(_stream_mutex);
+                _jobs_cv.wait(lock, [this] { return _stop || !_jobs.empty(); });
+                if (_stop) return;
+                std::pop_heap(_jobs.begin(), _jobs.end(), lower_priority<DecodeJob>);
+                job = std::move(_jobs.back());
+                _jobs.pop_back();
+
+                if (!job.task) {
+                    // Skip decodes that were superseded, unloaded or re-queued at another priority.
+                    const auto it = _requests.find(job.id);
+                    if (it == _requests.end() || it->second.generation != job.generation ||
+                        it->second.status != engine::AssetStatus::Queued) {
+                        continue;
+                    }
+                    it->second.status = engine::AssetStatus::Decoding;
+                }
+            }
+
+            if (job.task) {
+                job.task();
+                continue;
+            }
+
+            // File I/O and PNG decoding happen without holding the lock.
+            ZIA_PROFILE_SCOPE("decode_texture");
+            DecodedImage decoded;
+            decoded.priority = job.priority;
+            decoded.id = job.id;
+            decoded.generation = job.generation;
+            decoded.ok = load_image_from(_archive.get(), _texture_cache.get(), job.path, decoded.image);
+            if (!decoded.ok) {
+                std::cerr << "AssetManager: failed to decode '" << job.path << "' for id=" << job.id << "\n";
+            }
+
+            std::lock_guard<std::mutex> lock(_stream_mutex);
+            const auto it = _requests.find(job.id);
+            if (it == _requests.end() || it->second.generation != job.generation) {
+                continue;
+            }
+            it->second.status = decoded.ok ? engine::AssetStatus::Uploading : engine::AssetStatus::Failed;
+            decoded.sequence = _next_sequence++;
+            _decoded.push_back(std::move(decoded));
+            std::push_heap(_decoded.begin(), _decoded.end(), lower_priority<DecodedImage>);
+        }
+    }
+
+    const std::shared_ptr<sf::Texture>& AssetManager::placeholder() {
+        if (!_placeholder) {
+            // A single transparent texel: pending sprites and backgrounds simply do not show yet.
+            _placeholder = std::make_shared<sf::Texture>();
+            const sf::Image blank({1u, 1u}, sf::Color::Transparent);
+            if (!_placeholder->loadFromImage(blank)) {
+                std::cerr << "AssetManager: failed to create placeholder texture\n";
+            }
+        }
+        return _placeholder;
+    }
+
     void AssetManager::push_decoded_image(int id, sf::Image &&image) {
-        std::lock_guard<std::mutex> lock(_pending_mutex);
-        _pending_images.emplace(id, std::move(image));
+        std::lock_guard<std::mutex> lock(_stream_mutex);
+        DecodedImage decoded;
+        decoded.sequence = _next_sequence++;
+        decoded.id = id;
+        decoded.ok = true;
+        decoded.image = std::move(image);
+        _decoded.push_back(std::move(decoded));
+        std::push_heap(_decoded.begin(), _decoded.end(), lower_priority<DecodedImage>);
+    }
+
+    void AssetManager::store_texture(int id, std::shared_ptr<sf::Texture> texture, std::string path) {
+        const auto size = texture->getSize();
+        auto& entry = _textures[id];
+        _texture_bytes -= entry.bytes;
+        entry.texture = std::move(texture);
+        entry.path = std::move(path);
+        entry.bytes = static_cast<std::size_t>(size.x) * size.y * 4u;
+        entry.last_use_frame = _frame;
+        _texture_bytes += entry.bytes;
+        _evicted.erase(id);
+    }
+
+    void AssetManager::retain_texture(int id) {
+        ++_texture_refs[id];
+    }
+
+    void AssetManager::release_texture(int id) {
+        const auto it = _texture_refs.find(id);
+        if (it == _texture_refs.end()) return;
+        if (--it->second <= 0) _texture_refs.erase(it);
+    }
+
+    void AssetManager::evict_to_budget() {
+        if (_memory_budget == 0 || _texture_bytes <= _memory_budget) return;
+
+        // Least recently used first among textures nobody retains, that were not drawn in the last
+        // few frames (the render thread may still hold them) and that have no outside owner.
+        std::vector<std::pair<std::uint64_t, int>> candidates;
+        for (const auto& [id, entry] : _textures) {
+            if (entry.path.empty() || _texture_refs.count(id) != 0) continue;
+            if (entry.last_use_frame + EVICTION_GRACE_FRAMES >= _frame) continue;
+            if (entry.texture.use_count() > 1) continue;
+            candidates.emplace_back(entry.last_use_frame, id);
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (const auto& candidate : candidates) {
+            if (_texture_bytes <= _memory_budget) break;
+            auto it = _textures.find(candidate.second);
+            _texture_bytes -= it->second.bytes;
+            // Remember the source so the next use reloads it.
+            _evicted[candidate.second] = std::move(it->second.path);
+            _textures.erase(it);
+        }
     }
 
     void AssetManager::finalize_decoded_images() {
-        std::queue<std::pair<int, sf::Image>> local;
-        {
-            std::lock_guard<std::mutex> lock(_pending_mutex);
-            std::swap(_pending_images, local);
+        ++_frame;
+
+        // Evicted textures that were used again since the last frame are streamed back in.
+        for (const int id : _reload_queue) {
+            const auto it = _evicted.find(id);
+            if (it != _evicted.end()) {
+                const std::string path = it->second;
+                request_texture(id, path, engine::AssetPriority::Normal);
+            }
         }
+        _reload_queue.clear();
+
+        std::size_t uploaded_bytes = 0;
+        for (;;) {
+            DecodedImage decoded;
+            std::string path;
+            {
+                std::lock_guard<std::mutex> lock(_stream_mutex);
+                if (_decoded.empty()) break;
+                // Respect the byte budget, but always upload at least one texture per frame.
+                const auto size = _decoded.front().image.getSize();
+                const std::size_t bytes = static_cast<std::size_t>(size.x) * size.y * 4u;
+                if (uploaded_bytes > 0 && uploaded_bytes + bytes > _upload_budget) break;
+
+                std::pop_heap(_decoded.begin(), _decoded.end(), lower_priority<DecodedImage>);
+                decoded = std::move(_decoded.back());
+                _decoded.pop_back();
+
+                if (decoded.generation != 0) {
+                    const auto it = _requests.find(decoded.id);
+                    if (it == _requests.end() || it->second.generation != decoded.generation) {
+                        continue; // superseded or unloaded while decoding
+                    }
+                    if (!decoded.ok) {
+                        // Keep the Failed request so texture_status() reports it; stop the placeholder.
+                        _streaming.erase(decoded.id);
+                        continue;
+                    }
+                    path = it->second.path;
+                }
+                uploaded_bytes += bytes;
+            }
 
-        while (!local.empty()) {
-            auto &pr = local.front();
-            int id = pr.first;
-            sf::Image &img = pr.second;
-            auto tex = std::make_shared<sf::Texture>();
             // create texture from image on main thread (OpenGL context owned here)
-            bool tex_ok = tex->loadFromImage(img);
+            ZIA_PROFILE_SCOPE("upload_texture");
+            auto tex = std::make_shared<sf::Texture>();
+            const bool tex_ok = tex->loadFromImage(decoded.image);
+            std::lock_guard<std::mutex> lock(_stream_mutex);
             if (!tex_ok) {
-                std::cerr << "AssetManager: failed to create texture from decoded image for id=" << id << "\n";
+                std::cerr << "AssetManager: failed to create texture from decoded image for id=" << decoded.id << "\n";
+                if (decoded.generation != 0) _requests[decoded.id].status = engine::AssetStatus::Failed;
             } else {
                 tex->setSmooth(true);
-                _textures[id] = tex;
+                // Images pushed without a request have no path and are never evicted.
+                store_texture(decoded.id, std::move(tex), std::move(path));
+                if (decoded.generation != 0) {
+                    _requests.erase(decoded.id);
+                }
             }
-            local.pop();
+            _streaming.erase(decoded.id);
         }
+
+        evict_to_budget();
     }
 
     // Return a shared ownership pointer to the texture so callers don't hold raw pointers.
+    // Streamed textures that are not uploaded yet resolve to the shared placeholder; evicted textures
+    // are queued for reload and show the placeholder meanwhile. Every lookup refreshes the LRU stamp.
     std::shared_ptr<sf::Texture> AssetManager::get_mutable_texture(int id) {
         auto it = _textures.find(id);
-        if (it == _textures.end()) return {};
-        return it->second;
+        if (it == _textures.end()) {
+            return missing_texture(id);
+        }
+        it->second.last_use_frame = _frame;
+        return it->second.texture;
     }
 
     std::shared_ptr<const sf::Texture> AssetManager::get_texture(int id) const {
         auto it = _textures.find(id);
-        if (it == _textures.end()) return {};
-        return std::static_pointer_cast<const sf::Texture>(it->second);
+        if (it == _textures.end()) {
+            return missing_texture(id);
+        }
+        it->second.last_use_frame = _frame;
+        return std::static_pointer_cast<const sf::Texture>(it->second.texture);
+    }
+
+    std::shared_ptr<sf::Texture> AssetManager::missing_texture(int id) const {
+        if (_streaming.count(id) != 0) return _placeholder;
+        if (_evicted.count(id) != 0) {
+            _reload_queue.push_back(id);
+            return _placeholder;
+        }
+        return {};
     }
 
     bool AssetManager::has_texture(int id) const {
         return _textures.find(id) != _textures.end();
     }
 
+    int AssetManager::find_texture_id(const sf::Texture& texture) const {
+        for (const auto& [id, entry] : _textures) {
+            if (entry.texture.get() == &texture) return id;
+        }
+        return -1;
+    }
+
     bool AssetManager::load_font(int id, std::string_view path) {
         if (path.empty()) return false;
         if (has_font(id)) return true;
 
-        const auto resolved_path = resolve_asset_path(path);
-        if (!resolved_path) return false;
-
         auto f = std::make_shared<sf::Font>();
-        if (!f->openFromFile(resolved_path->string())) return false;
+        if (!_archive || !_archive->open_font(path, *f)) {
+            const auto resolved_path = resolve_asset_path(path);
+            if (!resolved_path) return false;
+            if (!f->openFromFile(resolved_path->string())) return false;
+        }
         _fonts[id] = f;
         return true;
     }
@@ -117,7 +422,19 @@ namespace zia {
     }
 
     void AssetManager::unload_all() {
+        {
+            // Decodes still in flight find no matching request and are dropped.
+            std::lock_guard<std::mutex> lock(_stream_mutex);
+            _requests.clear();
+            _jobs.clear();
+            _decoded.clear();
+        }
+        _streaming.clear();
         _textures.clear();
+        _texture_bytes = 0;
+        _evicted.clear();
+        _reload_queue.clear();
+        _texture_refs.clear();
         _fonts.clear();
     }
 
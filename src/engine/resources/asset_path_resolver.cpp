@@ -0,0 +1,131 @@
+// Implements AssetPathResolver: one directory walk per search root at startup, then hash-map lookups.
+
+#include "Zia/engine/resources/AssetPathResolver.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <system_error>
+
+namespace zia::engine {
+    namespace {
+        // Only this subdirectory of a root is indexed; asset paths all start with it.
+        constexpr const char* ASSET_DIRECTORY = "assets";
+
+#ifdef _WIN32
+        constexpr char ROOT_SEPARATOR = ';';
+#else
+        constexpr char ROOT_SEPARATOR = ':';
+#endif
+
+        // Index key of a relative path: lexically normalized, '/'-separated, without a leading "./".
+        std::string key_of(const std::filesystem::path &path) {
+            std::string key = path.lexically_normal().generic_string();
+            while (key.size() >= 2 && key[0] == '.' && key[1] == '/') {
+                key.erase(0, 2);
+            }
+            return key;
+        }
+    }
+
+    void AssetPathResolver::set_roots(std::vector<std::filesystem::path> roots) {
+        std::unique_lock<std::shared_mutex> lock(_mutex);
+        build_index(std::move(roots));
+    }
+
+    std::vector<std::filesystem::path> AssetPathResolver::roots() const {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        return _roots;
+    }
+
+    std::size_t AssetPathResolver::indexed_count() const {
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        return _index.size();
+    }
+
+    // Used by: AssetManager (textures, fonts), Renderer (UI font), JsonHelper and Level (level files)
+    std::optional<std::filesystem::path> AssetPathResolver::resolve(std::string_view path) const {
+        if (path.empty()) return std::nullopt;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(_mutex);
+            if (!_configured) {
+                lock.unlock();
+                std::unique_lock<std::shared_mutex> build_lock(_mutex);
+                if (!_configured) build_index(default_roots());
+            }
+        }
+
+        const std::filesystem::path base(path);
+        std::error_code ec;
+        if (base.is_absolute()) {
+            return std::filesystem::exists(base, ec) ? std::optional<std::filesystem::path>(base) : std::nullopt;
+        }
+
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        if (const auto it = _index.find(key_of(base)); it != _index.end()) {
+            return it->second;
+        }
+        // Not indexed: a file outside the assets directories or one written after the walk.
+        for (const auto &root : _roots) {
+            const auto candidate = root / base;
+            if (std::filesystem::exists(candidate, ec)) {
+                return candidate;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::vector<std::filesystem::path> AssetPathResolver::default_roots() {
+        std::vector<std::filesystem::path> roots;
+        if (const char *env = std::getenv("ZIA_ASSET_ROOTS")) {
+            std::string_view list(env);
+            while (!list.empty()) {
+                const auto end = list.find(ROOT_SEPARATOR);
+                const auto entry = list.substr(0, end);
+                if (!entry.empty()) roots.emplace_back(std::string(entry));
+                if (end == std::string_view::npos) break;
+                list.remove_prefix(end + 1);
+            }
+        }
+
+        std::error_code ec;
+        const std::filesystem::path cwd = std::filesystem::current_path(ec);
+        if (!ec) {
+            roots.push_back(cwd);
+            roots.push_back(cwd / "..");
+            roots.push_back(cwd / ".." / "..");
+            roots.push_back(cwd / ".." / ".." / "..");
+        } else {
+            roots.emplace_back(".");
+        }
+        return roots;
+    }
+
+    void AssetPathResolver::build_index(std::vector<std::filesystem::path> roots) const {
+        _roots = std::move(roots);
+        _index.clear();
+        _configured = true;
+
+        for (const auto &root : _roots) {
+            std::error_code ec;
+            const auto assets = root / ASSET_DIRECTORY;
+            if (!std::filesystem::is_directory(assets, ec)) continue;
+
+            for (auto it = std::filesystem::recursive_directory_iterator(assets, std::filesystem::directory_options::skip_permission_denied, ec);
+                 !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+                if (!it->is_regular_file(ec)) continue;
+                // Earlier roots take precedence.
+                _index.emplace(key_of(it->path().lexically_relative(root)), it->path());
+            }
+            if (ec) {
+                std::cerr << "AssetPathResolver: error while indexing " << assets.string() << ": " << ec.message() << std::endl;
+            }
+        }
+    }
+
+    AssetPathResolver& asset_path_resolver() {
+        static AssetPathResolver resolver;
+        return resolver;
+    }
+} // namespace zia::engine
@@ -0,0 +1,120 @@
+// Implements MappedFile: platform memory mapping of read-only files.
+
+#include "Zia/engine/resources/MappedFile.hpp"
+
+#include <iostream>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace zia::engine {
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)),
+          _size(std::exchange(other._size, 0))
+#ifdef _WIN32
+          , _mapping(std::exchange(other._mapping, nullptr))
+#endif
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+#ifdef _WIN32
+            _mapping = std::exchange(other._mapping, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+#ifdef _WIN32
+    bool MappedFile::open(const std::filesystem::path& path) {
+        close();
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        // The mapping keeps the file alive; the file handle is no longer needed.
+        CloseHandle(file);
+        if (!mapping) {
+            return false;
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            return false;
+        }
+        _data = view;
+        _size = static_cast<std::size_t>(file_size.QuadPart);
+        _mapping = mapping;
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (_data) {
+            UnmapViewOfFile(_data);
+        }
+        if (_mapping) {
+            CloseHandle(static_cast<HANDLE>(_mapping));
+        }
+        _data = nullptr;
+        _mapping = nullptr;
+        _size = 0;
+    }
+#else
+    bool MappedFile::open(const std::filesystem::path& path) {
+        close();
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info{};
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        const auto size = static_cast<std::size_t>(info.st_size);
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping stays valid after the descriptor is closed.
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            std::cerr << "MappedFile: mmap failed for '" << path.string() << "'" << std::endl;
+            return false;
+        }
+        _data = data;
+        _size = size;
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (_data) {
+            ::munmap(_data, _size);
+        }
+        _data = nullptr;
+        _size = 0;
+    }
+#endif
+} // namespace zia::engine
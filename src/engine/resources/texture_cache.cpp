@@ -0,0 +1,239 @@
+// Implements TextureCache: raw RGBA8 texel blobs keyed by source path (or archive path + entry),
+// validated by size + mtime.
+
+#include "Zia/engine/resources/TextureCache.hpp"
+#include "Zia/engine/resources/AssetArchive.hpp"
+#include "Zia/engine/resources/MappedFile.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+
+namespace zia::engine {
+    namespace {
+        constexpr std::uint32_t CACHE_MAGIC = 0x4358545Au; // "ZTXC"
+        constexpr std::uint32_t CACHE_VERSION = 1;
+        constexpr const char* BLOB_EXTENSION = ".rgba";
+
+        struct BlobHeader {
+            std::uint32_t magic = CACHE_MAGIC;
+            std::uint32_t version = CACHE_VERSION;
+            std::uint64_t source_size = 0;
+            std::int64_t source_mtime = 0;
+            std::uint32_t width = 0;
+            std::uint32_t height = 0;
+        };
+
+        // Size and modification time identifying the current contents of a source file.
+        struct SourceStamp {
+            std::uint64_t size = 0;
+            std::int64_t mtime = 0;
+        };
+
+        std::optional<SourceStamp> stamp_of(const std::filesystem::path& source) {
+            std::error_code ec;
+            const auto size = std::filesystem::file_size(source, ec);
+            if (ec) return std::nullopt;
+            const auto mtime = std::filesystem::last_write_time(source, ec);
+            if (ec) return std::nullopt;
+            return SourceStamp{static_cast<std::uint64_t>(size),
+                               static_cast<std::int64_t>(mtime.time_since_epoch().count())};
+        }
+
+        // Identity of a cached image: the name its blob file is hashed from and the stamp it must match.
+        struct BlobKey {
+            std::string name;
+            SourceStamp stamp;
+        };
+
+        std::string canonical_name(const std::filesystem::path& path) {
+            std::error_code ec;
+            auto canonical = std::filesystem::weakly_canonical(path, ec);
+            if (ec) canonical = path;
+            return canonical.generic_string();
+        }
+
+        std::optional<BlobKey> key_of(const std::filesystem::path& source) {
+            const auto stamp = stamp_of(source);
+            if (!stamp) return std::nullopt;
+            return BlobKey{canonical_name(source), *stamp};
+        }
+
+        // "<archive>#<entry>", stamped with the archive as it was mapped rather than as it is on disk now,
+        // so a repack while the game runs cannot pair new pixels with the old contents.
+        std::optional<BlobKey> key_of(const AssetArchive& archive, std::string_view path) {
+            if (!archive.is_open()) return std::nullopt;
+            return BlobKey{canonical_name(archive.path()) + "#" + normalize_asset_path(path),
+                           SourceStamp{archive.size_bytes(), archive.write_time()}};
+        }
+
+        std::filesystem::path blob_path(const std::filesystem::path& directory, const BlobKey& key) {
+            char name[17];
+            std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(fnv1a64(key.name)));
+            return directory / (std::string(name) + BLOB_EXTENSION);
+        }
+
+        // Map the blob for 'key' and validate it against the key's stamp.
+        bool open_blob(const std::filesystem::path& directory, const BlobKey& key, MappedFile& file, BlobHeader& header) {
+            if (!file.open(blob_path(directory, key))) return false;
+            if (file.size() < sizeof(header)) return false;
+            std::memcpy(&header, file.data(), sizeof(header));
+            const auto pixel_bytes = static_cast<std::size_t>(header.width) * header.height * 4u;
+            return header.magic == CACHE_MAGIC && header.version == CACHE_VERSION &&
+                   header.source_size == key.stamp.size && header.source_mtime == key.stamp.mtime &&
+                   pixel_bytes > 0 && file.size() == sizeof(header) + pixel_bytes;
+        }
+
+        bool read_image(const std::filesystem::path& directory, const BlobKey& key, sf::Image& image) {
+            MappedFile file;
+            BlobHeader header;
+            if (!open_blob(directory, key, file, header)) return false;
+            image.resize({header.width, header.height}, file.data() + sizeof(header));
+            return true;
+        }
+
+        bool read_texture(const std::filesystem::path& directory, const BlobKey& key, sf::Texture& texture) {
+            MappedFile file;
+            BlobHeader header;
+            if (!open_blob(directory, key, file, header)) return false;
+            // Upload straight from the mapping; no intermediate sf::Image copy.
+            if (!texture.resize({header.width, header.height})) return false;
+            texture.update(file.data() + sizeof(header));
+            return true;
+        }
+
+        bool write_blob(const std::filesystem::path& directory, const BlobKey& key, const sf::Image& image) {
+            const auto size = image.getSize();
+            if (size.x == 0 || size.y == 0) return false;
+
+            std::error_code ec;
+            std::filesystem::create_directories(directory, ec);
+            if (ec) {
+                std::cerr << "TextureCache: cannot create '" << directory.string() << "': " << ec.message() << std::endl;
+                return false;
+            }
+
+            BlobHeader header;
+            header.source_size = key.stamp.size;
+            header.source_mtime = key.stamp.mtime;
+            header.width = size.x;
+            header.height = size.y;
+
+            // Write to a per-thread temporary and rename, so readers never see a partial blob.
+            const auto target = blob_path(directory, key);
+            std::ostringstream suffix;
+            suffix << ".tmp" << std::hash<std::thread::id>{}(std::this_thread::get_id());
+            auto temp = target;
+            temp += suffix.str();
+            {
+                std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                out.write(reinterpret_cast<const char*>(image.getPixelsPtr()),
+                          static_cast<std::streamsize>(static_cast<std::size_t>(size.x) * size.y * 4u));
+                if (!out) {
+                    std::filesystem::remove(temp, ec);
+                    return false;
+                }
+            }
+            std::filesystem::rename(temp, target, ec);
+            if (ec) {
+                std::filesystem::remove(temp, ec);
+                return false;
+            }
+            return true;
+        }
+    }
+
+    TextureCache::TextureCache(std::filesystem::path directory) : _directory(std::move(directory)) {}
+
+    std::filesystem::path TextureCache::default_directory() {
+        return std::filesystem::path(".zia_cache") / "textures";
+    }
+
+    bool TextureCache::load_image(const std::filesystem::path& source, sf::Image& image) const {
+        const auto key = key_of(source);
+        return key && read_image(_directory, *key, image);
+    }
+
+    bool TextureCache::load_texture(const std::filesystem::path& source, sf::Texture& texture) const {
+        const auto key = key_of(source);
+        return key && read_texture(_directory, *key, texture);
+    }
+
+    bool TextureCache::store(const std::filesystem::path& source, const sf::Image& image) const {
+        const auto key = key_of(source);
+        return key && write_blob(_directory, *key, image);
+    }
+
+    TextureCache::DecodeResult TextureCache::decode(const std::filesystem::path& source, sf::Image& image) const {
+        if (load_image(source, image)) return DecodeResult::Hit;
+        if (!image.loadFromFile(source)) return DecodeResult::Failed;
+        // A failed store only costs the next launch another decode.
+        (void)store(source, image);
+        return DecodeResult::Miss;
+    }
+
+    bool TextureCache::load_image(const AssetArchive& archive, std::string_view path, sf::Image& image) const {
+        const auto blob = archive.find(path);
+        if (!blob) return false;
+        if (blob->predecoded) return archive.load_image(path, image);
+        const auto key = key_of(archive, path);
+        return key && read_image(_directory, *key, image);
+    }
+
+    bool TextureCache::load_texture(const AssetArchive& archive, std::string_view path, sf::Texture& texture) const {
+        const auto blob = archive.find(path);
+        if (!blob) return false;
+        if (blob->predecoded) return archive.load_texture(path, texture);
+        const auto key = key_of(archive, path);
+        return key && read_texture(_directory, *key, texture);
+    }
+
+    bool TextureCache::store(const AssetArchive& archive, std::string_view path, const sf::Image& image) const {
+        const auto blob = archive.find(path);
+        if (!blob || blob->predecoded) return false;
+        const auto key = key_of(archive, path);
+        return key && write_blob(_directory, *key, image);
+    }
+
+    TextureCache::DecodeResult TextureCache::decode(const AssetArchive& archive, std::string_view path, sf::Image& image) const {
+        const auto blob = archive.find(path);
+        if (!blob) return DecodeResult::Failed;
+        if (blob->predecoded) return archive.load_image(path, image) ? DecodeResult::Hit : DecodeResult::Failed;
+        if (load_image(archive, path, image)) return DecodeResult::Hit;
+        if (!image.loadFromMemory(blob->data, blob->size)) return DecodeResult::Failed;
+        (void)store(archive, path, image);
+        return DecodeResult::Miss;
+    }
+
+    std::size_t TextureCache::clear() const {
+        std::size_t removed = 0;
+        std::error_code ec;
+        if (!std::filesystem::is_directory(_directory, ec)) return 0;
+        for (const auto& item : std::filesystem::directory_iterator(_directory, ec)) {
+            if (item.path().extension() == BLOB_EXTENSION && std::filesystem::remove(item.path(), ec)) {
+                ++removed;
+            }
+        }
+        return removed;
+    }
+
+    std::shared_ptr<const TextureCache> open_default_texture_cache() {
+        const char* env = std::getenv("ZIA_TEXTURE_CACHE");
+        if (!env || *env == '\0') {
+            return std::make_shared<TextureCache>();
+        }
+        if (std::string_view(env) == "0") {
+            return nullptr;
+        }
+        return std::make_shared<TextureCache>(env);
+    }
+} // namespace zia::engine
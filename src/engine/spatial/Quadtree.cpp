@@ -4,20 +4,36 @@
 
 namespace zia::engine::spatial {
 
+namespace {
+    // Strict AABB overlap test (touching edges do not count as overlap).
+    bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b)
+    {
+        return a.position.x < b.position.x + b.size.x && a.position.x + a.size.x > b.position.x &&
+               a.position.y < b.position.y + b.size.y && a.position.y + a.size.y > b.position.y;
+    }
+}
+
 Quadtree::Quadtree(int level, const sf::FloatRect& bounds) : _level(level), _bounds(bounds)
 {
-    _quadTiles.reserve(MAX_OBJECTS);
-    _nodes.reserve(4);
 }
 
 void Quadtree::clear()
 {
     _quadTiles.clear();
-    for (auto& node : _nodes)
+    if (_split)
     {
-        node.clear();
+        for (auto& node : _nodes)
+        {
+            node.clear();
+        }
     }
-    _nodes.clear();
+    _split = false;
+}
+
+void Quadtree::reset(const sf::FloatRect& bounds)
+{
+    clear();
+    _bounds = bounds;
 }
 
 void Quadtree::split()
@@ -27,10 +43,29 @@ void Quadtree::split()
     const float x = _bounds.position.x;
     const float y = _bounds.position.y;
 
-    _nodes.emplace_back(_level + 1, sf::FloatRect({x + subWidth, y}, {subWidth, subHeight}));
-    _nodes.emplace_back(_level + 1, sf::FloatRect({x, y}, {subWidth, subHeight}));
-    _nodes.emplace_back(_level + 1, sf::FloatRect({x, y + subHeight}, {subWidth, subHeight}));
-    _nodes.emplace_back(_level + 1, sf::FloatRect({x + subWidth, y + subHeight}, {subWidth, subHeight}));
+    const sf::FloatRect quadrants[4] = {
+        sf::FloatRect({x + subWidth, y}, {subWidth, subHeight}),
+        sf::FloatRect({x, y}, {subWidth, subHeight}),
+        sf::FloatRect({x, y + subHeight}, {subWidth, subHeight}),
+        sf::FloatRect({x + subWidth, y + subHeight}, {subWidth, subHeight}),
+    };
+    if (_nodes.empty())
+    {
+        _nodes.reserve(4);
+        for (const auto& quadrant : quadrants)
+        {
+            _nodes.emplace_back(_level + 1, quadrant);
+        }
+    }
+    else
+    {
+        // Children left over from an earlier build are cleared already; only their bounds change.
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            _nodes[i]._bounds = quadrants[i];
+        }
+    }
+    _split = true;
 }
 
 int Quadtree::getIndex(const sf::FloatRect& rect) const
@@ -57,7 +92,7 @@ int Quadtree::getIndex(const sf::FloatRect& rect) const
 
 void Quadtree::insert(const QuadTile& tile)
 {
-    if (!_nodes.empty())
+    if (_split)
     {
         int index = getIndex(tile.bounds);
         if (index != -1)
@@ -71,7 +106,7 @@ void Quadtree::insert(const QuadTile& tile)
 
     if (_quadTiles.size() > MAX_OBJECTS && _level < MAX_LEVELS)
     {
-        if (_nodes.empty()) split();
+        if (!_split) split();
         size_t i = 0;
         while (i < _quadTiles.size())
         {
@@ -91,16 +126,39 @@ void Quadtree::insert(const QuadTile& tile)
     }
 }
 
-std::vector<QuadTile> Quadtree::retrieve(std::vector<QuadTile>& returnObjects, const sf::FloatRect& rect) const
+void Quadtree::retrieve(std::vector<QuadTile>& returnObjects, const sf::FloatRect& rect) const
 {
     int index = getIndex(rect);
-    if (index != -1 && !_nodes.empty())
+    if (index != -1 && _split)
     {
         _nodes[index].retrieve(returnObjects, rect);
     }
 
     returnObjects.insert(returnObjects.end(), _quadTiles.begin(), _quadTiles.end());
-    return returnObjects;
+}
+
+void Quadtree::query(const sf::FloatRect& area, std::vector<QuadTile>& out) const
+{
+    for (const auto& tile : _quadTiles)
+    {
+        if (overlaps(tile.bounds, area)) out.push_back(tile);
+    }
+
+    if (!_split) return;
+    for (const auto& node : _nodes)
+    {
+        if (overlaps(node._bounds, area)) node.query(area, out);
+    }
+}
+
+void Quadtree::visit(const std::function<void(const sf::FloatRect&, int, std::size_t)>& visitor) const
+{
+    visitor(_bounds, _level, _quadTiles.size());
+    if (!_split) return;
+    for (const auto& node : _nodes)
+    {
+        node.visit(visitor);
+    }
 }
 
 void Quadtree::print(int level) const
@@ -110,6 +168,7 @@ void Quadtree::print(int level) const
     {
         std::cout << "Tile: " << tile.bounds.position.x << ", " << tile.bounds.position.y << ", " << tile.bounds.size.x << ", " << tile.bounds.size.y << std::endl;
     }
+    if (!_split) return;
     for (const auto& node : _nodes)
     {
         node.print(level + 1);
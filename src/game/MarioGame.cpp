@@ -2,6 +2,12 @@
 
 #include "Zia/game/MarioGame.hpp"
 #include "Zia/game/MenuScene.hpp"
+#include "Zia/game/PlayScene.hpp"
+#include "Zia/game/helpers/Spawner.hpp"
+#include "Zia/game/systems/ChunkStreamingSystem.hpp"
+#include "Zia/game/world/WorldSnapshot.hpp"
+#include "Zia/engine/input/InputRecorder.hpp"
+#include "Zia/engine/input/InputReplay.hpp"
 #include "Zia/engine/adapters/SceneAdapter.hpp"
 #include "Zia/engine/EngineConfig.hpp"
 #include "Zia/engine/audio/AudioManager.hpp"
@@ -9,16 +15,35 @@
 #include "Zia/game/ui/MainMenuBar.hpp"
 
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
 #include <memory>
+#include <random>
+#include <string_view>
 
 // ImGui is accessed via UIManager to centralize lifecycle and rendering.
 
 namespace zia {
+    namespace {
+        constexpr float RECORDING_DT = 1.0f / 60.0f;
+    }
+
     // Construct: create the underlying engine application which owns subsystems.
     Game::Game()
         : _app(std::make_unique<engine::Application>("Zia")),
           _settings(std::make_shared<engine::EngineConfig>())
     {
+        // Frame pacing overrides: ZIA_TARGET_FPS=<n> (0 = uncapped) and ZIA_VSYNC=1. Read before the
+        // observer is registered, which would otherwise also apply the default window size.
+        if (const char* env = std::getenv("ZIA_TARGET_FPS")) {
+            _settings->set_target_fps(std::atoi(env));
+        }
+        if (const char* env = std::getenv("ZIA_VSYNC")) {
+            _settings->set_vsync(std::string_view(env) == "1");
+        }
+
         // Register observer to apply runtime-visible changes (resize, volume)
         // Keep observer id if needed later (not currently unregistered; acceptable for app lifetime)
         _settings->register_observer([this](const engine::EngineConfig &cfg) {
@@ -28,6 +53,13 @@ namespace zia {
             } catch (...) {
                 // Renderer may not expose setSize; ignore errors and leave as best-effort.
             }
+            // Apply the texture cache budget
+            _app->assets().set_memory_budget(static_cast<std::size_t>(cfg.texture_budget_mb()) * 1024u * 1024u);
+            // Apply frame pacing; skip unchanged values so other settings do not restart the pacer's schedule
+            if (cfg.target_fps() != _app->frame_pacer().target_fps()) {
+                _app->frame_pacer().set_target_fps(cfg.target_fps());
+            }
+            _app->renderer().set_vsync(cfg.vsync());
             // Apply master volume if audio manager exists in application (best-effort)
             try {
                 // The engine's AudioManager currently lives in src/engine/audio; call set_volume globally if accessible.
@@ -38,6 +70,16 @@ namespace zia {
             }
         });
 
+        // Opt into the render thread with ZIA_RENDER_THREAD=1. It has to be chosen before any scene
+        // captures the renderer interface, so it is applied here rather than from the settings observer.
+        if (const char* env = std::getenv("ZIA_RENDER_THREAD")) {
+            _settings->set_render_thread(std::string_view(env) == "1");
+        }
+        _app->set_threaded_rendering(_settings->render_thread());
+        _app->assets().set_memory_budget(static_cast<std::size_t>(_settings->texture_budget_mb()) * 1024u * 1024u);
+        _app->frame_pacer().set_target_fps(_settings->target_fps());
+        _app->renderer().set_vsync(_settings->vsync());
+
         // Register overlay using the MainMenuBar utility (namespaced in zia::ui)
         _app->set_ui_overlay([this]() {
             zia::ui::draw_main_menu_bar(*this, _menu_show_settings);
@@ -54,9 +96,61 @@ namespace zia {
 
     // Shutdown is forwarded to the engine application.
     void Game::shutdown() {
+        if (_recorder) {
+            if (_recorder->save(_recording_path)) {
+                std::cout << "Recorded " << _recorder->recording().ticks.size() << " ticks to " << _recording_path.string() << std::endl;
+            }
+            _recorder.reset();
+        }
+        if (_replay) {
+            std::cout << "Replayed " << _replay->ticks_played() << "/" << _replay->recording().ticks.size() << " ticks";
+            if (const auto matches = _replay->state_matches()) {
+                std::cout << (*matches ? ": final state matches the recording" : ": final state DIVERGED from the recording");
+            }
+            std::cout << std::endl;
+            _replay.reset();
+        }
         _app->shutdown();
     }
 
+    // Used by: main (--record)
+    void Game::record_input(const std::filesystem::path &path, std::string level_path) {
+        engine::InputRecording recording;
+        recording.level_path = level_path;
+        recording.seed = std::random_device{}();
+        recording.dt = RECORDING_DT;
+
+        Spawner::set_random_seed(recording.seed);
+        ChunkStreamingSystem::set_deterministic(true);
+        _app->set_fixed_timestep(recording.dt);
+        _app->frame_pacer().set_target_fps(static_cast<int>(std::lround(1.0f / recording.dt)));
+        _recorder = std::make_shared<engine::InputRecorder>(_app->shared_input(), std::move(recording),
+                                                            [this]() { return world_state_hash(); });
+        _app->set_input(_recorder);
+        _recording_path = path;
+        _start_level = std::move(level_path);
+    }
+
+    // Used by: main (--replay)
+    bool Game::replay_input(const std::filesystem::path &path) {
+        engine::InputRecording recording;
+        if (!engine::load_input_recording(path, recording)) {
+            return false;
+        }
+        Spawner::set_random_seed(recording.seed);
+        ChunkStreamingSystem::set_deterministic(true);
+        _app->set_fixed_timestep(recording.dt);
+        _app->frame_pacer().set_target_fps(static_cast<int>(std::lround(1.0f / recording.dt)));
+        _start_level = recording.level_path;
+        _replay = std::make_shared<engine::InputReplay>(std::move(recording), [this]() { return world_state_hash(); });
+        _app->set_input(_replay);
+        return true;
+    }
+
+    std::uint64_t Game::world_state_hash() const {
+        return zia::world_state_hash(_app->underlying_entity_manager());
+    }
+
     // Run the full lifecycle through the engine application.
     void Game::run() {
         // Allow Game to perform any game-specific setup before run if needed.
@@ -111,10 +205,15 @@ namespace zia {
         return _settings;
     }
 
-    // Hook: if no scene is present, maintain previous behavior and push MenuScene.
+    // Hook: if no scene is present, maintain previous behavior and push MenuScene. Recordings and
+    // replays start straight in their level, since the menu reads the keyboard directly.
     void Game::before_loop() {
         if (!_app->current_scene()) {
-            push_scene(std::make_shared<MenuScene>(*this));
+            if (!_start_level.empty()) {
+                push_scene(std::make_shared<PlayScene>(*this, _start_level));
+            } else {
+                push_scene(std::make_shared<MenuScene>(*this));
+            }
         }
     }
 } // namespace Zia
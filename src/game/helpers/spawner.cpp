@@ -17,6 +17,7 @@
 #include "Zia/engine/ecs/components/AnimationComponent.hpp"
 #include "Zia/engine/ecs/components/CloudComponent.hpp"
 #include "Zia/engine/resources/AssetManager.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
 #include <algorithm>
 #include <cctype>
 #include <random>
@@ -31,6 +32,9 @@ namespace {
         });
         return value;
     }
+
+    // Set through Spawner::set_random_seed; empty = a fresh seed per spawn.
+    std::optional<std::uint32_t> random_seed;
 }
 
 namespace zia {
@@ -39,6 +43,7 @@ namespace zia {
     // Component composition: Position, Velocity, Size, Input, JumpState, PlayerStats, Type, Collision, Sprite.
     // This ensures the entity will be correctly processed by all relevant systems (movement, physics, input, collision, render).
     EntityID Spawner::spawn_player(zia::engine::IEntityManager &registry, const EntitySpawn &spawn, zia::engine::IAssetManager& assets) {
+        ZIA_PROFILE_SCOPE("spawn_player");
         using namespace zia::constants;
 
         // Do not load textures here during spawn; assume assets are preloaded by the caller.
@@ -89,6 +94,7 @@ namespace zia {
     // Spawns a player entity at the default position (used for initial/fallback spawning).
     // Same component composition as spawn_player but at fixed coordinates.
     EntityID Spawner::spawn_player_default(zia::engine::IEntityManager &registry, zia::engine::IAssetManager& assets) {
+        ZIA_PROFILE_SCOPE("spawn_player");
         using namespace zia::constants;
 
         // Do not load textures here during spawn; assume the caller preloads assets.
@@ -134,9 +140,10 @@ namespace zia {
     // Component composition: Position, Velocity, Size, Collision, Enemy, Type, Sprite.
     // Enemies follow platforms and reverse direction on collision (see EnemySystem).
     void Spawner::spawn_enemy(zia::engine::IEntityManager &registry, const EntitySpawn &spawn) {
+        ZIA_PROFILE_SCOPE("spawn_enemy");
         using namespace zia::constants;
 
-        const std::string type_str = to_lower(spawn.type);
+        const std::string type_str = to_lower(std::string(spawn.type));
         EntityID entity = registry.create_entity();
 
         const auto tile_size = static_cast<float>(TILE_SIZE);
@@ -182,10 +189,21 @@ namespace zia {
         }
     }
 
+    // Used by: Game (input recording / replay)
+    void Spawner::set_random_seed(std::optional<std::uint32_t> seed) {
+        ::random_seed = seed;
+    }
+
+    // Used by: WorldSnapshot
+    std::optional<std::uint32_t> Spawner::random_seed() {
+        return ::random_seed;
+    }
+
     // Used by: CloudSystem (initialization)
     // Spawns all cloud entities with randomized positions and loads textures.
     // Creates three layers of clouds (Big, Medium, Small) for parallax depth effect.
     void Spawner::spawn_clouds(zia::engine::IEntityManager& registry, zia::engine::IAssetManager& assets) {
+        ZIA_PROFILE_SCOPE("spawn_clouds");
         using namespace zia::constants;
 
         // Load cloud textures into asset manager
@@ -194,8 +212,7 @@ namespace zia {
         // assets.load_texture(CLOUD_SMALL_ID, "assets/environment/background/cloud_small.png");
 
         // Set up random distribution for cloud Y positions
-        std::random_device rd;
-        std::mt19937 gen(rd());
+        std::mt19937 gen(::random_seed ? *::random_seed : std::random_device{}());
         std::uniform_real_distribution<float> big_y_dist(CLOUD_BIG_Y_MIN, CLOUD_BIG_Y_MAX);
         std::uniform_real_distribution<float> med_y_dist(CLOUD_MEDIUM_Y_MIN, CLOUD_MEDIUM_Y_MAX);
         std::uniform_real_distribution<float> small_y_dist(CLOUD_SMALL_Y_MIN, CLOUD_SMALL_Y_MAX);
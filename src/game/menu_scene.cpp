@@ -11,7 +11,6 @@
 #include "Zia/engine/EngineConfig.hpp"
 #include <imgui.h>
 #include <iostream>
-#include <SFML/Graphics/Sprite.hpp>
 // Editor UI toggle
 #include "Zia/editor/EditorUI.hpp"
 #include "Zia/game/systems/InspectorSystem.hpp"
@@ -143,38 +142,21 @@ namespace zia {
         if (_use_menu_background) {
             auto tex_ptr = _game.assets().get_texture(tex_id);
             if (tex_ptr) {
-                // Draw the texture stretched to fill the viewport (fill behavior requested).
-                // Draw in UI/screen space (default view) so camera/world transforms do not affect scaling.
-                sf::RenderWindow &window = _game.renderer().window();
-                auto old_view = window.getView();
-
-                // Query window and texture sizes first
-                const auto win_size = window.getSize();
-                const float win_w = static_cast<float>(win_size.x);
-                const float win_h = static_cast<float>(win_size.y);
+                // Draw the texture stretched to fill the screen (fill behavior requested), in screen space
+                // so camera/world transforms do not affect scaling.
+                const auto screen_size = _game.renderer().window().getDefaultView().getSize();
                 const auto tex_size = tex_ptr->getSize();
                 const float tex_w = static_cast<float>(tex_size.x);
                 const float tex_h = static_cast<float>(tex_size.y);
 
-                // Use an explicit UI view mapped 1:1 to window pixels to avoid any camera/world transforms
-                sf::View ui_view;
-                ui_view.setSize({win_w, win_h});
-                ui_view.setCenter({win_w * 0.5f, win_h * 0.5f});
-                window.setView(ui_view);
-
-                sf::Sprite sprite(*tex_ptr);
-                // Ensure origin is top-left; sprite uses full texture by default so explicit texture rect is unnecessary.
-                sprite.setOrigin({0.0f, 0.0f});
-
-                // Scale to window pixel size (fill)
+                // Scale to screen size (fill)
+                float scale_x = 1.0f;
+                float scale_y = 1.0f;
                 if (tex_w > 0.0f && tex_h > 0.0f) {
-                    const float scale_x = win_w / tex_w;
-                    const float scale_y = win_h / tex_h;
-                    sprite.setScale({ scale_x, scale_y });
+                    scale_x = screen_size.x / tex_w;
+                    scale_y = screen_size.y / tex_h;
                 }
-                sprite.setPosition({0.0f, 0.0f});
-                window.draw(sprite);
-                window.setView(old_view);
+                _game.renderer().draw_screen_sprite(*tex_ptr, 0.0f, 0.0f, scale_x, scale_y, sf::IntRect());
              } else {
                  // Fallback: solid color covering the whole viewport
                  _game.renderer().draw_rect(0.0f, 0.0f, viewport.x, viewport.y, sf::Color(20, 20, 20));
@@ -186,7 +168,14 @@ namespace zia {
         // The global UI overlay draws the main menu bar. MenuScene no longer draws the top bar
         // to avoid duplicate menu entries when the overlay is active.
 
-        // Note: Menu-specific UI (level selection grid) is still drawn via this scene's other code paths.
+        // Level selection labels: retained texts, so only a selection change (colour) touches their geometry.
+        const float top = static_cast<float>(_game.ui().menu_bar_height());
+        for (size_t i = 0; i < _level_texts.size(); ++i) {
+            auto& text = _level_texts[i];
+            text.set_position(40.0f, top + 40.0f + static_cast<float>(i) * 36.0f);
+            text.set_color(static_cast<int>(i) == _selected_index ? sf::Color(255, 220, 0) : sf::Color::White);
+            text.render();
+        }
 
         // end_frame() is called by Game::main_loop()
      }
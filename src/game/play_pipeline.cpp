@@ -0,0 +1,500 @@
+// Implements PlayPipeline, the gameplay of a running level: level loading and entity spawning, the
+// ordered update and render system pipelines, next-level prefetching and snapshot restarts.
+
+#include "Zia/game/PlayPipeline.hpp"
+#include "Zia/game/world/Camera.hpp"
+#include "Zia/engine/ecs/components/BackgroundComponent.hpp"
+#include "Zia/engine/ecs/components/NameComponent.hpp"
+#include "Zia/game/helpers/Spawner.hpp"
+#include "Zia/game/world/TileMap.hpp"
+#include "Zia/game/helpers/Constants.hpp"
+#include "Zia/game/systems/CollisionSystem.hpp"
+#include "Zia/game/systems/LevelSystem.hpp"
+#include "Zia/game/systems/ChunkStreamingSystem.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
+#include "Zia/engine/ecs/components/PositionComponent.hpp"
+#include "Zia/engine/adapters/EntityManagerAdapter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace zia {
+
+    // Used by: PlayScene (constructor), HeadlessSession
+    PlayPipeline::PlayPipeline(zia::engine::IEntityManager &registry, zia::engine::IRenderer &renderer,
+                               zia::engine::IAssetManager &assets, zia::engine::IInput &input, std::string level_path)
+        : _registry(registry), _renderer(renderer), _assets(assets), _input(input), _hud(renderer),
+          _current_level_path(std::move(level_path)) {
+    }
+
+    PlayPipeline::~PlayPipeline() = default;
+
+    // Used by: PlayScene::on_enter, HeadlessSession::load and restarts that reload the level
+    // Loads the level synchronously, spawns its entities, builds the system pipelines and starts
+    // prefetching the level that follows it.
+    void PlayPipeline::enter() {
+        ZIA_PROFILE_SCOPE("level_enter");
+        // Mark background cache dirty for this level load.
+        _background_cache_dirty = true;
+        _sorted_backgrounds.clear();
+
+        // Load the level data from the configured path into the Level object.
+        _level.load(_current_level_path);
+        // The level's entities keep their component stores in its arena; exit clears them before
+        // the level is unloaded.
+        _registry.underlying().set_memory_resource(_level.component_memory());
+
+        // Each level load uses the other background slot, so the texture ids of the previous level
+        // are never overwritten while their replacements are still streaming.
+        _background_slot = (_background_slot + 1) % zia::constants::LEVEL_BACKGROUND_SLOTS;
+        _player_id = populate_level(_level, _current_level_path, _background_slot, _registry, _retained_textures);
+
+        start_level();
+        start_prefetch();
+    }
+
+    // Used by: enter and poll_prefetch
+    // Streams the level's textures and creates its entities in 'registry'. Touches no pipeline state,
+    // so it can fill either the live registry or a prepared level's standalone one.
+    EntityID PlayPipeline::populate_level(Level &level, const std::string &level_path, int background_slot,
+                                          zia::engine::IEntityManager &registry, std::vector<int> &retained) {
+        // Background path is used for preloading; fetch it before starting preload.
+        const std::string_view level_bg_path = level.background_path();
+
+        // Stream the level's textures. Files are decoded on the asset workers and the application
+        // uploads finished images within a per-frame budget, so entering a level never blocks on I/O;
+        // entities created below draw a placeholder until their texture is ready.
+        // Every texture the level streams is retained until the level is left so the cache never evicts it mid-level.
+        using zia::engine::AssetPriority;
+        auto& assets = _assets;
+        auto stream_texture = [&assets, &retained](int id, std::string_view path, AssetPriority priority) {
+            ZIA_PROFILE_SCOPE("texture_request");
+            assets.request_texture(id, std::string(path), priority);
+            assets.retain_texture(id);
+            retained.push_back(id);
+        };
+        stream_texture(zia::constants::PLAYER_IDLE_ID, "assets/Sprites/Player64/Idle.png", AssetPriority::High);
+        stream_texture(zia::constants::PLAYER_RUN_ID, "assets/Sprites/Player64/Run.png", AssetPriority::High);
+        stream_texture(zia::constants::PLAYER_JUMP_ID, "assets/Sprites/Player64/Jump.png", AssetPriority::High);
+        // Celebrate animation is needed as soon as the player stomps an enemy.
+        stream_texture(zia::constants::PLAYER_CELEBRATE_ID, "assets/Sprites/Player64/Celebrate.png", AssetPriority::Normal);
+        // Clouds are decorative and can pop in last.
+        stream_texture(zia::constants::CLOUD_BIG_ID, "assets/environment/background/cloud_big.png", AssetPriority::Low);
+        stream_texture(zia::constants::CLOUD_MEDIUM_ID, "assets/environment/background/cloud_medium.png", AssetPriority::Low);
+        stream_texture(zia::constants::CLOUD_SMALL_ID, "assets/environment/background/cloud_small.png", AssetPriority::Low);
+
+        // Tileset images for the level geometry, in this level's slot like the backgrounds.
+        if (const auto tile_map = level.tile_map(); tile_map && tile_map->tileset()) {
+            const auto &images = tile_map->tileset()->images();
+            for (std::size_t i = 0; i < images.size(); ++i) {
+                if (static_cast<int>(i) >= zia::constants::TILESET_MAX_IMAGES) {
+                    std::cerr << "PlayPipeline: too many tileset images for " << level_path << ", ignoring the rest\n";
+                    break;
+                }
+                stream_texture(zia::constants::tileset_texture_id(background_slot, static_cast<int>(i)), images[i], AssetPriority::High);
+            }
+            level.bind_tileset_textures(zia::constants::tileset_texture_id(background_slot, 0));
+        }
+
+        // Background loading (level dependent)
+        if (!level_bg_path.empty()) {
+            // Create the main background entity. BackgroundSystem will attach a BackgroundComponent
+            // configured with scale, parallax and tiling parameters.
+            const int background_id = zia::constants::background_texture_id(background_slot, 0);
+            stream_texture(background_id, level_bg_path, AssetPriority::High);
+            _background_system.create_background_entity(registry, background_id, true, BackgroundComponent::ScaleMode::Fill,
+                                     level.background_scale(), 0.0f, false, false, 0.0f, 0.0f);
+
+            // Additional background layers defined in the level file, one texture id per layer.
+            int layer_index = 1;
+            for (const auto &layer: level.background_layers()) {
+                if (layer_index >= zia::constants::LEVEL_BACKGROUND_MAX_LAYERS) {
+                    std::cerr << "PlayPipeline: too many background layers in " << level_path << ", ignoring the rest\n";
+                    break;
+                }
+                const int texture_id = zia::constants::background_texture_id(background_slot, layer_index++);
+                stream_texture(texture_id, layer.path, AssetPriority::Normal);
+                // Create a background entity for this layer; parallax and repeating handled by BackgroundSystem.
+                _background_system.create_background_entity(registry, texture_id, true, BackgroundComponent::ScaleMode::Fit, layer.scale,
+                                         layer.parallax, layer.repeat, layer.repeat_x, 0.0f, 0.0f);
+            }
+        }
+
+        // Initialize clouds if the level enables them. CloudSystem will create cloud entities/components.
+        if (level.clouds_enabled()) {
+            _cloud_system.initialize(assets, registry);
+        }
+
+        // Spawn the player declared in the level; enemies are spawned by ChunkStreamingSystem as their
+        // chunks stream in.
+        EntityID player_id = 0;
+        if (const auto index = level.player_spawn_index()) {
+            const auto &spawn = level.entity_spawns()[*index];
+            level.consume_spawn(*index);
+            // Spawn the player using the Spawner helper which configures components and assets.
+            player_id = Spawner::spawn_player(registry, spawn, assets);
+            // If the level specified a name for the spawn, add a NameComponent so inspectors show it.
+            if (!spawn.name.empty()) {
+                registry.add_component<zia::NameComponent>(player_id, {std::string(spawn.name)});
+            }
+        } else {
+            // Fallback: spawn a default player if no player spawn was found in the level.
+            player_id = Spawner::spawn_player_default(registry, assets);
+        }
+
+        // Make the chunks around the player resident (and spawn their enemies) before the first frame.
+        if (const auto pos_opt = registry.get_component<PositionComponent>(player_id)) {
+            const float view_w = _renderer.viewport_size().x;
+            ChunkStreamingSystem::prime(registry, level, pos_opt->get().x - view_w, pos_opt->get().x + view_w);
+        }
+        return player_id;
+    }
+
+    // Used by: start_level and update
+    // Reserve the top inset (menu bar) by converting its UI pixels to world units using the camera scale.
+    float PlayPipeline::view_height() const {
+        const float world_menu_h = static_cast<float>(_top_inset) * _renderer.camera_scale();
+        return std::max(0.0f, _renderer.viewport_size().y - world_menu_h);
+    }
+
+    // Used by: enter and switch_to_prepared_level
+    // Initializes the camera for the current level and prepares the per-frame system pipelines.
+    void PlayPipeline::start_level() {
+        // Initialize camera via CameraSystem. This sets the viewport and optionally centers on the player.
+        if (auto camera = _level.camera()) {
+            // Apply an initial horizontal offset to make enter-damping visible to the player.
+            _camera_system.initialize(_registry, *camera, _renderer.viewport_size().x, view_height(), _player_id, -100.0f, 0.0f);
+        }
+
+        _level_transition_delay = 0.5f; // LevelTransitionCooldown
+        setup_systems();
+
+        capture_snapshot(_level_start);
+    }
+
+    // Used by: enter and switch_to_prepared_level
+    // Parses the level that follows the current one on a worker thread. Level::load only reads and
+    // parses files; textures and entities are handled on the main thread by poll_prefetch. Loading into
+    // a recycled level reuses its arena block, which is already sized for a level.
+    void PlayPipeline::start_prefetch(Level recycled) {
+        cancel_prefetch();
+        _prefetch_path = std::string(zia::constants::next_level_path(_current_level_path));
+        _prefetch = std::async(std::launch::async, [path = _prefetch_path, level = std::move(recycled)]() mutable {
+            zia::engine::Profiler::instance().set_thread_name("level_prefetch");
+            level.load(path);
+            return std::move(level);
+        });
+    }
+
+    // Used by: update (per-frame)
+    // When the background parse is done, stream the prefetched level's textures into the other
+    // background slot and spawn its entities into a standalone registry. This runs once per
+    // prefetch and costs about as much as creating the level's few entities.
+    void PlayPipeline::poll_prefetch() {
+        if (!_prefetch.valid() || _prefetch.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+
+        auto prepared = std::make_unique<PreparedLevel>();
+        prepared->path = _prefetch_path;
+        prepared->level = _prefetch.get();
+        prepared->entities = std::make_shared<zia::EntityManager>();
+        prepared->entities->set_memory_resource(prepared->level.component_memory());
+        prepared->background_slot = (_background_slot + 1) % zia::constants::LEVEL_BACKGROUND_SLOTS;
+        zia::engine::adapters::EntityManagerAdapter registry(prepared->entities);
+        prepared->player_id = populate_level(prepared->level, prepared->path, prepared->background_slot,
+                                             registry, prepared->retained_textures);
+        _prepared = std::move(prepared);
+    }
+
+    // Used by: exit and start_prefetch
+    // Drops any prefetched level. A parse still in flight is waited for (it only touches its own Level).
+    void PlayPipeline::cancel_prefetch() {
+        if (_prefetch.valid()) {
+            _prefetch.wait();
+            _prefetch = std::future<Level>();
+        }
+        if (_prepared) {
+            for (const int id : _prepared->retained_textures) {
+                _assets.release_texture(id);
+            }
+            _prepared.reset();
+        }
+    }
+
+    // Used by: handle_level_transitions
+    // Swaps the prepared level in. The previous level's entities end up in the prepared registry and
+    // are destroyed before the previous level is unloaded; its textures are released so the cache may
+    // evict them later. The previous Level then carries its storage and arena into the next prefetch,
+    // so the two Levels alternate between running and prefetching.
+    void PlayPipeline::switch_to_prepared_level() {
+        auto prepared = std::move(_prepared);
+
+        _sorted_backgrounds.clear();
+        _background_cache_dirty = true;
+
+        for (const int id : _retained_textures) {
+            _assets.release_texture(id);
+        }
+        _retained_textures = std::move(prepared->retained_textures);
+
+        _registry.underlying().swap(*prepared->entities);
+        // The previous level's components live in its arena: destroy them before releasing it.
+        prepared->entities->clear();
+        Level previous = std::move(_level);
+        previous.unload();
+        _level = std::move(prepared->level);
+        _player_id = prepared->player_id;
+        _background_slot = prepared->background_slot;
+
+        start_level();
+        start_prefetch(std::move(previous));
+    }
+
+    // Used by: PlayScene::on_exit, HeadlessSession and restarts that reload the level
+    // Clears the registry and unloads level resources.
+    void PlayPipeline::exit() {
+        // A prepared level would otherwise keep its textures retained after the level is left.
+        cancel_prefetch();
+
+        // Clear cached background data as entities are about to be destroyed.
+        _sorted_backgrounds.clear();
+        _background_cache_dirty = true;
+
+        // Level textures become ordinary cache entries again (evicted when memory is needed).
+        for (const int id : _retained_textures) {
+            _assets.release_texture(id);
+        }
+        _retained_textures.clear();
+
+        // Remove all entities/components related to this level.
+        _registry.clear();
+        _player_id = 0;
+        _level.unload();
+    }
+
+    // Used by: PlayScene::update, HeadlessSession::step
+    // Updates the game logic: ECS systems, camera, chunk streaming and level logic.
+    void PlayPipeline::update(float dt) {
+        // Execute the ordered update pipeline built in setup_systems.
+        run_update_systems(dt);
+
+        // Update camera systems after core simulation so camera follows the player smoothly.
+        if (auto camera_ptr = _level.camera()) {
+            const float view_w = _renderer.viewport_size().x;
+            {
+                ZIA_PROFILE_SCOPE("camera");
+                _camera_system.update(_registry, *camera_ptr, dt, view_w, view_height(), _player_id);
+            }
+
+            // Stream tile chunks (and their enemies) around the updated view.
+            ZIA_PROFILE_SCOPE("chunk_streaming");
+            ChunkStreamingSystem::update(_registry, _assets, _level, camera_ptr->x(), camera_ptr->x() + view_w, _player_id);
+        }
+
+        // Let level perform any temporal updates (animations, timers, transitions).
+        _level.update(dt);
+
+        // Pick up the next level once its background parse has finished.
+        {
+            ZIA_PROFILE_SCOPE("level_prefetch");
+            poll_prefetch();
+        }
+
+        // Handle any pending level transitions requested by systems.
+        handle_level_transitions();
+    }
+
+    // Used by: update
+    // Check and apply pending level transitions (reload/unload/load next level).
+    void PlayPipeline::handle_level_transitions() {
+        if (_level_transition_pending) {
+            _level_transition_pending = false;
+            ++_transitions;
+            // Restarting the running level: roll back to its start instead of unloading and reloading it.
+            if (_current_level_path == _level_start.level_path() && restore_snapshot(_level_start)) {
+                return;
+            }
+            // Advancing into the prefetched level is a swap; restarts reload synchronously. A parse
+            // still in flight is finished first, which is never slower than starting over.
+            if (!_prepared && _prefetch.valid() && _prefetch_path == _current_level_path) {
+                _prefetch.wait();
+                poll_prefetch();
+            }
+            if (_prepared && _prepared->path == _current_level_path) {
+                switch_to_prepared_level();
+            } else {
+                exit();
+                enter();
+            }
+        }
+    }
+
+    // Used by: start_level (level start), PlayScene (quick save)
+    void PlayPipeline::capture_snapshot(WorldSnapshot &snapshot) const {
+        ZIA_PROFILE_SCOPE("snapshot_capture");
+        snapshot.capture(_registry.underlying(), _level, _current_level_path,
+                         {_player_id, _background_slot, _level_transition_delay});
+    }
+
+    // Used by: handle_level_transitions (restart), PlayScene (quick load)
+    bool PlayPipeline::restore_snapshot(const WorldSnapshot &snapshot) {
+        ZIA_PROFILE_SCOPE("snapshot_restore");
+        const SceneSnapshotState saved = snapshot.scene_state();
+        if (snapshot.level_path() != _current_level_path || saved.background_slot != _background_slot) {
+            // The background entities in the snapshot refer to their slot's texture ids, so reload the
+            // level into that slot (enter advances to the next slot before loading).
+            exit();
+            _current_level_path = std::string(snapshot.level_path());
+            _background_slot = (saved.background_slot + zia::constants::LEVEL_BACKGROUND_SLOTS - 1) % zia::constants::LEVEL_BACKGROUND_SLOTS;
+            enter();
+        }
+
+        SceneSnapshotState scene;
+        if (!snapshot.restore(_registry.underlying(), _level, scene)) {
+            return false;
+        }
+        _player_id = scene.player_id;
+        _level_transition_delay = scene.level_transition_delay;
+        _level_transition_pending = false;
+        // Entity ids may have been reused by other backgrounds.
+        _sorted_backgrounds.clear();
+        _background_cache_dirty = true;
+        return true;
+    }
+
+    // Used by: start_level to build per-frame pipelines
+    // Build the ordered per-frame system pipelines as lambda callbacks.
+    void PlayPipeline::setup_systems() {
+        // Clear any previous pipeline entries.
+        _update_systems.clear();
+        // Player input and movement controller must run early so later systems see an updated control state.
+        _update_systems.push_back({"player_controller", [this](zia::engine::IEntityManager& registry, float dt) {
+             _player_controller.update(registry, _input, dt);
+         }});
+        // (animation update will be scheduled later so it can consume queued one-shot plays after collisions)
+        // Run enemy AI and movement which may depend on the current tilemap.
+        _update_systems.push_back({"enemies", [this](zia::engine::IEntityManager& registry, float dt) {
+             if (const auto tile_map = _level.tile_map()) {
+                 _enemy_system.update(registry, *tile_map, dt);
+             }
+         }});
+        // Physics simulation (collisions, velocity integration) runs after motion inputs.
+        _update_systems.push_back({"physics", [this](zia::engine::IEntityManager& registry, float dt) {
+             _physics.update(registry, dt);
+         }});
+        // Cloud system updates visual cloud entities (non-critical gameplay elements).
+        _update_systems.push_back({"clouds", [this](zia::engine::IEntityManager& registry, float dt) {
+             _cloud_system.update(registry, dt);
+         }});
+        // Tile/level collision detection and resolution.
+        _update_systems.push_back({"collision", [this](zia::engine::IEntityManager& registry, float dt) {
+             if (const auto tile_map = _level.tile_map()) {
+                 CollisionSystem::update(registry, *tile_map, dt);
+             }
+         }});
+        // Update animations after collisions so queued one-shot plays enqueued by collisions are consumed immediately.
+        _update_systems.push_back({"animation", [this](zia::engine::IEntityManager& registry, float dt) {
+             _animation_system.update(registry, dt);
+         }});
+        // Level transitions check should run after all simulation so it can act on final state.
+        _update_systems.push_back({"level_transitions", [this](zia::engine::IEntityManager& registry, float dt) {
+             if (LevelSystem::handle_transitions(registry, _player_id, _level, _current_level_path, _level_transition_delay, dt)) {
+                  _level_transition_pending = true;
+             }
+         }});
+
+        // Build render callbacks: these are executed each frame with the current camera context.
+        _render_systems.clear();
+        _render_systems.push_back({"backgrounds", [this](zia::engine::IEntityManager& registry, zia::engine::IRenderer& renderer, zia::engine::IAssetManager& assets, const Camera& camera){
+            // Cache and sort background layers by parallax only when needed.
+            if (_background_cache_dirty) {
+                // Rebuild the cached entity list from the registry.
+                _sorted_backgrounds.clear();
+                registry.get_entities_with<BackgroundComponent>(_sorted_backgrounds);
+                std::sort(_sorted_backgrounds.begin(), _sorted_backgrounds.end(), [&](EntityID a, EntityID b) {
+                    auto a_opt = registry.get_component<BackgroundComponent>(a);
+                    auto b_opt = registry.get_component<BackgroundComponent>(b);
+                    if (!a_opt || !b_opt) return false;
+                    return (a_opt->get().parallax < b_opt->get().parallax);
+                });
+                _background_cache_dirty = false;
+            } else {
+                // Detect changes in background entity count and refresh the cache if needed.
+                static thread_local std::vector<EntityID> bg_entities;
+                registry.get_entities_with<BackgroundComponent>(bg_entities);
+                if (bg_entities.size() != _sorted_backgrounds.size()) {
+                    _background_cache_dirty = true;
+                }
+            }
+
+            for (auto entity: _sorted_backgrounds) {
+                if (auto bg_opt = registry.get_component<BackgroundComponent>(entity)) {
+                    _background_system.render(renderer, camera, assets, bg_opt->get());
+                }
+            }
+        }});
+        // Clouds, level geometry, sprites and debug overlays are drawn on top of all background layers.
+        _render_systems.push_back({"clouds", [this](zia::engine::IEntityManager& registry, zia::engine::IRenderer& renderer, zia::engine::IAssetManager& assets, const Camera& camera){
+            _cloud_system.render(renderer, camera, assets, registry);
+        }});
+        _render_systems.push_back({"level", [this](zia::engine::IEntityManager&, zia::engine::IRenderer& renderer, zia::engine::IAssetManager& assets, const Camera& camera){
+            _level.render(renderer, assets, camera);
+        }});
+        _render_systems.push_back({"sprites", [this](zia::engine::IEntityManager& registry, zia::engine::IRenderer& renderer, zia::engine::IAssetManager& assets, const Camera& camera){
+            _sprite_render_system.render(renderer, camera, registry, assets);
+        }});
+        _render_systems.push_back({"debug_draw", [this](zia::engine::IEntityManager& registry, zia::engine::IRenderer& renderer, zia::engine::IAssetManager&, const Camera& camera){
+            _debug_draw_system.render(renderer, camera, registry);
+        }});
+        // Update and draw HUD elements (level name, score, etc.).
+        _render_systems.push_back({"hud", [this](zia::engine::IEntityManager&, zia::engine::IRenderer&, zia::engine::IAssetManager&, const Camera&){
+            std::string level_name = "Level 1";
+            if (_current_level_path == zia::constants::LEVEL2_PATH) {
+                level_name = "Level 2";
+            }
+            _hud.set_level_name(level_name);
+            // Draw the HUD below the menu bar inset.
+            _hud.render(_top_inset);
+        }});
+    }
+
+    // Used by: PlayScene::render, HeadlessSession::step
+    // Renders the game world and HUD. begin_frame()/end_frame() are left to the caller.
+    void PlayPipeline::render() {
+        // Compute a camera pointer: if the level supplies a camera, use it; otherwise use a dummy camera.
+        auto camera_ptr = _level.camera();
+        Camera dummy;
+        // Create a local camera view (copy) to pass into render systems. This avoids pointer dereferencing warnings.
+        Camera camera_view = camera_ptr ? *camera_ptr : dummy;
+        // Apply the current camera position to the renderer before rendering (dummy view is safe).
+        // Copy camera coordinates to local variables to avoid analyzer warnings on complex expressions.
+        const float cam_x = camera_view.x();
+        const float cam_y = camera_view.y();
+        _renderer.set_camera(cam_x, cam_y);
+
+        // Execute the render pipeline with camera context.
+        run_render_systems(camera_view);
+    }
+
+    // Used by: update (executes update pipeline)
+    // Execute the stored update callbacks in order.
+    void PlayPipeline::run_update_systems(float dt) {
+        for (auto &sys : _update_systems) {
+            ZIA_PROFILE_SCOPE(sys.name);
+            sys.run(_registry, dt);
+        }
+    }
+
+    // Used by: render (executes render pipeline)
+    // Execute the stored render callbacks in order. Each callback receives the renderer and assets.
+    void PlayPipeline::run_render_systems(const Camera &camera) {
+        for (auto &sys : _render_systems) {
+            ZIA_PROFILE_SCOPE(sys.name);
+            sys.run(_registry, _renderer, _assets, camera);
+        }
+    }
+} // namespace zia
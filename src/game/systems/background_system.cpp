@@ -2,7 +2,6 @@
 #include "Zia/engine/resources/AssetManager.hpp"
 #include "Zia/engine/ecs/components/BackgroundComponent.hpp"
 
-#include <SFML/Graphics/Sprite.hpp>
 #include <algorithm>
 #include <cmath>
 
@@ -61,20 +60,13 @@ namespace zia {
         const float offset_x = -cam_x * bg.parallax;
         const float offset_y = -cam_y * bg.parallax;
 
-        // Switch to the default view for viewport-relative drawing
-        sf::RenderWindow& window = renderer.window();
-        const sf::View old_view = window.getView();
-        window.setView(window.getDefaultView());
-
-        sf::Sprite sprite(*tex);
+        // Backgrounds are drawn in screen space (default view); the renderer batches the view switch.
         if (!bg.repeat) {
             // Single background image, centered with parallax
             float pos_x = (vw - dst_w) * 0.5f + bg.offset_x + offset_x;
             float pos_y = (vh - dst_h) * 0.5f + bg.offset_y + offset_y;
 
-            sprite.setScale({scaleX, scaleY});
-            sprite.setPosition({pos_x, pos_y});
-            window.draw(sprite);
+            renderer.draw_screen_sprite(*tex, pos_x, pos_y, scaleX, scaleY, sf::IntRect());
         } else if (bg.repeat_x) {
             // Repeat horizontally, fixed at bottom (no vertical parallax)
             float y = vh - dst_h + bg.offset_y;
@@ -82,12 +74,10 @@ namespace zia {
             float start_x = -std::fmod(offset_x + bg.offset_x, dst_w);
             if (start_x > 0) start_x -= dst_w;
 
-            sprite.setScale({scaleX, scaleY});
-            sprite.setTextureRect(sf::IntRect({0, 0}, {static_cast<int>(tw), static_cast<int>(th)}));
+            const sf::IntRect full_rect({0, 0}, {static_cast<int>(tw), static_cast<int>(th)});
             // Draw tiles across the viewport width, with a one-tile margin on each side to avoid gaps at edges
             for (float x = start_x - dst_w; x < vw + dst_w; x += dst_w) {
-                sprite.setPosition({x, y});
-                window.draw(sprite);
+                renderer.draw_screen_sprite(*tex, x, y, scaleX, scaleY, full_rect);
             }
         } else {
             // Tiled background in both directions with parallax
@@ -97,18 +87,13 @@ namespace zia {
             if (start_x > 0) start_x -= dst_w;
             if (start_y > 0) start_y -= dst_h;
 
-            sprite.setScale({scaleX, scaleY});
             // Draw tiles across the entire viewport plus a margin to avoid visible gaps when parallaxed
             for (float x = start_x - dst_w; x < vw + dst_w; x += dst_w) {
                 for (float y = start_y - dst_h; y < vh + dst_h; y += dst_h) {
-                    sprite.setPosition({x, y});
-                    window.draw(sprite);
+                    renderer.draw_screen_sprite(*tex, x, y, scaleX, scaleY, sf::IntRect());
                 }
             }
         }
-
-        // Restore the original view
-        window.setView(old_view);
     }
 
     // Create a background entity and attach a BackgroundComponent (moved from PlayState)
@@ -0,0 +1,125 @@
+// Implements the ChunkStreamingSystem, which streams tile map chunks in and out around the camera and
+// spawns or despawns the enemies that belong to them.
+
+#include "Zia/game/systems/ChunkStreamingSystem.hpp"
+#include "Zia/game/world/Level.hpp"
+#include "Zia/game/world/TileMap.hpp"
+#include "Zia/game/helpers/Spawner.hpp"
+#include "Zia/engine/ecs/components/PositionComponent.hpp"
+#include "Zia/engine/ecs/components/SizeComponent.hpp"
+#include "Zia/engine/ecs/components/EnemyComponent.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace zia {
+    namespace {
+        bool deterministic = false;
+
+        // Chunk holding world x 'px', clamped to the map.
+        int chunk_at(const TileMap& map, float px) {
+            const int tx = static_cast<int>(std::floor(px / static_cast<float>(map.tile_size())));
+            return std::clamp(TileMap::chunk_of_column(std::max(0, tx)), 0, map.chunk_count() - 1);
+        }
+
+        // Spawn the enemies of 'chunk' that have not been spawned yet. The player spawn is handled
+        // by PlayPipeline and is never streamed.
+        void spawn_chunk(zia::engine::IEntityManager& registry, Level& level, int chunk) {
+            const auto [first, last] = level.spawn_range(chunk);
+            const auto& spawns = level.entity_spawns();
+            for (std::size_t i = first; i < last; ++i) {
+                const auto& spawn = spawns[i];
+                if (spawn.type == "player" || spawn.type == "Player") continue;
+                if (level.consume_spawn(i)) {
+                    Spawner::spawn_enemy(registry, spawn);
+                }
+            }
+        }
+
+        // Make chunks [first, last] resident now, spawning the enemies of those that were not.
+        void load_range_now(zia::engine::IEntityManager& registry, Level& level, TileMap& map, int first, int last) {
+            for (int chunk = std::max(0, first); chunk <= std::min(last, map.chunk_count() - 1); ++chunk) {
+                if (!map.is_chunk_resident(chunk)) {
+                    map.load_chunk_now(chunk);
+                    spawn_chunk(registry, level, chunk);
+                }
+            }
+        }
+    }
+
+    // Used by: Game (input recording / replay)
+    void ChunkStreamingSystem::set_deterministic(bool enabled) {
+        deterministic = enabled;
+    }
+
+    // Used by: PlayPipeline::populate_level
+    void ChunkStreamingSystem::prime(zia::engine::IEntityManager& registry, Level& level, float view_left, float view_right) {
+        ZIA_PROFILE_SCOPE("chunk_prime");
+        const auto tile_map = level.tile_map();
+        if (!tile_map || tile_map->chunk_count() == 0 || tile_map->tile_size() <= 0) return;
+        load_range_now(registry, level, *tile_map, chunk_at(*tile_map, view_left), chunk_at(*tile_map, view_right));
+    }
+
+    // Used by: PlayPipeline::update (after the camera has followed the player)
+    void ChunkStreamingSystem::update(zia::engine::IEntityManager& registry, zia::engine::IAssetManager& assets, Level& level,
+                                      float view_left, float view_right, EntityID player) {
+        const auto tile_map = level.tile_map();
+        if (!tile_map || tile_map->chunk_count() == 0 || tile_map->tile_size() <= 0) return;
+        TileMap& map = *tile_map;
+
+        // Install chunks whose background reads have finished. In deterministic mode they wait for
+        // load_range_now below, which takes the finished (or still running) read.
+        if (!deterministic) {
+            static thread_local std::vector<int> loaded;
+            loaded.clear();
+            map.poll_chunks(loaded);
+            for (const int chunk : loaded) {
+                spawn_chunk(registry, level, chunk);
+            }
+        }
+
+        // The window that must be resident this frame: the view plus the player's own extent.
+        int first = chunk_at(map, view_left);
+        int last = chunk_at(map, view_right);
+        if (player != 0) {
+            const auto pos_opt = registry.get_component<PositionComponent>(player);
+            const auto size_opt = registry.get_component<SizeComponent>(player);
+            if (pos_opt) {
+                const float x = pos_opt->get().x;
+                const float w = size_opt ? size_opt->get().width : 0.0f;
+                first = std::min(first, chunk_at(map, x));
+                last = std::max(last, chunk_at(map, x + w));
+            }
+        }
+        load_range_now(registry, level, map, first, last);
+
+        for (int d = 1; d <= PREFETCH_CHUNKS; ++d) {
+            map.request_chunk(first - d, assets);
+            map.request_chunk(last + d, assets);
+        }
+
+        // Only resident chunks can need evicting; that list stays the size of the window.
+        static thread_local std::vector<int> evicted;
+        evicted.clear();
+        for (const int chunk : map.resident_chunks()) {
+            if (chunk < first - KEEP_CHUNKS || chunk > last + KEEP_CHUNKS) {
+                evicted.push_back(chunk);
+            }
+        }
+        for (const int chunk : evicted) {
+            map.evict_chunk(chunk);
+        }
+
+        // Enemies standing in a non-resident chunk would fall through it; remove them.
+        static thread_local std::vector<EntityID> enemies;
+        registry.get_entities_with<EnemyComponent, PositionComponent>(enemies);
+        for (const EntityID enemy : enemies) {
+            const auto& pos = registry.get_component<PositionComponent>(enemy)->get();
+            if (!map.is_chunk_resident(chunk_at(map, pos.x))) {
+                registry.destroy_entity(enemy);
+            }
+        }
+    }
+} // namespace Zia
@@ -7,7 +7,6 @@
 #include "Zia/game/helpers/Spawner.hpp"
 #include "Zia/game/helpers/Constants.hpp"
 
-#include <SFML/Graphics/Sprite.hpp>
 #include <algorithm>
 
 namespace zia {
@@ -52,10 +51,6 @@ namespace zia {
              return static_cast<int>(ca_opt->get().layer) < static_cast<int>(cb_opt->get().layer);
          });
 
-         sf::RenderWindow &window = renderer.window();
-         const sf::View old_view = window.getView();
-         window.setView(window.getDefaultView());
-
          for (auto entity: entities) {
              auto cloud_opt = registry.get_component<CloudComponent>(entity);
              if (!cloud_opt) continue;
@@ -64,17 +59,10 @@ namespace zia {
              auto tex = assets.get_mutable_texture(cloud.texture_id);
              if (!tex) continue;
 
-             // Create sprite and apply scale
-             sf::Sprite sprite(*tex);
-             sprite.setScale({cloud.scale, cloud.scale});
-
-             // Position with parallax effect: clouds move less than camera
+             // Position with parallax effect: clouds move less than camera (screen space)
              float pos_x = cloud.x - camera.x() * CLOUD_PARALLAX;
              float pos_y = cloud.y;
-             sprite.setPosition({pos_x, pos_y});
-             window.draw(sprite);
+             renderer.draw_screen_sprite(*tex, pos_x, pos_y, cloud.scale, cloud.scale, sf::IntRect());
          }
-
-         window.setView(old_view);
      }
  } // namespace Zia
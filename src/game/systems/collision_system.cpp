@@ -19,6 +19,10 @@
 #include "Zia/engine/ecs/components/EnemyComponent.hpp"
 #include "Zia/engine/ecs/components/SpriteComponent.hpp"
 #include "Zia/engine/ecs/components/AnimationComponent.hpp"
+// Optional visualisation of broadphase cells and contact normals
+#include "Zia/engine/render/DebugDraw.hpp"
+
+#include <string>
 
 // collision_system.cpp
 //
@@ -60,6 +64,26 @@ namespace zia {
             return sf::FloatRect({c.pos.get().x, c.pos.get().y}, {c.size.get().width, c.size.get().height});
         }
 
+        // Length of contact normal arrows in the debug view (world units).
+        constexpr float NORMAL_ARROW_LENGTH = static_cast<float>(constants::TILE_SIZE) * 0.75f;
+
+        // Queue the quadtree node outlines and occupied broadphase cells for the debug view.
+        void debug_draw_quadtree(const ::zia::engine::spatial::Quadtree& quadtree) {
+            namespace dd = ::zia::engine::debug_draw;
+            const bool nodes = dd::active(dd::QuadtreeNodes);
+            const bool cells = dd::active(dd::BroadphaseCells);
+            if (!nodes && !cells) return;
+            quadtree.visit([nodes, cells](const sf::FloatRect& bounds, int level, std::size_t objects) {
+                (void)level;
+                if (cells && objects > 0) {
+                    dd::box(bounds, sf::Color(255, 160, 0));
+                    dd::text(bounds.position + sf::Vector2f{2.0f, 2.0f}, std::to_string(objects), sf::Color(255, 160, 0));
+                } else if (nodes) {
+                    dd::box(bounds, sf::Color(0, 160, 255, 120));
+                }
+            });
+        }
+
         // Resolves overlap between the player and another entity, adjusting position and velocity.
         void resolve_player_collision(PositionComponent& pos_player, VelocityComponent& vel_player, const SizeComponent& size_player, const PositionComponent& pos_other, const SizeComponent& size_other) {
             // Compute the sides of both rectangles
@@ -78,6 +102,15 @@ namespace zia {
             const float minOverlapX = (overlapLeft < overlapRight) ? overlapLeft : -overlapRight;
             const float minOverlapY = (overlapTop < overlapBottom) ? overlapTop : -overlapBottom;
 
+            // Contact normal points from the other entity towards the player along the resolved axis.
+            if (::zia::engine::debug_draw::active(::zia::engine::debug_draw::ContactNormals)) {
+                const bool along_x = std::abs(minOverlapX) < std::abs(minOverlapY);
+                const sf::Vector2f normal = along_x ? sf::Vector2f{minOverlapX < 0 ? -1.0f : 1.0f, 0.0f}
+                                                    : sf::Vector2f{0.0f, minOverlapY < 0 ? -1.0f : 1.0f};
+                const sf::Vector2f center{pos_player.x + size_player.width * 0.5f, pos_player.y + size_player.height * 0.5f};
+                ::zia::engine::debug_draw::arrow(center, normal, NORMAL_ARROW_LENGTH, sf::Color::Magenta);
+            }
+
             // Move the player out of collision along the axis of least penetration
             if (std::abs(minOverlapX) < std::abs(minOverlapY)) {
                 pos_player.x += minOverlapX;
@@ -173,6 +206,16 @@ namespace zia {
                 const float next_y = old_y + vel.vy * dt;
 
                 const auto result = resolve_tile_collision(next_x, next_y, vel.vx, vel.vy, size.width, size.height, map, dt);
+                // A velocity component zeroed by the sweep means a tile contact on that axis.
+                if (::zia::engine::debug_draw::active(::zia::engine::debug_draw::ContactNormals)) {
+                    const sf::Vector2f center{result.x + size.width * 0.5f, result.y + size.height * 0.5f};
+                    if (vel.vx != 0.0f && result.vx == 0.0f) {
+                        ::zia::engine::debug_draw::arrow(center, {vel.vx > 0.0f ? -1.0f : 1.0f, 0.0f}, NORMAL_ARROW_LENGTH, sf::Color::Cyan);
+                    }
+                    if (vel.vy != 0.0f && result.vy == 0.0f) {
+                        ::zia::engine::debug_draw::arrow(center, {0.0f, vel.vy > 0.0f ? -1.0f : 1.0f}, NORMAL_ARROW_LENGTH, sf::Color::Cyan);
+                    }
+                }
                 pos.x = result.x;
                 pos.y = result.y;
                 vel.vx = result.vx;
@@ -232,13 +275,17 @@ namespace zia {
          const auto world_w = static_cast<float>(map.width() * map.tile_size());
          const auto world_h = static_cast<float>(map.height() * map.tile_size());
          // Use fully-qualified engine quadtree type to avoid relying on the deprecated wrapper alias
-         ::zia::engine::spatial::Quadtree quadtree(0, sf::FloatRect({0.0f, 0.0f}, {world_w, world_h}));
+         // The tree is kept between frames so its nodes are reused instead of reallocated.
+         static thread_local ::zia::engine::spatial::Quadtree quadtree(0, sf::FloatRect());
+         quadtree.reset(sf::FloatRect({0.0f, 0.0f}, {world_w, world_h}));
 
          // Insert AABBs with their collidable index as payload.
          for (std::size_t i = 0; i < collidables.size(); ++i) {
              quadtree.insert(QuadTile(to_rect(collidables[i]), static_cast<std::uint32_t>(i)));
          }
 
+         debug_draw_quadtree(quadtree);
+
          // Collect stomps (player, enemy) to process after the collision pass
          static thread_local std::vector<std::pair<EntityID, EntityID>> stomped;
          stomped.clear();
@@ -3,18 +3,27 @@
 #include "Zia/engine/ecs/components/SizeComponent.hpp"
 #include "Zia/engine/ecs/components/TypeComponent.hpp"
 #include "Zia/game/world/Camera.hpp"
+#include "Zia/engine/render/DebugDraw.hpp"
 
 #include <SFML/Graphics.hpp>
 #include <vector>
 
 namespace zia {
     void DebugDrawSystem::render(zia::engine::IRenderer& renderer, const Camera& camera, zia::engine::IEntityManager& registry) {
-        // Only draw if debug bboxes enabled
-        if (!renderer.is_debug_bboxes_enabled()) return;
+        namespace dd = zia::engine::debug_draw;
+        // The renderer's debug flag drives the shared debug draw queue; other systems (collision)
+        // queue their geometry while it is enabled and everything is flushed here in one batch.
+        dd::set_enabled(renderer.is_debug_bboxes_enabled());
+        if (!dd::enabled()) return;
 
-        // Ensure the renderer uses the camera view
-        renderer.set_camera(camera.x(), camera.y());
+        if (dd::active(dd::Bounds)) {
+            queue_bounds(registry);
+        }
+
+        dd::flush(renderer, camera.x(), camera.y());
+    }
 
+    void DebugDrawSystem::queue_bounds(zia::engine::IEntityManager& registry) {
         static thread_local std::vector<EntityID> entities;
         entities.clear();
         registry.get_entities_with<PositionComponent, SizeComponent>(entities);
@@ -37,8 +46,8 @@ namespace zia {
                 }
             }
 
-            // Draw world-space bounding box; renderer translates with camera.
-            renderer.draw_bbox(pos.x, pos.y, size.width, size.height, color, 1.0f);
+            // Queue the world-space bounding box; it is drawn with the rest of the debug batch.
+            zia::engine::debug_draw::box(sf::FloatRect({pos.x, pos.y}, {size.width, size.height}), color);
         }
     }
 }
@@ -11,9 +11,8 @@
 
 #include "Zia/engine/ecs/components/NameComponent.hpp"
 
-#include <sstream>
-#include <iomanip>
 #include <algorithm>
+#include <cstdio>
 #include <filesystem>
 
 namespace zia {
@@ -33,75 +32,92 @@ void InspectorSystem::update(zia::engine::IEntityManager& /*registry*/, float /*
     // No internal state for now.
 }
 
+namespace {
+    // Append printf-style text to 'line' without a temporary stream; lines are short.
+    template <typename... Args>
+    void append(std::string& line, const char* format, Args... args) {
+        char buffer[128];
+        const int written = std::snprintf(buffer, sizeof(buffer), format, args...);
+        if (written > 0) line.append(buffer, std::min(static_cast<size_t>(written), sizeof(buffer) - 1));
+    }
+
+    // Next line slot: reuses an existing string (and its capacity) when there is one.
+    std::string& next_line(std::vector<std::string>& lines, size_t& count) {
+        if (count == lines.size()) lines.emplace_back();
+        std::string& line = lines[count++];
+        line.clear();
+        return line;
+    }
+}
+
 // Helper: build a list of human-readable lines for the provided entities
-void InspectorSystem::build_lines(const std::vector<EntityID>& entities, zia::engine::IEntityManager& registry, std::vector<std::string>& out_lines, zia::engine::IAssetManager& /*assets*/) const {
+size_t InspectorSystem::build_lines(const std::vector<EntityID>& entities, zia::engine::IEntityManager& registry, std::vector<std::string>& out_lines, zia::engine::IAssetManager& /*assets*/) const {
     // registry, entities and out_lines are used below
 
-    out_lines.clear();
-    std::ostringstream header;
-    header << "Inspector - entities: " << entities.size();
-    out_lines.push_back(header.str());
+    size_t line_count = 0;
+    append(next_line(out_lines, line_count), "Inspector - entities: %zu", entities.size());
+    append(next_line(out_lines, line_count), "Sprites - visible: %zu, culled: %zu", _visible_sprites, _culled_sprites);
 
     size_t count = 0;
     for (auto entity : entities) {
         if (count++ >= _max_entries) break;
-        std::ostringstream oss;
+        std::string& line = next_line(out_lines, line_count);
         // Prefer entity name when available
         if (auto name_opt = registry.get_component<NameComponent>(entity)) {
-            oss << name_opt->get().value << " (" << entity << "): ";
+            line += name_opt->get().value;
+            append(line, " (%llu): ", static_cast<unsigned long long>(entity));
         } else {
-            oss << "Entity " << entity << "): ";
+            append(line, "Entity %llu): ", static_cast<unsigned long long>(entity));
         }
         // Type
         if (auto type_opt = registry.get_component<TypeComponent>(entity)) {
             auto& t = type_opt->get();
             switch (t.type) {
-                case EntityTypeComponent::Player: oss << "Player"; break;
-                case EntityTypeComponent::Goomba: oss << "Goomba"; break;
-                case EntityTypeComponent::Koopa: oss << "Koopa"; break;
-                default: oss << "TypeUnknown"; break;
+                case EntityTypeComponent::Player: line += "Player"; break;
+                case EntityTypeComponent::Goomba: line += "Goomba"; break;
+                case EntityTypeComponent::Koopa: line += "Koopa"; break;
+                default: line += "TypeUnknown"; break;
             }
         } else if (registry.get_component<EnemyComponent>(entity)) {
-            oss << "Enemy";
+            line += "Enemy";
         } else {
-            oss << "Entity";
+            line += "Entity";
         }
 
         // Position
         if (auto pos_opt = registry.get_component<PositionComponent>(entity)) {
             auto& p = pos_opt->get();
-            oss << " pos=(" << std::fixed << std::setprecision(1) << p.x << "," << p.y << ")";
+            append(line, " pos=(%.1f,%.1f)", p.x, p.y);
         }
         // Velocity
         if (auto v_opt = registry.get_component<VelocityComponent>(entity)) {
             auto& v = v_opt->get();
-            oss << " vel=(" << std::fixed << std::setprecision(1) << v.vx << "," << v.vy << ")";
+            append(line, " vel=(%.1f,%.1f)", v.vx, v.vy);
         }
         // Size
         if (auto s_opt = registry.get_component<SizeComponent>(entity)) {
-            auto& s = s_opt->get();
-            oss << " size=(" << std::fixed << std::setprecision(1) << s.width << "," << s.height << ")";
+            auto& sz = s_opt->get();
+            append(line, " size=(%.1f,%.1f)", sz.width, sz.height);
         }
         // Sprite
         if (auto sp_opt = registry.get_component<SpriteComponent>(entity)) {
             auto& sp = sp_opt->get();
             if (sp.texture_id >= 0) {
-                oss << " sprite_id=" << sp.texture_id;
+                append(line, " sprite_id=%d", sp.texture_id);
             }
         }
         // Animation state
         if (auto a_opt = registry.get_component<AnimationComponent>(entity)) {
             auto& a = a_opt->get();
             switch (a.current_state) {
-                case AnimationComponent::State::Idle: oss << " anim=Idle"; break;
-                case AnimationComponent::State::Run: oss << " anim=Run"; break;
-                case AnimationComponent::State::Jump: oss << " anim=Jump"; break;
+                case AnimationComponent::State::Idle: line += " anim=Idle"; break;
+                case AnimationComponent::State::Run: line += " anim=Run"; break;
+                case AnimationComponent::State::Jump: line += " anim=Jump"; break;
                 default: break;
             }
         }
-
-        out_lines.push_back(oss.str());
     }
+    return line_count;
 }
 
 void InspectorSystem::render_ui(zia::engine::IEntityManager& registry, zia::engine::IAssetManager& assets) {
@@ -109,34 +125,30 @@ void InspectorSystem::render_ui(zia::engine::IEntityManager& registry, zia::engi
     if (!s_inspector_visible) return;
 
     // Collect candidate entities: entities with TypeComponent and EnemyComponent.
-    static thread_local std::vector<EntityID> type_entities;
-    static thread_local std::vector<EntityID> enemy_entities;
-    type_entities.clear();
-    enemy_entities.clear();
+    _type_entities.clear();
+    _enemy_entities.clear();
 
-    registry.get_entities_with<TypeComponent>(type_entities);
-    registry.get_entities_with<EnemyComponent>(enemy_entities);
+    registry.get_entities_with<TypeComponent>(_type_entities);
+    registry.get_entities_with<EnemyComponent>(_enemy_entities);
 
     // Merge lists, keeping order and uniqueness.
-    std::vector<EntityID> entities;
-    entities.reserve(type_entities.size() + enemy_entities.size());
-    for (auto e: type_entities) entities.push_back(e);
-    for (auto e: enemy_entities) {
-        if (std::find(entities.begin(), entities.end(), e) == entities.end()) entities.push_back(e);
+    _entities.clear();
+    _entities.insert(_entities.end(), _type_entities.begin(), _type_entities.end());
+    for (auto e: _enemy_entities) {
+        if (std::find(_entities.begin(), _entities.end(), e) == _entities.end()) _entities.push_back(e);
     }
 
     // If no candidate entities found, early out.
-    if (entities.empty()) return;
+    if (_entities.empty()) return;
 
     // Build display lines
-    std::vector<std::string> lines;
-    build_lines(entities, registry, lines, assets);
+    const size_t line_count = build_lines(_entities, registry, _lines, assets);
 
     ImGui::SetNextWindowPos(ImVec2(8.0f, 8.0f), ImGuiCond_FirstUseEver);
     ImGui::SetNextWindowSize(ImVec2(300.0f, 200.0f), ImGuiCond_FirstUseEver);
     if (ImGui::Begin("Inspector", &_enabled)) {
-        for (const auto &line : lines) {
-            ImGui::TextUnformatted(line.c_str());
+        for (size_t i = 0; i < line_count; ++i) {
+            ImGui::TextUnformatted(_lines[i].c_str());
         }
     }
     ImGui::End();
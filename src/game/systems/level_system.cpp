@@ -38,11 +38,7 @@ namespace zia {
         if (transition_delay <= 0.0f) {
             const int map_right_px = tile_map->width() * tile_map->tile_size();
             if (pos.x + size.width > static_cast<float>(map_right_px)) {
-                if (current_level_path == zia::constants::LEVEL1_PATH) {
-                    current_level_path = zia::constants::LEVEL2_PATH;
-                } else {
-                    current_level_path = zia::constants::LEVEL1_PATH;
-                }
+                current_level_path = std::string(zia::constants::next_level_path(current_level_path));
                 return true;
             }
         }
@@ -0,0 +1,269 @@
+#include "Zia/game/systems/ProfilerSystem.hpp"
+#include "Zia/engine/profiling/AllocationTracker.hpp"
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+
+namespace zia {
+    namespace {
+        constexpr float LANE_ROW_HEIGHT = 18.0f;
+        constexpr float LANE_LABEL_WIDTH = 70.0f;
+        // Frame budget drawn as a reference line in the graph and timeline (60 fps).
+        constexpr double FRAME_BUDGET_MS = 1000.0 / 60.0;
+
+        // Stable colour per scope name so a system keeps its colour between frames.
+        ImU32 scope_color(const char* name) {
+            unsigned hash = 2166136261u;
+            for (const char* c = name; *c; ++c) {
+                hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+            }
+            return IM_COL32(80 + (hash & 0x7F), 80 + ((hash >> 8) & 0x7F), 80 + ((hash >> 16) & 0x7F), 255);
+        }
+    }
+
+    // Used by: PlayScene::render (after the inspector)
+    void ProfilerSystem::render_ui(zia::engine::FramePacer* pacer) {
+        if (!_enabled) return;
+        auto& profiler = zia::engine::Profiler::instance();
+
+        if (!_paused) {
+            _frame_times.clear();
+            _frame_allocations.clear();
+            for (std::size_t age = 0; age < profiler.frame_count(); ++age) {
+                _frame_times.push_back(static_cast<float>(profiler.frame(age).duration_ms()));
+                _frame_allocations.push_back(static_cast<float>(profiler.frame(age).allocations));
+            }
+            profiler.compute_stats(_stats);
+            _thread_names = profiler.thread_names();
+            if (const auto* last = profiler.last_frame()) {
+                _shown_frame = *last;
+            }
+        }
+
+        ImGui::SetNextWindowPos(ImVec2(316.0f, 8.0f), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowSize(ImVec2(520.0f, 420.0f), ImGuiCond_FirstUseEver);
+        if (ImGui::Begin("Profiler", &_enabled)) {
+            bool recording = profiler.enabled();
+            if (ImGui::Checkbox("Record", &recording)) {
+                profiler.set_enabled(recording);
+            }
+            ImGui::SameLine();
+            ImGui::Checkbox("Pause view", &_paused);
+            ImGui::SameLine();
+            ImGui::Text("dropped samples: %llu", static_cast<unsigned long long>(profiler.dropped_samples()));
+
+            if (!_frame_times.empty()) {
+                float sum = 0.0f;
+                float worst = 0.0f;
+                for (const float ms : _frame_times) {
+                    sum += ms;
+                    worst = std::max(worst, ms);
+                }
+                char overlay[64];
+                std::snprintf(overlay, sizeof(overlay), "last %.2f ms  avg %.2f ms  max %.2f ms",
+                              _frame_times.back(), sum / static_cast<float>(_frame_times.size()), worst);
+                ImGui::PlotLines("##frame_times", _frame_times.data(), static_cast<int>(_frame_times.size()), 0, overlay,
+                                 0.0f, std::max(worst, static_cast<float>(FRAME_BUDGET_MS) * 2.0f), ImVec2(-1.0f, 60.0f));
+            }
+
+            if (pacer) {
+                draw_pacing(*pacer);
+            }
+
+            if constexpr (zia::engine::allocation_tracker::compiled_in()) {
+                if (!_frame_allocations.empty()) {
+                    float sum = 0.0f;
+                    for (const float count : _frame_allocations) sum += count;
+                    char overlay[64];
+                    std::snprintf(overlay, sizeof(overlay), "allocations/frame: last %.0f  avg %.1f",
+                                  _frame_allocations.back(), sum / static_cast<float>(_frame_allocations.size()));
+                    ImGui::PlotHistogram("##frame_allocations", _frame_allocations.data(), static_cast<int>(_frame_allocations.size()),
+                                         0, overlay, 0.0f, FLT_MAX, ImVec2(-1.0f, 40.0f));
+                }
+            } else {
+                ImGui::TextDisabled("Allocation tracking: build with ZIA_TRACK_ALLOCATIONS=ON");
+            }
+
+            if (ImGui::CollapsingHeader("Scopes", ImGuiTreeNodeFlags_DefaultOpen)) {
+                draw_stats_table();
+            }
+            if (ImGui::CollapsingHeader("Timeline (last frame)", ImGuiTreeNodeFlags_DefaultOpen)) {
+                draw_timeline(_shown_frame);
+            }
+            if (ImGui::CollapsingHeader("Chrome trace")) {
+                draw_trace_controls();
+            }
+        }
+        ImGui::End();
+    }
+
+    void ProfilerSystem::draw_pacing(zia::engine::FramePacer& pacer) {
+        const auto& stats = pacer.stats();
+        if (pacer.target_fps() > 0) {
+            ImGui::Text("pacing: %d fps  missed %llu/%llu (%.1f%%)  worst wake %.0f us", pacer.target_fps(),
+                        static_cast<unsigned long long>(stats.missed), static_cast<unsigned long long>(stats.frames),
+                        stats.missed_ratio() * 100.0, stats.max_wake_error_us);
+        } else {
+            ImGui::Text("pacing: uncapped  %llu frames", static_cast<unsigned long long>(stats.frames));
+        }
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Reset##pacing")) {
+            pacer.reset_stats();
+        }
+    }
+
+    void ProfilerSystem::draw_stats_table() {
+        constexpr int flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp;
+        constexpr bool allocations = zia::engine::allocation_tracker::compiled_in();
+        if (!ImGui::BeginTable("profiler_scopes", allocations ? 10 : 7, flags)) return;
+        ImGui::TableSetupColumn("Scope");
+        ImGui::TableSetupColumn("Thread");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("Last ms");
+        ImGui::TableSetupColumn("Min ms");
+        ImGui::TableSetupColumn("Avg ms");
+        ImGui::TableSetupColumn("p99 ms");
+        if constexpr (allocations) {
+            ImGui::TableSetupColumn("Allocs");
+            ImGui::TableSetupColumn("Avg allocs");
+            ImGui::TableSetupColumn("KB");
+        }
+        ImGui::TableHeadersRow();
+
+        for (const auto& stats : _stats) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            // Indent nested scopes under their parent system.
+            ImGui::Text("%*s%s", static_cast<int>(stats.depth) * 2, "", stats.name);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(stats.thread < _thread_names.size() ? _thread_names[stats.thread].c_str() : "?");
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", stats.last_calls);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.last_ms);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.min_ms);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.avg_ms);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.p99_ms);
+            if constexpr (allocations) {
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(stats.last_allocations));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", stats.avg_allocations);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<double>(stats.last_alloc_bytes) / 1024.0);
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    void ProfilerSystem::draw_trace_controls() {
+        auto& profiler = zia::engine::Profiler::instance();
+        // File names carry the first frame index so repeated exports do not overwrite each other.
+        char path[64];
+
+        ImGui::SliderInt("Frames", &_capture_frames, 10, 3600);
+        if (profiler.capture_active()) {
+            ImGui::TextUnformatted("Capturing...");
+        } else if (ImGui::Button("Capture next frames")) {
+            const auto first = profiler.next_frame_index();
+            std::snprintf(path, sizeof(path), "zia_trace_frames_%llu.json", static_cast<unsigned long long>(first));
+            profiler.capture_frames(first, static_cast<std::size_t>(_capture_frames), path);
+        }
+
+        bool retaining = profiler.trace_retention() > 0.0;
+        if (ImGui::Checkbox("Keep last seconds", &retaining)) {
+            profiler.set_trace_retention(retaining ? static_cast<double>(_retention_seconds) : 0.0);
+        }
+        ImGui::SameLine();
+        if (ImGui::SliderInt("##retention_seconds", &_retention_seconds, 1, 60) && retaining) {
+            profiler.set_trace_retention(static_cast<double>(_retention_seconds));
+        }
+        if (retaining && ImGui::Button("Save retained trace")) {
+            std::snprintf(path, sizeof(path), "zia_trace_last_%llu.json", static_cast<unsigned long long>(profiler.next_frame_index()));
+            profiler.save_retained_trace(path);
+        }
+    }
+
+    void ProfilerSystem::draw_timeline(const zia::engine::ProfileFrame& frame) {
+        if (frame.end_ns <= frame.begin_ns) {
+            ImGui::TextUnformatted("No frame recorded yet.");
+            return;
+        }
+
+        // Lanes: one per thread that recorded something, each as tall as its deepest scope.
+        std::vector<int> lane_rows(_thread_names.size(), 0);
+        for (const auto& sample : frame.samples) {
+            if (sample.thread < lane_rows.size()) {
+                lane_rows[sample.thread] = std::max(lane_rows[sample.thread], sample.depth + 1);
+            }
+        }
+        int total_rows = 0;
+        for (const int rows : lane_rows) total_rows += rows;
+        if (total_rows == 0) {
+            ImGui::TextUnformatted("No scopes recorded in this frame.");
+            return;
+        }
+
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const float width = std::max(100.0f, ImGui::GetContentRegionAvail().x);
+        const float height = static_cast<float>(total_rows) * LANE_ROW_HEIGHT;
+        const float track_x = origin.x + LANE_LABEL_WIDTH;
+        const float track_w = width - LANE_LABEL_WIDTH;
+        // The axis spans at least one frame budget so short frames do not look stretched.
+        const double span_ns = std::max(static_cast<double>(frame.end_ns - frame.begin_ns), FRAME_BUDGET_MS * 1.0e6);
+        const auto to_x = [&](std::int64_t ns) {
+            return track_x + static_cast<float>(static_cast<double>(ns - frame.begin_ns) / span_ns) * track_w;
+        };
+
+        ImDrawList* draw = ImGui::GetWindowDrawList();
+        draw->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height), IM_COL32(30, 30, 30, 255));
+        const float budget_x = to_x(frame.begin_ns + static_cast<std::int64_t>(FRAME_BUDGET_MS * 1.0e6));
+        draw->AddLine(ImVec2(budget_x, origin.y), ImVec2(budget_x, origin.y + height), IM_COL32(200, 60, 60, 255));
+
+        // First row of each lane.
+        std::vector<int> lane_first_row(lane_rows.size(), 0);
+        int row = 0;
+        for (std::size_t lane = 0; lane < lane_rows.size(); ++lane) {
+            lane_first_row[lane] = row;
+            if (lane_rows[lane] == 0) continue;
+            const float y = origin.y + static_cast<float>(row) * LANE_ROW_HEIGHT;
+            draw->AddText(ImVec2(origin.x + 4.0f, y + 2.0f), IM_COL32(220, 220, 220, 255), _thread_names[lane].c_str());
+            draw->AddLine(ImVec2(origin.x, y), ImVec2(origin.x + width, y), IM_COL32(70, 70, 70, 255));
+            row += lane_rows[lane];
+        }
+
+        const zia::engine::ProfileSample* hovered = nullptr;
+        for (const auto& sample : frame.samples) {
+            if (sample.thread >= lane_rows.size()) continue;
+            const float y0 = origin.y + static_cast<float>(lane_first_row[sample.thread] + sample.depth) * LANE_ROW_HEIGHT + 1.0f;
+            const float y1 = y0 + LANE_ROW_HEIGHT - 2.0f;
+            const float x0 = std::max(track_x, to_x(sample.start_ns));
+            const float x1 = std::max(x0 + 1.0f, std::min(track_x + track_w, to_x(sample.end_ns)));
+            draw->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), scope_color(sample.name));
+            if (x1 - x0 > ImGui::CalcTextSize(sample.name).x + 6.0f) {
+                draw->AddText(ImVec2(x0 + 3.0f, y0 + 1.0f), IM_COL32(0, 0, 0, 255), sample.name);
+            }
+            if (ImGui::IsMouseHoveringRect(ImVec2(x0, y0), ImVec2(x1, y1))) {
+                hovered = &sample;
+            }
+        }
+
+        // Reserve the drawn area in the layout.
+        ImGui::Dummy(ImVec2(width, height));
+        if (hovered) {
+            const double ms = static_cast<double>(hovered->end_ns - hovered->start_ns) / 1.0e6;
+            if constexpr (zia::engine::allocation_tracker::compiled_in()) {
+                ImGui::SetTooltip("%s: %.3f ms, %u allocations", hovered->name, ms, hovered->allocations);
+            } else {
+                ImGui::SetTooltip("%s: %.3f ms", hovered->name, ms);
+            }
+        }
+        ImGui::Text("frame %llu: %.2f ms, %zu scopes", static_cast<unsigned long long>(frame.index), frame.duration_ms(), frame.samples.size());
+    }
+} // namespace zia
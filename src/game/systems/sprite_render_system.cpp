@@ -1,55 +1,86 @@
 // Implements the SpriteRenderSystem, which renders all sprite entities based on their Position, Size, and Sprite components.
-// Iterates over entities with sprite data and draws shapes (rectangles or ellipses) at world positions within the camera view.
+// Each sprite's draw rectangle is tested against the camera view and off-screen sprites are skipped before any draw work.
 
 #include "Zia/game/systems/SpriteRenderSystem.hpp"
-#include "Zia/engine/ecs/components/SpriteComponent.hpp"
-#include "Zia/engine/ecs/components/PositionComponent.hpp"
-#include "Zia/engine/ecs/components/SizeComponent.hpp"
+#include "Zia/game/helpers/Constants.hpp"
+
+#include <algorithm>
 
 namespace zia {
-    // Renders all sprites by querying entities with all sprite-related components (SpriteComponent, PositionComponent, SizeComponent).
+    namespace {
+        // Smallest rectangle containing both a and b.
+        sf::FloatRect merge_rects(const sf::FloatRect& a, const sf::FloatRect& b) {
+            const float left = std::min(a.position.x, b.position.x);
+            const float top = std::min(a.position.y, b.position.y);
+            const float right = std::max(a.position.x + a.size.x, b.position.x + b.size.x);
+            const float bottom = std::max(a.position.y + a.size.y, b.position.y + b.size.y);
+            return sf::FloatRect({left, top}, {right - left, bottom - top});
+        }
+
+        bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b) {
+            return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+                   a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+        }
+    }
+
+    // Renders visible sprites by querying entities with all sprite-related components (SpriteComponent, PositionComponent, SizeComponent).
     // This follows the ECS pattern: systems operate on entities with required component combinations.
     void SpriteRenderSystem::render(zia::engine::IRenderer& renderer, const Camera& camera, zia::engine::IEntityManager& registry, zia::engine::IAssetManager& assets) {
         // Set camera for world-space rendering
         renderer.set_camera(camera.x(), camera.y());
 
+        _visible_count = 0;
+        _culled_count = 0;
+
+        // The renderer view can be taller than the camera viewport (menu inset), so cover the larger of both.
+        const sf::Vector2f view_size = renderer.viewport_size();
+        const float view_w = std::max(camera.viewport_width(), view_size.x);
+        const float view_h = std::max(camera.viewport_height(), view_size.y);
+        constexpr float margin = zia::constants::SPRITE_CULL_MARGIN;
+        const sf::FloatRect camera_rect({camera.x() - margin, camera.y() - margin}, {view_w + 2.0f * margin, view_h + 2.0f * margin});
+
         // Query all entities that have sprite components: position, size, and appearance
-        static thread_local std::vector<EntityID> renderables;
-        renderables.clear();
-        registry.get_entities_with<SpriteComponent, PositionComponent, SizeComponent>(renderables);
+        _renderables.clear();
+        registry.get_entities_with<SpriteComponent, PositionComponent, SizeComponent>(_renderables);
 
-        // Render each sprite entity
-        for (auto entity : renderables) {
+        // One pass in registry order, so overlapping sprites keep a stable draw order.
+        for (auto entity : _renderables) {
             auto sprite_opt = registry.get_component<SpriteComponent>(entity);
             auto pos_opt = registry.get_component<PositionComponent>(entity);
             auto size_opt = registry.get_component<SizeComponent>(entity);
+            if (!sprite_opt || !pos_opt || !size_opt) {
+                continue;
+            }
 
-            // All components are guaranteed to exist from the multi-component query, but keep defensive checks
-            if (sprite_opt && pos_opt && size_opt) {
-                auto& sprite = sprite_opt->get();
-                auto& pos = pos_opt->get();
-                auto& size = size_opt->get();
-
-                // Priority 1: Texture rendering
-                if (sprite.texture_id != -1) {
-                    auto tex = assets.get_texture(sprite.texture_id);
-                    if (tex) {
-                        // Decide draw size: prefer explicit render_size from SpriteComponent when > 0
-                        const float draw_w = (sprite.render_size.x > 0.0f) ? sprite.render_size.x : size.width;
-                        const float draw_h = (sprite.render_size.y > 0.0f) ? sprite.render_size.y : size.height;
-                        renderer.draw_sprite(*tex, pos.x + sprite.render_offset.x, pos.y + sprite.render_offset.y,
-                                             draw_w, draw_h, sprite.texture_rect);
-                        continue;
-                    }
-                }
+            const auto& sprite = sprite_opt->get();
+            const auto& pos = pos_opt->get();
+            const auto& size = size_opt->get();
+            // Shapes draw at the entity box; textures use render_offset/render_size. Cover both.
+            const float draw_w = (sprite.render_size.x > 0.0f) ? sprite.render_size.x : size.width;
+            const float draw_h = (sprite.render_size.y > 0.0f) ? sprite.render_size.y : size.height;
+            const sf::FloatRect body({pos.x, pos.y}, {size.width, size.height});
+            const sf::FloatRect drawn({pos.x + sprite.render_offset.x, pos.y + sprite.render_offset.y}, {draw_w, draw_h});
+            if (!overlaps(merge_rects(body, drawn), camera_rect)) {
+                ++_culled_count;
+                continue;
+            }
+            ++_visible_count;
 
-                // Priority 2: Shape rendering (fallback or if explicitly requested via texture_id == -1)
-                if (sprite.shape == SpriteComponent::Shape::Rectangle) {
-                    renderer.draw_rect(pos.x, pos.y, size.width, size.height, sprite.color);
-                } else if (sprite.shape == SpriteComponent::Shape::Ellipse) {
-                    renderer.draw_ellipse(pos.x, pos.y, size.width, size.height, sprite.color);
+            // Priority 1: Texture rendering
+            if (sprite.texture_id != -1) {
+                auto tex = assets.get_texture(sprite.texture_id);
+                if (tex) {
+                    renderer.draw_sprite(*tex, drawn.position.x, drawn.position.y, draw_w, draw_h, sprite.texture_rect);
+                    continue;
                 }
-             }
-         }
-     }
- }
+            }
+
+            // Priority 2: Shape rendering (fallback or if explicitly requested via texture_id == -1)
+            if (sprite.shape == SpriteComponent::Shape::Rectangle) {
+                renderer.draw_rect(pos.x, pos.y, size.width, size.height, sprite.color);
+            } else if (sprite.shape == SpriteComponent::Shape::Ellipse) {
+                renderer.draw_ellipse(pos.x, pos.y, size.width, size.height, sprite.color);
+            }
+        }
+    }
+} // namespace Zia
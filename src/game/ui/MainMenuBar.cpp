@@ -4,6 +4,7 @@
 #include "Zia/editor/EditorUI.hpp"
 #include "Zia/game/systems/InspectorSystem.hpp"
 #include "Zia/engine/EngineConfig.hpp"
+#include "Zia/engine/render/DebugDraw.hpp"
 #include <imgui.h>
 
 namespace zia {
@@ -31,6 +32,21 @@ namespace zia {
                     if (ImGui::MenuItem("Inspector", nullptr, vis)) {
                         zia::InspectorSystem::set_inspector_visible(!vis);
                     }
+                    // Debug draw channels (visible while debug drawing is toggled on in game).
+                    if (ImGui::BeginMenu("Debug Draw")) {
+                        namespace dd = zia::engine::debug_draw;
+                        auto channel_item = [](const char* label, dd::Channel channel) {
+                            const bool on = (dd::channels() & channel) != 0;
+                            if (ImGui::MenuItem(label, nullptr, on)) {
+                                dd::set_channels(on ? (dd::channels() & ~channel) : (dd::channels() | channel));
+                            }
+                        };
+                        channel_item("Bounding Boxes", dd::Bounds);
+                        channel_item("Quadtree Nodes", dd::QuadtreeNodes);
+                        channel_item("Broadphase Cells", dd::BroadphaseCells);
+                        channel_item("Contact Normals", dd::ContactNormals);
+                        ImGui::EndMenu();
+                    }
                     ImGui::EndMenu();
                 }
                 if (ImGui::BeginMenu("Editor")) {
@@ -56,6 +72,19 @@ namespace zia {
                 ImGui::Checkbox("Fullscreen (override)", &ui_fullscreen);
                 static float ui_master_volume = 1.0f;
                 ImGui::SliderFloat("Master Volume", &ui_master_volume, 0.0f, 1.0f);
+                // Frame pacing starts from the current settings, which may come from the environment.
+                static bool ui_vsync = game.settings() && game.settings()->vsync();
+                ImGui::Checkbox("VSync", &ui_vsync);
+                const char* frame_rates[] = { "30", "60", "120", "144", "Uncapped" };
+                static constexpr int frame_rate_values[] = { 30, 60, 120, 144, 0 };
+                static int ui_frame_rate_index = [&game]() {
+                    const int fps = game.settings() ? game.settings()->target_fps() : 60;
+                    for (int i = 0; i < IM_ARRAYSIZE(frame_rate_values); ++i) {
+                        if (frame_rate_values[i] == fps) return i;
+                    }
+                    return 1;
+                }();
+                ImGui::Combo("Frame rate", &ui_frame_rate_index, frame_rates, IM_ARRAYSIZE(frame_rates));
 
                 if (ImGui::Button("Apply")) {
                     if (auto s = game.settings()) {
@@ -72,6 +101,8 @@ namespace zia {
                             s->set_fullscreen(true);
                         }
                         s->set_master_volume(ui_master_volume);
+                        s->set_vsync(ui_vsync);
+                        s->set_target_fps(frame_rate_values[ui_frame_rate_index]);
                     }
                 }
                 ImGui::SameLine();
@@ -3,9 +3,13 @@
 
 #include "Zia/game/ui/HUD.hpp"
 
+#include <utility>
+
 namespace zia {
-    // HUD constructor initializes with a reference to the renderer.
-    HUD::HUD(zia::engine::IRenderer& renderer) : _renderer(renderer) {}
+    // HUD constructor initializes with a reference to the renderer and allocates its retained texts.
+    HUD::HUD(zia::engine::IRenderer& renderer) : _renderer(renderer), _level_text(renderer.create_text()) {}
+
+    HUD::~HUD() { _renderer.destroy_text(_level_text); }
 
     // Setters for HUD information.
     void HUD::set_lives(int lives) { _lives = lives; }
@@ -19,13 +23,24 @@ namespace zia {
         if (!_level_name.empty()) {
             // Offset HUD Y position by top_inset so HUD elements are drawn below the menu bar.
             const float y = 10.0f + static_cast<float>(top_inset);
-            _renderer.draw_text(_level_name, 10, y, 24, sf::Color::White);
+            // update_text is a no-op for the glyph geometry while the name stays the same.
+            _renderer.update_text(_level_text, _level_name, 10, y, 24, sf::Color::White);
+            _renderer.submit_text(_level_text);
         }
         // Future: render lives, coins, etc., applying the same top_inset offset.
     }
 
-    // Text class constructor initializes with a reference to the renderer.
-    Text::Text(zia::engine::IRenderer& renderer) : _renderer(renderer) {}
+    // Text class constructor initializes with a reference to the renderer and allocates a retained text.
+    Text::Text(zia::engine::IRenderer& renderer) : _renderer(renderer), _handle(renderer.create_text()) {}
+
+    Text::Text(Text&& other) noexcept
+        : _renderer(other._renderer), _handle(other._handle), _text(std::move(other._text)),
+          _x(other._x), _y(other._y), _size(other._size), _color(other._color) {
+        // The moved-from object no longer owns the handle.
+        other._handle = zia::engine::INVALID_TEXT_HANDLE;
+    }
+
+    Text::~Text() { _renderer.destroy_text(_handle); }
 
     // Setters for text properties.
     void Text::set_string(std::string_view text) { _text = text; }
@@ -33,8 +48,9 @@ namespace zia {
     void Text::set_size(unsigned int size) { _size = size; }
     void Text::set_color(sf::Color color) { _color = color; }
 
-    // Renders the text using the renderer.
+    // Renders the text using the renderer: refresh the retained object, then queue it for the UI batch.
     void Text::render() {
-        _renderer.draw_text(_text, _x, _y, _size, _color);
+        _renderer.update_text(_handle, _text, _x, _y, _size, _color);
+        _renderer.submit_text(_handle);
     }
 } // namespace Zia
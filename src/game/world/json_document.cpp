@@ -0,0 +1,344 @@
+// Implements JsonDocument, the single-pass JSON parser shared by Level, TileMap and the editor,
+// and the JsonValue accessors over its flat node array.
+
+#include "Zia/game/world/JsonDocument.hpp"
+#include "Zia/game/world/JsonHelper.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+namespace zia {
+    // Recursive-descent parser over the document buffer. Each byte is visited once; strings are
+    // unescaped in place and recorded as views, every value appends exactly one node.
+    class JsonParser {
+    public:
+        explicit JsonParser(JsonDocument& doc) : _doc(doc), _data(doc._buffer.data()), _size(doc._buffer.size()) {}
+
+        bool run() {
+            skip_whitespace();
+            if (!parse_value(0)) return false;
+            skip_whitespace();
+            if (_pos != _size) return fail("unexpected trailing characters");
+            return true;
+        }
+
+    private:
+        // Deeper nesting than any level file needs; guards the recursion against hostile input.
+        static constexpr int MAX_DEPTH = 128;
+
+        bool fail(const char* message) {
+            _doc._error = "offset " + std::to_string(_pos) + ": " + message;
+            return false;
+        }
+
+        void skip_whitespace() {
+            while (_pos < _size && (_data[_pos] == ' ' || _data[_pos] == '\t' || _data[_pos] == '\n' || _data[_pos] == '\r')) {
+                ++_pos;
+            }
+        }
+
+        bool consume_literal(std::string_view literal) {
+            if (std::string_view(_data + _pos, _size - _pos).substr(0, literal.size()) != literal) {
+                return fail("invalid literal");
+            }
+            _pos += literal.size();
+            return true;
+        }
+
+        std::uint32_t add_node(JsonValue::Type type) {
+            JsonDocument::Node node;
+            node.type = type;
+            _doc._nodes.push_back(node);
+            return static_cast<std::uint32_t>(_doc._nodes.size() - 1);
+        }
+
+        static void append_utf8(char* out, std::size_t& w, std::uint32_t cp) {
+            if (cp < 0x80) {
+                out[w++] = static_cast<char>(cp);
+            } else if (cp < 0x800) {
+                out[w++] = static_cast<char>(0xC0 | (cp >> 6));
+                out[w++] = static_cast<char>(0x80 | (cp & 0x3F));
+            } else if (cp < 0x10000) {
+                out[w++] = static_cast<char>(0xE0 | (cp >> 12));
+                out[w++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                out[w++] = static_cast<char>(0x80 | (cp & 0x3F));
+            } else {
+                out[w++] = static_cast<char>(0xF0 | (cp >> 18));
+                out[w++] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                out[w++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                out[w++] = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+        }
+
+        bool parse_hex4(std::uint32_t& value) {
+            if (_size - _pos < 4) return fail("truncated \\u escape");
+            value = 0;
+            for (int i = 0; i < 4; ++i) {
+                const char c = _data[_pos++];
+                value <<= 4;
+                if (c >= '0' && c <= '9') value |= static_cast<std::uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f') value |= static_cast<std::uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F') value |= static_cast<std::uint32_t>(c - 'A' + 10);
+                else return fail("invalid \\u escape");
+            }
+            return true;
+        }
+
+        // Parse a string starting at the opening quote. The decoded text is written back over the raw
+        // text (an escape sequence is always at least as long as what it decodes to).
+        bool parse_string(std::string_view& out) {
+            ++_pos;
+            const std::size_t start = _pos;
+            std::size_t w = _pos;
+            while (_pos < _size) {
+                const char c = _data[_pos];
+                if (c == '"') {
+                    out = std::string_view(_data + start, w - start);
+                    ++_pos;
+                    return true;
+                }
+                if (static_cast<unsigned char>(c) < 0x20) return fail("control character in string");
+                if (c != '\\') {
+                    _data[w++] = c;
+                    ++_pos;
+                    continue;
+                }
+                if (++_pos >= _size) break;
+                const char e = _data[_pos++];
+                switch (e) {
+                    case '"': _data[w++] = '"'; break;
+                    case '\\': _data[w++] = '\\'; break;
+                    case '/': _data[w++] = '/'; break;
+                    case 'b': _data[w++] = '\b'; break;
+                    case 'f': _data[w++] = '\f'; break;
+                    case 'n': _data[w++] = '\n'; break;
+                    case 'r': _data[w++] = '\r'; break;
+                    case 't': _data[w++] = '\t'; break;
+                    case 'u': {
+                        std::uint32_t cp = 0;
+                        if (!parse_hex4(cp)) return false;
+                        // Combine a surrogate pair into one code point.
+                        if (cp >= 0xD800 && cp <= 0xDBFF && _size - _pos >= 6 && _data[_pos] == '\\' && _data[_pos + 1] == 'u') {
+                            _pos += 2;
+                            std::uint32_t low = 0;
+                            if (!parse_hex4(low)) return false;
+                            cp = (low >= 0xDC00 && low <= 0xDFFF) ? 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00) : 0xFFFD;
+                        }
+                        append_utf8(_data, w, cp);
+                        break;
+                    }
+                    default:
+                        return fail("invalid escape sequence");
+                }
+            }
+            return fail("unterminated string");
+        }
+
+        bool parse_number(std::uint32_t node) {
+            const char* begin = _data + _pos;
+            char* end = nullptr;
+            // The buffer is a std::string, so strtod always finds a terminator.
+            const double value = std::strtod(begin, &end);
+            if (end == begin) return fail("invalid number");
+            _doc._nodes[node].number = value;
+            _doc._nodes[node].text = std::string_view(begin, static_cast<std::size_t>(end - begin));
+            _pos += static_cast<std::size_t>(end - begin);
+            return true;
+        }
+
+        bool parse_value(int depth) {
+            if (_pos >= _size) return fail("unexpected end of input");
+            const char c = _data[_pos];
+            switch (c) {
+                case '{': return parse_container(depth, true);
+                case '[': return parse_container(depth, false);
+                case '"': {
+                    const auto node = add_node(JsonValue::Type::String);
+                    std::string_view text;
+                    if (!parse_string(text)) return false;
+                    _doc._nodes[node].text = text;
+                    _doc._nodes[node].next = node + 1;
+                    return true;
+                }
+                case 't':
+                case 'f': {
+                    const auto node = add_node(JsonValue::Type::Bool);
+                    _doc._nodes[node].boolean = (c == 't');
+                    _doc._nodes[node].next = node + 1;
+                    return consume_literal(c == 't' ? "true" : "false");
+                }
+                case 'n': {
+                    const auto node = add_node(JsonValue::Type::Null);
+                    _doc._nodes[node].next = node + 1;
+                    return consume_literal("null");
+                }
+                default:
+                    if (c == '-' || (c >= '0' && c <= '9')) {
+                        const auto node = add_node(JsonValue::Type::Number);
+                        _doc._nodes[node].next = node + 1;
+                        return parse_number(node);
+                    }
+                    return fail("unexpected character");
+            }
+        }
+
+        bool parse_container(int depth, bool object) {
+            if (depth >= MAX_DEPTH) return fail("nesting too deep");
+            const auto node = add_node(object ? JsonValue::Type::Object : JsonValue::Type::Array);
+            const char close = object ? '}' : ']';
+            ++_pos;
+            skip_whitespace();
+            std::uint32_t count = 0;
+            if (_pos < _size && _data[_pos] == close) {
+                ++_pos;
+            } else {
+                while (true) {
+                    std::string_view key;
+                    if (object) {
+                        if (_pos >= _size || _data[_pos] != '"') return fail("expected member name");
+                        if (!parse_string(key)) return false;
+                        skip_whitespace();
+                        if (_pos >= _size || _data[_pos] != ':') return fail("expected ':'");
+                        ++_pos;
+                        skip_whitespace();
+                    }
+                    const auto child = static_cast<std::uint32_t>(_doc._nodes.size());
+                    if (!parse_value(depth + 1)) return false;
+                    _doc._nodes[child].key = key;
+                    ++count;
+                    skip_whitespace();
+                    if (_pos < _size && _data[_pos] == ',') {
+                        ++_pos;
+                        skip_whitespace();
+                        continue;
+                    }
+                    if (_pos < _size && _data[_pos] == close) {
+                        ++_pos;
+                        break;
+                    }
+                    return fail(object ? "expected ',' or '}'" : "expected ',' or ']'");
+                }
+            }
+            _doc._nodes[node].count = count;
+            _doc._nodes[node].next = static_cast<std::uint32_t>(_doc._nodes.size());
+            return true;
+        }
+
+        JsonDocument& _doc;
+        char* _data;
+        std::size_t _size;
+        std::size_t _pos = 0;
+    };
+
+    bool JsonDocument::parse(std::string text) {
+        _buffer = std::move(text);
+        _nodes.clear();
+        _error.clear();
+        // Level files hold a few hundred values at most; one node per ~8 bytes is a generous bound.
+        _nodes.reserve(_buffer.size() / 8 + 1);
+        if (!JsonParser(*this).run()) {
+            _nodes.clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool JsonDocument::load_file(std::string_view path) {
+        std::ifstream file = JsonHelper::open_level_file(path);
+        if (!file.is_open()) {
+            _nodes.clear();
+            _error = "cannot open '" + std::string(path) + "'";
+            return false;
+        }
+        return parse(std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>()));
+    }
+
+    JsonValue::Iterator& JsonValue::Iterator::operator++() {
+        _index = _doc->_nodes[_index].next;
+        return *this;
+    }
+
+    JsonValue::Type JsonValue::type() const {
+        return _doc ? _doc->_nodes[_index].type : Type::Invalid;
+    }
+
+    std::string_view JsonValue::key() const {
+        return _doc ? _doc->_nodes[_index].key : std::string_view();
+    }
+
+    std::size_t JsonValue::size() const {
+        return (is_array() || is_object()) ? _doc->_nodes[_index].count : 0;
+    }
+
+    JsonValue::Iterator JsonValue::begin() const {
+        if (!is_array() && !is_object()) return end();
+        return {_doc, _index + 1};
+    }
+
+    JsonValue::Iterator JsonValue::end() const {
+        return _doc ? Iterator(_doc, _doc->_nodes[_index].next) : Iterator(nullptr, 0);
+    }
+
+    JsonValue JsonValue::operator[](std::string_view key) const {
+        if (!is_object()) return {};
+        for (const JsonValue member : *this) {
+            if (member.key() == key) return member;
+        }
+        return {};
+    }
+
+    JsonValue JsonValue::operator[](std::size_t index) const {
+        if (!is_array() || index >= size()) return {};
+        auto it = begin();
+        for (std::size_t i = 0; i < index; ++i) ++it;
+        return *it;
+    }
+
+    std::string_view JsonValue::as_string(std::string_view fallback) const {
+        return is_string() ? _doc->_nodes[_index].text : fallback;
+    }
+
+    double JsonValue::as_number(double fallback) const {
+        return is_number() ? _doc->_nodes[_index].number : fallback;
+    }
+
+    bool JsonValue::as_bool(bool fallback) const {
+        return is_bool() ? _doc->_nodes[_index].boolean : fallback;
+    }
+
+    bool JsonValue::get(std::string_view key, std::string& value) const {
+        const JsonValue member = (*this)[key];
+        if (!member.is_string()) return false;
+        value.assign(member.as_string());
+        return true;
+    }
+
+    bool JsonValue::get(std::string_view key, std::pmr::string& value) const {
+        const JsonValue member = (*this)[key];
+        if (!member.is_string()) return false;
+        value.assign(member.as_string());
+        return true;
+    }
+
+    bool JsonValue::get(std::string_view key, float& value) const {
+        const JsonValue member = (*this)[key];
+        if (!member.is_number()) return false;
+        value = member.as_float();
+        return true;
+    }
+
+    bool JsonValue::get(std::string_view key, int& value) const {
+        const JsonValue member = (*this)[key];
+        if (!member.is_number()) return false;
+        value = member.as_int();
+        return true;
+    }
+
+    bool JsonValue::get(std::string_view key, bool& value) const {
+        const JsonValue member = (*this)[key];
+        if (!member.is_bool()) return false;
+        value = member.as_bool();
+        return true;
+    }
+} // namespace zia
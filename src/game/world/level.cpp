@@ -8,126 +8,441 @@
 #include "Zia/engine/render/Renderer.hpp"
 #include "Zia/game/helpers/Constants.hpp"
 
-#include "Zia/game/world/JsonHelper.hpp"
+#include "Zia/game/world/JsonDocument.hpp"
+#include "Zia/engine/resources/AssetPathResolver.hpp"
+#include "Zia/game/world/LevelBinary.hpp"
+#include "Zia/engine/resources/MappedFile.hpp"
+#include "Zia/engine/IAssetManager.hpp"
+#include "Zia/game/world/Tileset.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
+#include "Zia/engine/memory/LevelArena.hpp"
 
 #include <algorithm>
 #include <utility>
-#include <filesystem>
-#include <fstream>
 #include <cmath>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <system_error>
 
 namespace zia {
-    // Removed anonymous namespace helpers; they are now in Zia::JsonHelper
+    // The level's contents. Every container allocates from 'arena', which is declared first so it
+    // outlives them. The tile map and camera stay on the heap: tile_map() and camera() share ownership
+    // with callers, who may hold them past unload() (e.g. across a reload).
+    struct Level::Storage {
+        Storage()
+            : entity_spawns(&arena), chunk_spawn_begin(&arena), spawn_consumed(&arena),
+              background_path(&arena), background_layers(&arena) {}
 
-    // Used by: PlayScene::on_enter, PlayScene (loads level and sets camera bounds), tests
-    // Loads a level from a JSON file, initializes the tile map, entity spawns, background, and camera bounds.
+        // Destroy the contents and rewind the arena in one go. The containers are swapped with empty
+        // ones rather than cleared, since clear() keeps their buffers, which are about to be handed
+        // out again (move assignment would too for a string, which keeps its buffer on short values).
+        void release() {
+            if (tile_map) tile_map->unload();
+            tile_map.reset();
+            camera.reset();
+            std::pmr::vector<EntitySpawn>(&arena).swap(entity_spawns);
+            std::pmr::vector<std::size_t>(&arena).swap(chunk_spawn_begin);
+            std::pmr::vector<bool>(&arena).swap(spawn_consumed);
+            std::pmr::string(&arena).swap(background_path);
+            std::pmr::vector<BackgroundLayer>(&arena).swap(background_layers);
+            arena.reset();
+        }
+
+        engine::LevelArena arena;
+        std::pmr::vector<EntitySpawn> entity_spawns;
+        // Per-chunk start offsets into entity_spawns (chunk_count + 1 entries).
+        std::pmr::vector<std::size_t> chunk_spawn_begin;
+        std::pmr::vector<bool> spawn_consumed;
+        std::pmr::string background_path;
+        std::pmr::vector<BackgroundLayer> background_layers;
+        std::shared_ptr<TileMap> tile_map;
+        std::shared_ptr<Camera> camera;
+    };
+
+    Level::Level() = default;
+    Level::~Level() = default;
+    Level::Level(Level &&other) noexcept = default;
+    Level &Level::operator=(Level &&other) noexcept = default;
+
+    namespace {
+        // Compiled form of 'level_id', unless its JSON source has been edited (e.g. saved from the
+        // editor) since it was compiled.
+        std::optional<std::filesystem::path> find_compiled_level(std::string_view level_id) {
+            const auto &resolver = engine::asset_path_resolver();
+            const auto json = resolver.resolve(level_id);
+            const auto compiled = resolver.resolve(
+                compiled_level_path(json ? *json : std::filesystem::path(level_id)).string());
+            if (!compiled) return std::nullopt;
+            if (json) {
+                std::error_code json_ec;
+                std::error_code compiled_ec;
+                const auto json_time = std::filesystem::last_write_time(*json, json_ec);
+                const auto compiled_time = std::filesystem::last_write_time(*compiled, compiled_ec);
+                if (json_ec || compiled_ec || json_time > compiled_time) return std::nullopt;
+            }
+            return compiled;
+        }
+
+        // Tile source reading a compiled level's layers straight from its mapping, so only the pages of
+        // chunks actually streamed in are ever touched.
+        class MappedTileSource final : public TileSource {
+        public:
+            MappedTileSource(engine::MappedFile file, std::uint64_t offset, int width, int height)
+                : _file(std::move(file)), _tiles(_file.data() + offset), _width(width), _height(height) {}
+
+            void read_columns(int layer, int first_column, int count, TileId *out) const override {
+                const auto layer_size = static_cast<std::size_t>(_width) * static_cast<std::size_t>(_height);
+                for (int y = 0; y < _height; ++y) {
+                    const auto cell = static_cast<std::size_t>(layer) * layer_size +
+                                      static_cast<std::size_t>(y) * static_cast<std::size_t>(_width) + static_cast<std::size_t>(first_column);
+                    // Byte copy: the mapping gives no alignment guarantee for uint16 reads.
+                    std::memcpy(out + static_cast<std::size_t>(y) * static_cast<std::size_t>(count),
+                                _tiles + cell * sizeof(TileId), static_cast<std::size_t>(count) * sizeof(TileId));
+                }
+            }
+
+        private:
+            engine::MappedFile _file;
+            const std::uint8_t *_tiles;
+            int _width;
+            int _height;
+        };
+
+        // Section [offset, offset + bytes) lies inside a file of 'size' bytes.
+        bool section_fits(std::uint64_t offset, std::uint64_t bytes, std::size_t size) {
+            return offset <= size && bytes <= size - offset;
+        }
+    }
+
+    // Used by: PlayPipeline::enter and prefetch (loads level and sets camera bounds), tests
+    // Loads a level, preferring its compiled form; see the header.
     void Level::load(std::string_view level_id) {
-        _tile_map = std::make_shared<TileMap>();
-        std::vector<EntitySpawn> spawns;
-        _tile_map->load(level_id, std::optional<std::reference_wrapper<std::vector<EntitySpawn>>>(std::ref(spawns))); // Load tile map and collect entity spawn points
-        _entity_spawns = std::move(spawns);
+        ZIA_PROFILE_SCOPE("level_load");
+        if (!level_id.empty()) {
+            if (const auto compiled = find_compiled_level(level_id); compiled && load_compiled(*compiled)) {
+                return;
+            }
+        }
+        load_json(level_id);
+    }
+
+    // Used by: Level::load, level_compiler (verification)
+    // Maps a .zlvl file and fills the level from it: tile chunks are later read straight from the mapping
+    // and spawns and background layers come from pre-resolved tables, so no per-tile parsing happens.
+    bool Level::load_compiled(const std::filesystem::path &path) {
+        ZIA_PROFILE_SCOPE("level_map_compiled");
+        engine::MappedFile file;
+        if (!file.open(path)) {
+            return false;
+        }
+
+        LevelFileHeader header;
+        const std::size_t size = file.size();
+        const std::uint8_t *data = file.data();
+        if (size >= sizeof(header)) {
+            std::memcpy(&header, data, sizeof(header));
+        }
+        const auto tile_bytes = static_cast<std::uint64_t>(std::max(header.width, 0)) * static_cast<std::uint64_t>(std::max(header.height, 0)) *
+                                static_cast<std::uint64_t>(header.tile_layer_count) * sizeof(TileId);
+        const bool valid = size >= sizeof(header) && header.magic == LEVEL_MAGIC && header.version == LEVEL_VERSION &&
+                           header.width > 0 && header.height > 0 && header.tile_layer_count > 0 &&
+                           section_fits(header.tiles_offset, tile_bytes, size) &&
+                           section_fits(header.spawns_offset, static_cast<std::uint64_t>(header.spawn_count) * sizeof(LevelSpawnRecord), size) &&
+                           section_fits(header.layers_offset, static_cast<std::uint64_t>(header.layer_count) * sizeof(LevelLayerRecord), size) &&
+                           section_fits(header.strings_offset, header.strings_size, size) &&
+                           (header.strings_size == 0 || data[header.strings_offset + header.strings_size - 1] == '\0');
+        if (!valid) {
+            std::cerr << "Level: '" << path.string() << "' is not a valid v" << LEVEL_VERSION << " compiled level" << std::endl;
+            return false;
+        }
+
+        // Strings are NUL-terminated inside the table (checked above); out-of-range offsets read as empty.
+        const char *strings = reinterpret_cast<const char*>(data + header.strings_offset);
+        const auto string_at = [&](std::uint32_t offset) {
+            return (offset == LEVEL_NO_STRING || offset >= header.strings_size) ? std::string_view() : std::string_view(strings + offset);
+        };
+
+        Storage &storage = begin_load();
+        storage.entity_spawns.resize(header.spawn_count);
+        for (std::uint32_t i = 0; i < header.spawn_count; ++i) {
+            LevelSpawnRecord record;
+            std::memcpy(&record, data + header.spawns_offset + i * sizeof(LevelSpawnRecord), sizeof(record));
+            EntitySpawn &spawn = storage.entity_spawns[i];
+            spawn.type = string_at(record.type);
+            spawn.name = string_at(record.name);
+            spawn.tile_x = record.tile_x;
+            spawn.tile_y = record.tile_y;
+        }
+
+        storage.background_layers.resize(header.layer_count);
+        for (std::uint32_t i = 0; i < header.layer_count; ++i) {
+            LevelLayerRecord record;
+            std::memcpy(&record, data + header.layers_offset + i * sizeof(LevelLayerRecord), sizeof(record));
+            BackgroundLayer &layer = storage.background_layers[i];
+            layer.path = string_at(record.path);
+            layer.scale = record.scale;
+            layer.parallax = record.parallax;
+            layer.repeat = record.repeat != 0;
+            layer.repeat_x = record.repeat_x != 0;
+        }
+
+        storage.background_path = string_at(header.background_path);
+        storage.tile_map = std::make_shared<TileMap>();
+        // The mapping moves into the tile source and stays open while the level is loaded.
+        const std::string_view tileset_path = string_at(header.tileset_path);
+        auto tileset = tileset_path.empty() ? Tileset::builtin() : Tileset::load(tileset_path);
+        storage.tile_map->assign(header.width, header.height, static_cast<int>(header.tile_layer_count),
+                                 std::make_shared<MappedTileSource>(std::move(file), header.tiles_offset, header.width, header.height),
+                                 std::move(tileset));
+        _background_scale = header.background_scale;
+        _clouds_enabled = (header.flags & LEVEL_FLAG_CLOUDS) != 0;
+        index_spawns();
+        reset_camera();
+        return true;
+    }
+
+    // Used by: Level::load, level_compiler
+    // Loads a level from a JSON file, initializes the tile map, entity spawns, background, and camera bounds.
+    // The file is read and parsed once; the tile map and the level metadata share the document.
+    void Level::load_json(std::string_view level_id) {
+        Storage &storage = begin_load();
+        storage.tile_map = std::make_shared<TileMap>();
+        const auto spawns_ref = std::optional<std::reference_wrapper<std::pmr::vector<EntitySpawn>>>(std::ref(storage.entity_spawns));
 
-        // Try to read the background image path and scale from the level file (if present)
-        _background_path.clear();
         _background_scale = 1.0f;
-        if (!level_id.empty()) {
-            std::ifstream file = JsonHelper::open_level_file(level_id);
-            if (file) {
-                const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-                std::string bg;
-                if (JsonHelper::extract_string_field(content, "background", bg)) {
-                    _background_path = bg;
-                }
-                float bscale = 1.0f;
-                if (JsonHelper::extract_float_field(content, "background_scale", bscale)) {
-                    _background_scale = bscale;
-                }
+        _clouds_enabled = false;
 
-                // Parse background_layers
-                _background_layers.clear();
-                std::size_t layers_pos = content.find("\"background_layers\"");
-                if (layers_pos != std::string::npos) {
-                    std::size_t colon_pos = content.find(':', layers_pos);
-                    if (colon_pos != std::string::npos) {
-                        std::size_t bracket_pos = content.find('[', colon_pos);
-                        if (bracket_pos != std::string::npos) {
-                            std::size_t end_bracket = content.find(']', bracket_pos);
-                            if (end_bracket != std::string::npos) {
-                                std::string layers_content = content.substr(bracket_pos + 1, end_bracket - bracket_pos - 1);
-                                // Parse the object
-                                BackgroundLayer layer;
-                                if (JsonHelper::extract_string_field(layers_content, "path", layer.path)) {
-                                    JsonHelper::extract_float_field(layers_content, "scale", layer.scale);
-                                    JsonHelper::extract_float_field(layers_content, "parallax", layer.parallax);
-                                    JsonHelper::extract_bool_field(layers_content, "repeat", layer.repeat);
-                                    JsonHelper::extract_bool_field(layers_content, "repeat_x", layer.repeat_x);
-                                    _background_layers.push_back(layer);
-                                }
-                            }
-                        }
-                    }
-                }
+        JsonDocument document;
+        bool parsed = false;
+        {
+            ZIA_PROFILE_SCOPE("json_parse");
+            parsed = !level_id.empty() && document.load_file(level_id);
+        }
+        if (!parsed) {
+            if (!level_id.empty() && !document.error().empty()) {
+                std::cerr << "Level: " << document.error() << std::endl;
+            }
+            // Missing or invalid file: TileMap falls back to its default map.
+            storage.tile_map->load(level_id, spawns_ref);
+        } else {
+            const JsonValue root = document.root();
+            storage.tile_map->load(root, level_id, spawns_ref); // Load tile map and collect entity spawn points
 
-                // Parse clouds
-                bool clouds = false;
-                if (JsonHelper::extract_bool_field(content, "clouds", clouds)) {
-                    _clouds_enabled = clouds;
+            // Background image path and scale (optional)
+            root.get("background", storage.background_path);
+            root.get("background_scale", _background_scale);
+
+            // Additional parallax layers (optional); entries without a path are skipped.
+            for (const JsonValue entry : root["background_layers"]) {
+                BackgroundLayer layer(storage.background_layers.get_allocator());
+                if (entry.get("path", layer.path)) {
+                    entry.get("scale", layer.scale);
+                    entry.get("parallax", layer.parallax);
+                    entry.get("repeat", layer.repeat);
+                    entry.get("repeat_x", layer.repeat_x);
+                    storage.background_layers.push_back(std::move(layer));
                 }
             }
+
+            root.get("clouds", _clouds_enabled);
         }
+        index_spawns();
+        reset_camera();
+    }
 
-        _camera = std::make_shared<Camera>();
+    // Used by: load_json, load_compiled
+    // Orders spawns by tile chunk so ChunkStreamingSystem can spawn a chunk's entities when it streams in.
+    void Level::index_spawns() {
+        Storage &storage = *_storage;
+        const int chunk_count = std::max(1, storage.tile_map ? storage.tile_map->chunk_count() : 1);
+        const auto chunk_of = [chunk_count](const EntitySpawn &spawn) {
+            return std::clamp(TileMap::chunk_of_column(std::max(0, spawn.tile_x)), 0, chunk_count - 1);
+        };
+        std::stable_sort(storage.entity_spawns.begin(), storage.entity_spawns.end(), [&](const EntitySpawn &a, const EntitySpawn &b) {
+            return chunk_of(a) < chunk_of(b);
+        });
+
+        auto &begin = storage.chunk_spawn_begin;
+        begin.assign(static_cast<std::size_t>(chunk_count) + 1, 0);
+        for (const auto &spawn : storage.entity_spawns) {
+            ++begin[static_cast<std::size_t>(chunk_of(spawn)) + 1];
+        }
+        for (std::size_t i = 1; i < begin.size(); ++i) {
+            begin[i] += begin[i - 1];
+        }
+        storage.spawn_consumed.assign(storage.entity_spawns.size(), false);
+    }
+
+    // Used by: ChunkStreamingSystem
+    std::pair<std::size_t, std::size_t> Level::spawn_range(int chunk) const {
+        if (!_storage || chunk < 0 || static_cast<std::size_t>(chunk) + 1 >= _storage->chunk_spawn_begin.size()) {
+            return {0, 0};
+        }
+        const auto &begin = _storage->chunk_spawn_begin;
+        return {begin[static_cast<std::size_t>(chunk)], begin[static_cast<std::size_t>(chunk) + 1]};
+    }
+
+    // Used by: ChunkStreamingSystem, PlayScene (player spawn)
+    bool Level::consume_spawn(std::size_t index) {
+        if (!_storage || index >= _storage->spawn_consumed.size() || _storage->spawn_consumed[index]) {
+            return false;
+        }
+        _storage->spawn_consumed[index] = true;
+        return true;
+    }
+
+    bool Level::spawn_consumed(std::size_t index) const {
+        return _storage && index < _storage->spawn_consumed.size() && _storage->spawn_consumed[index];
+    }
+
+    // Used by: WorldSnapshot::restore
+    void Level::set_spawn_consumed(std::size_t index, bool consumed) {
+        if (_storage && index < _storage->spawn_consumed.size()) {
+            _storage->spawn_consumed[index] = consumed;
+        }
+    }
+
+    // Used by: PlayPipeline::populate_level
+    std::optional<std::size_t> Level::player_spawn_index() const {
+        const auto &spawns = entity_spawns();
+        for (std::size_t i = 0; i < spawns.size(); ++i) {
+            const auto &type = spawns[i].type;
+            if (type == "player" || type == "Player") {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Used by: load_json, load_compiled
+    void Level::reset_camera() {
+        Storage &storage = *_storage;
+        storage.camera = std::make_shared<Camera>();
 
         // Set camera bounds to match the size of the tile map
-        const int tile_size = _tile_map->tile_size();
-        const auto map_width = static_cast<float>(_tile_map->width() * tile_size);
-        const auto map_height = static_cast<float>(_tile_map->height() * tile_size);
-        _camera->set_bounds(0.0f, 0.0f, map_width, map_height);
+        const int tile_size = storage.tile_map->tile_size();
+        const auto map_width = static_cast<float>(storage.tile_map->width() * tile_size);
+        const auto map_height = static_cast<float>(storage.tile_map->height() * tile_size);
+        storage.camera->set_bounds(0.0f, 0.0f, map_width, map_height);
     }
 
-    // Used by: PlayScene::on_exit, LevelSystem (cleanup), tests
-    // Unloads the level, releasing tile map and camera resources, and clearing entity spawns and background info.
+    // Used by: PlayPipeline::exit and level switches, LevelSystem (cleanup), tests
+    // Unloads the level: entity spawns and background info go with one arena reset, the tile map and
+    // camera are released. The storage and its arena's first block are kept for the next load.
     void Level::unload() {
-        if (_tile_map) _tile_map->unload();
-        _tile_map.reset();
-        _camera.reset();
-        _entity_spawns.clear();
-        _background_path.clear();
-        _background_layers.clear();
+        if (_storage) _storage->release();
+        _tileset_texture_base = -1;
+    }
+
+    // Used by: load_json, load_compiled
+    Level::Storage &Level::begin_load() {
+        if (_storage) {
+            _storage->release();
+        } else {
+            _storage = std::make_unique<Storage>();
+        }
+        return *_storage;
+    }
+
+    // Used by: PlayPipeline (live and prepared registries)
+    std::pmr::memory_resource *Level::component_memory() {
+        return _storage ? _storage->arena.pool() : nullptr;
     }
 
-    // Used by: PlayScene::update (per-frame), Game loop
+    // Used by: PlayPipeline::update (per-frame)
     // Updates the camera and any level Scene that depends on time.
     void Level::update(float dt) {
-        if (_camera) _camera->update(dt);
+        if (_storage && _storage->camera) _storage->camera->update(dt);
     }
 
-    // Used by: PlayScene::render, TileMap::render (delegation), tests
-    // Renders the visible solid tiles of the level within the camera's viewport.
+    namespace {
+        // Visible tile range of 'camera' over 'map' (inclusive bounds, clamped to the map).
+        struct TileRange {
+            int min_tx;
+            int min_ty;
+            int max_tx;
+            int max_ty;
+        };
+
+        TileRange visible_tiles(const TileMap &map, const Camera &camera) {
+            const int tile_size = map.tile_size();
+            // Use camera viewport (world units) rather than renderer global viewport so the top inset is respected.
+            const float view_left = camera.x();
+            const float view_top = camera.y();
+            const float view_right = view_left + camera.viewport_width();
+            const float view_bottom = view_top + camera.viewport_height();
+
+            const int max_tx = std::max(0, map.width() - 1);
+            const int max_ty = std::max(0, map.height() - 1);
+            return {std::clamp(static_cast<int>(std::floor(view_left / tile_size)), 0, max_tx),
+                    std::clamp(static_cast<int>(std::floor(view_top / tile_size)), 0, max_ty),
+                    std::clamp(static_cast<int>(std::floor((view_right - 1.0f) / tile_size)), 0, max_tx),
+                    std::clamp(static_cast<int>(std::floor((view_bottom - 1.0f) / tile_size)), 0, max_ty)};
+        }
+    }
+
+    // Used by: PlayPipeline::populate_level
+    // Tileset image i is drawn with texture id first_texture_id + i.
+    void Level::bind_tileset_textures(int first_texture_id) {
+        _tileset_texture_base = first_texture_id;
+    }
+
+    // Used by: PlayPipeline (level render pass)
+    // Draws every layer of the visible tiles with its tileset art. Tiles without art (or whose image is
+    // not bound) are drawn as flat TILE_COLOR rectangles when solid, as before tilesets existed.
+    void Level::render(zia::engine::IRenderer &renderer, const zia::engine::IAssetManager &assets, const Camera &camera) {
+        if (!_storage || !_storage->tile_map) return;
+        const TileMap &map = *_storage->tile_map;
+
+        const auto &tileset = map.tileset();
+        const auto tile_size = static_cast<float>(map.tile_size());
+        const TileRange range = visible_tiles(map, camera);
+
+        // Resolve each tileset image once per frame.
+        static thread_local std::vector<std::shared_ptr<const sf::Texture>> textures;
+        textures.clear();
+        const auto image_count = std::min(tileset->images().size(), static_cast<std::size_t>(zia::constants::TILESET_MAX_IMAGES));
+        for (std::size_t i = 0; i < image_count; ++i) {
+            textures.push_back(_tileset_texture_base >= 0 ? assets.get_texture(_tileset_texture_base + static_cast<int>(i)) : nullptr);
+        }
+
+        for (int layer = 0; layer < map.layer_count(); ++layer) {
+            for (int ty = range.min_ty; ty <= range.max_ty; ++ty) {
+                for (int tx = range.min_tx; tx <= range.max_tx; ++tx) {
+                    const TileId id = map.tile(layer, tx, ty);
+                    if (id == 0) continue;
+                    const float x = static_cast<float>(tx) * tile_size;
+                    const float y = static_cast<float>(ty) * tile_size;
+                    if (tileset->has_art(id)) {
+                        const TileArt &art = tileset->art(id);
+                        if (art.image < textures.size() && textures[art.image]) {
+                            renderer.draw_sprite(*textures[art.image], x, y, tile_size, tile_size,
+                                                 sf::IntRect({art.x, art.y}, {art.width, art.height}));
+                            continue;
+                        }
+                    }
+                    if ((tileset->flags(id) & TILE_SOLID) != 0) {
+                        renderer.draw_rect(x, y, tile_size, tile_size, zia::constants::TILE_COLOR);
+                    }
+                }
+            }
+        }
+    }
+
+    // Used by: tests and callers without an asset manager
+    // Renders the visible solid tiles of the level within the camera's viewport as flat rectangles.
     void Level::render(zia::engine::IRenderer &renderer, const Camera &camera) {
-        if (!_tile_map) return;
-
-        const int tile_size = _tile_map->tile_size();
-        // Use camera viewport (world units) rather than renderer global viewport so the top inset is respected.
-        const auto viewport_w = camera.viewport_width();
-        const auto viewport_h = camera.viewport_height();
-        const float view_left = camera.x();
-        const float view_top = camera.y();
-        const float view_right = view_left + viewport_w;
-        const float view_bottom = view_top + viewport_h;
-
-        // Calculate visible tile range based on camera viewport
-        const int max_tx = std::max(0, _tile_map->width() - 1);
-        const int max_ty = std::max(0, _tile_map->height() - 1);
-        const int min_tx = std::clamp(static_cast<int>(std::floor(view_left / tile_size)), 0, max_tx);
-        const int min_ty = std::clamp(static_cast<int>(std::floor(view_top / tile_size)), 0, max_ty);
-        const int max_vis_tx = std::clamp(static_cast<int>(std::floor((view_right - 1.0f) / tile_size)), 0, max_tx);
-        const int max_vis_ty = std::clamp(static_cast<int>(std::floor((view_bottom - 1.0f) / tile_size)), 0, max_ty);
+        if (!_storage || !_storage->tile_map) return;
+        const TileMap &map = *_storage->tile_map;
+
+        const int tile_size = map.tile_size();
+        const TileRange range = visible_tiles(map, camera);
 
         // Draw each solid tile in the visible range
-        for (int ty = min_ty; ty <= max_vis_ty; ++ty) {
-            for (int tx = min_tx; tx <= max_vis_tx; ++tx) {
-                if (_tile_map->is_solid(tx, ty)) {
+        for (int ty = range.min_ty; ty <= range.max_ty; ++ty) {
+            for (int tx = range.min_tx; tx <= range.max_tx; ++tx) {
+                if (map.is_solid(tx, ty)) {
                     renderer.draw_rect(
                         static_cast<float>(tx * tile_size),
                         static_cast<float>(ty * tile_size),
@@ -141,17 +456,29 @@ namespace zia {
 
     // Old render kept for compatibility: delegate to camera-aware variant using current camera if available.
     void Level::render(zia::engine::IRenderer &renderer) {
-        if (!_camera) return;
-        render(renderer, *_camera);
+        if (!_storage || !_storage->camera) return;
+        render(renderer, *_storage->camera);
     }
 
     // Used by: LevelSystem, PlayScene
     // Returns a shared pointer to the tile map for this level.
-    std::shared_ptr<TileMap> Level::tile_map() const { return _tile_map; }
+    std::shared_ptr<TileMap> Level::tile_map() const { return _storage ? _storage->tile_map : nullptr; }
     // Used by: PlayScene, systems that need camera reference
     // Returns a shared pointer to the camera for this level.
-    std::shared_ptr<Camera> Level::camera() const { return _camera; }
+    std::shared_ptr<Camera> Level::camera() const { return _storage ? _storage->camera : nullptr; }
     // Used by: PlayScene (spawning entities), LevelSystem
     // Returns a const reference to the vector of entity spawn points for this level.
-    const std::vector<EntitySpawn> &Level::entity_spawns() const { return _entity_spawns; }
+    const std::pmr::vector<EntitySpawn> &Level::entity_spawns() const {
+        static const std::pmr::vector<EntitySpawn> none;
+        return _storage ? _storage->entity_spawns : none;
+    }
+
+    std::string_view Level::background_path() const {
+        return _storage ? std::string_view(_storage->background_path) : std::string_view();
+    }
+
+    const std::pmr::vector<Level::BackgroundLayer> &Level::background_layers() const {
+        static const std::pmr::vector<BackgroundLayer> none;
+        return _storage ? _storage->background_layers : none;
+    }
 } // namespace Zia
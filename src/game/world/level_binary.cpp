@@ -0,0 +1,135 @@
+// Implements the .zlvl writer used by tools/level_compiler. The reader is Level::load_compiled.
+
+#include "Zia/game/world/LevelBinary.hpp"
+#include "Zia/game/world/Level.hpp"
+#include "Zia/game/world/TileMap.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace zia {
+    namespace {
+        constexpr std::size_t SECTION_ALIGNMENT = 8;
+
+        // Deduplicating string table; offsets index into the concatenated, NUL-terminated strings.
+        class StringTable {
+        public:
+            std::uint32_t add(std::string_view text) {
+                if (const auto it = _offsets.find(std::string(text)); it != _offsets.end()) {
+                    return it->second;
+                }
+                const auto offset = static_cast<std::uint32_t>(_bytes.size());
+                _bytes.insert(_bytes.end(), text.begin(), text.end());
+                _bytes.push_back('\0');
+                _offsets.emplace(std::string(text), offset);
+                return offset;
+            }
+
+            const std::vector<char>& bytes() const { return _bytes; }
+
+        private:
+            std::vector<char> _bytes;
+            std::unordered_map<std::string, std::uint32_t> _offsets;
+        };
+
+        std::uint64_t align_up(std::uint64_t value) {
+            return (value + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+        }
+
+        void pad_to(std::ofstream &out, std::uint64_t offset) {
+            static const char zeros[SECTION_ALIGNMENT] = {};
+            const auto pos = static_cast<std::uint64_t>(out.tellp());
+            out.write(zeros, static_cast<std::streamsize>(offset - pos));
+        }
+    }
+
+    bool write_compiled_level(const Level &level, const std::filesystem::path &path) {
+        const auto tile_map = level.tile_map();
+        if (!tile_map || tile_map->width() <= 0 || tile_map->height() <= 0) {
+            std::cerr << "write_compiled_level: level has no tile map" << std::endl;
+            return false;
+        }
+
+        StringTable strings;
+        LevelFileHeader header;
+        header.width = tile_map->width();
+        header.height = tile_map->height();
+        header.tile_size = tile_map->tile_size();
+        header.flags = level.clouds_enabled() ? LEVEL_FLAG_CLOUDS : 0u;
+        header.background_scale = level.background_scale();
+        if (!level.background_path().empty()) {
+            header.background_path = strings.add(level.background_path());
+        }
+
+        std::vector<LevelSpawnRecord> spawns;
+        spawns.reserve(level.entity_spawns().size());
+        for (const auto &spawn : level.entity_spawns()) {
+            LevelSpawnRecord record;
+            record.type = strings.add(spawn.type);
+            if (!spawn.name.empty()) {
+                record.name = strings.add(spawn.name);
+            }
+            record.tile_x = spawn.tile_x;
+            record.tile_y = spawn.tile_y;
+            spawns.push_back(record);
+        }
+
+        std::vector<LevelLayerRecord> layers;
+        layers.reserve(level.background_layers().size());
+        for (const auto &layer : level.background_layers()) {
+            LevelLayerRecord record;
+            record.path = strings.add(layer.path);
+            record.scale = layer.scale;
+            record.parallax = layer.parallax;
+            record.repeat = layer.repeat ? 1 : 0;
+            record.repeat_x = layer.repeat_x ? 1 : 0;
+            layers.push_back(record);
+        }
+
+        const auto layer_size = static_cast<std::size_t>(header.width) * static_cast<std::size_t>(header.height);
+        std::vector<TileId> tiles(layer_size * static_cast<std::size_t>(tile_map->layer_count()));
+        std::vector<TileId> layer_tiles;
+        for (int layer = 0; layer < tile_map->layer_count(); ++layer) {
+            tile_map->copy_layer(layer, layer_tiles);
+            std::copy(layer_tiles.begin(), layer_tiles.end(), tiles.begin() + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(layer) * layer_size));
+        }
+        header.tile_layer_count = static_cast<std::uint32_t>(tile_map->layer_count());
+        if (tile_map->tileset() && !tile_map->tileset()->path().empty()) {
+            header.tileset_path = strings.add(tile_map->tileset()->path());
+        }
+        header.spawn_count = static_cast<std::uint32_t>(spawns.size());
+        header.layer_count = static_cast<std::uint32_t>(layers.size());
+        header.tiles_offset = align_up(sizeof(LevelFileHeader));
+        header.spawns_offset = align_up(header.tiles_offset + tiles.size() * sizeof(TileId));
+        header.layers_offset = align_up(header.spawns_offset + spawns.size() * sizeof(LevelSpawnRecord));
+        header.strings_offset = align_up(header.layers_offset + layers.size() * sizeof(LevelLayerRecord));
+        header.strings_size = strings.bytes().size();
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            std::cerr << "write_compiled_level: cannot write '" << path.string() << "'" << std::endl;
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        pad_to(out, header.tiles_offset);
+        out.write(reinterpret_cast<const char*>(tiles.data()), static_cast<std::streamsize>(tiles.size() * sizeof(TileId)));
+        pad_to(out, header.spawns_offset);
+        out.write(reinterpret_cast<const char*>(spawns.data()), static_cast<std::streamsize>(spawns.size() * sizeof(LevelSpawnRecord)));
+        pad_to(out, header.layers_offset);
+        out.write(reinterpret_cast<const char*>(layers.data()), static_cast<std::streamsize>(layers.size() * sizeof(LevelLayerRecord)));
+        pad_to(out, header.strings_offset);
+        out.write(strings.bytes().data(), static_cast<std::streamsize>(strings.bytes().size()));
+        return static_cast<bool>(out);
+    }
+
+    std::filesystem::path compiled_level_path(const std::filesystem::path &level_path) {
+        auto compiled = level_path;
+        compiled.replace_extension(".zlvl");
+        return compiled;
+    }
+} // namespace zia
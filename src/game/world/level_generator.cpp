@@ -0,0 +1,248 @@
+// Implements the procedural level generator used for stress levels (tools/level_generator, zia_bench).
+
+#include "Zia/game/world/LevelGenerator.hpp"
+#include "Zia/game/world/Level.hpp"
+#include "Zia/game/world/LevelBinary.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace zia {
+    namespace {
+        // Columns at the left edge kept free of pits, platforms and enemies around the player spawn.
+        constexpr int SAFE_COLUMNS = 8;
+        // Columns at the right edge kept free of pits so the level end stays reachable.
+        constexpr int SAFE_END_COLUMNS = 4;
+        constexpr int CLUSTER_SIZE = 8;
+
+        constexpr std::string_view SKY_PATH = "assets/environment/background/sky.png";
+        constexpr std::array<std::string_view, 4> LAYER_ART = {
+            "assets/environment/background/mountains.png",
+            "assets/Backgrounds/Layer0_0.png",
+            "assets/Backgrounds/Layer1_0.png",
+            "assets/Backgrounds/Layer2_0.png",
+        };
+
+        // Only the engine's output is specified by the standard (the distributions are not), so values
+        // are derived from it directly and a seed gives the same file with every standard library.
+        class GeneratorRng {
+        public:
+            explicit GeneratorRng(std::uint32_t seed) : _engine(seed) {}
+
+            // Uniform in [lo, hi].
+            int next_int(int lo, int hi) {
+                if (hi <= lo) return lo;
+                return lo + static_cast<int>(_engine() % static_cast<std::uint32_t>(hi - lo + 1));
+            }
+
+            // Uniform in [0, 1).
+            float next_unit() { return static_cast<float>(_engine() >> 8) * (1.0f / 16777216.0f); }
+
+        private:
+            std::mt19937 _engine;
+        };
+
+        struct Cell {
+            int x;
+            int y;
+        };
+
+        // Empty cells right above a solid tile, ordered by column.
+        std::vector<Cell> standing_cells(const std::vector<std::string> &rows, int width, int height) {
+            std::vector<Cell> cells;
+            for (int x = SAFE_COLUMNS; x < width; ++x) {
+                for (int y = 0; y + 1 < height; ++y) {
+                    if (rows[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)] == '0' &&
+                        rows[static_cast<std::size_t>(y + 1)][static_cast<std::size_t>(x)] == '1') {
+                        cells.push_back({x, y});
+                    }
+                }
+            }
+            return cells;
+        }
+
+        // Indices into 'cells' of 'count' enemies (count <= cells.size()).
+        std::vector<std::size_t> pick_cells(std::size_t cell_count, std::size_t count, EnemyDistribution distribution, GeneratorRng &rng) {
+            std::vector<std::size_t> picked;
+            picked.reserve(count);
+            if (count == 0 || cell_count == 0) return picked;
+
+            switch (distribution) {
+                case EnemyDistribution::Uniform:
+                    for (std::size_t i = 0; i < count; ++i) {
+                        picked.push_back(i * cell_count / count);
+                    }
+                    break;
+                case EnemyDistribution::Random: {
+                    // Partial Fisher-Yates shuffle.
+                    std::vector<std::size_t> order(cell_count);
+                    for (std::size_t i = 0; i < cell_count; ++i) order[i] = i;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        const auto j = static_cast<std::size_t>(rng.next_int(static_cast<int>(i), static_cast<int>(cell_count - 1)));
+                        std::swap(order[i], order[j]);
+                        picked.push_back(order[i]);
+                    }
+                    break;
+                }
+                case EnemyDistribution::Clustered: {
+                    // Each cluster takes the free cells nearest to a random centre, alternating sides.
+                    std::vector<bool> used(cell_count, false);
+                    while (picked.size() < count) {
+                        const auto centre = static_cast<std::size_t>(rng.next_int(0, static_cast<int>(cell_count - 1)));
+                        std::size_t taken = 0;
+                        for (std::size_t step = 0; taken < CLUSTER_SIZE && picked.size() < count && step < 2 * cell_count; ++step) {
+                            const auto offset = static_cast<std::ptrdiff_t>((step + 1) / 2) * (step % 2 == 0 ? 1 : -1);
+                            const auto index = static_cast<std::ptrdiff_t>(centre) + offset;
+                            if (index < 0 || index >= static_cast<std::ptrdiff_t>(cell_count) || used[static_cast<std::size_t>(index)]) {
+                                continue;
+                            }
+                            used[static_cast<std::size_t>(index)] = true;
+                            picked.push_back(static_cast<std::size_t>(index));
+                            ++taken;
+                        }
+                    }
+                    break;
+                }
+            }
+            return picked;
+        }
+
+        void write_string(std::string &out, std::string_view text) {
+            out += '"';
+            out += text;
+            out += '"';
+        }
+    }
+
+    // Used by: tools/level_generator, zia_bench
+    GeneratedLevel generate_level(const LevelGeneratorParams &params) {
+        const int width = std::max(SAFE_COLUMNS + SAFE_END_COLUMNS + 4, params.width);
+        const int height = std::max(8, params.height);
+        const int ground = height - 2;
+        GeneratorRng rng(params.seed);
+
+        std::vector<std::string> rows(static_cast<std::size_t>(height), std::string(static_cast<std::size_t>(width), '0'));
+        auto cell = [&rows](int x, int y) -> char & { return rows[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)]; };
+
+        // Two rows of ground with occasional pits.
+        for (int x = 0; x < width; ++x) {
+            cell(x, ground) = '1';
+            cell(x, ground + 1) = '1';
+        }
+        const float gap_chance = std::clamp(params.gap_chance, 0.0f, 1.0f);
+        for (int x = SAFE_COLUMNS; x < width - SAFE_END_COLUMNS; ++x) {
+            if (rng.next_unit() >= gap_chance) continue;
+            const int pit = std::min(rng.next_int(2, 4), width - SAFE_END_COLUMNS - x);
+            for (int i = 0; i < pit; ++i) {
+                cell(x + i, ground) = '0';
+                cell(x + i, ground + 1) = '0';
+            }
+            // Keep at least two solid columns between pits.
+            x += pit + 2;
+        }
+
+        // Floating platforms between two and ten tiles above the ground. With platforms 3..9 tiles long
+        // (6 on average), gaps averaging 6 * (1 - density) / density cover 'density' of the columns.
+        const float density = std::clamp(params.platform_density, 0.0f, 0.95f);
+        if (density > 0.0f) {
+            const float mean_gap = 6.0f * (1.0f - density) / density;
+            const int min_gap = std::max(1, static_cast<int>(mean_gap * 0.5f));
+            const int max_gap = std::max(min_gap, static_cast<int>(mean_gap * 1.5f + 0.5f));
+            const int top_row = std::max(1, ground - 10);
+            const int bottom_row = std::max(top_row, ground - 3);
+            for (int x = SAFE_COLUMNS + rng.next_int(0, max_gap); x < width;) {
+                const int row = rng.next_int(top_row, bottom_row);
+                const int length = rng.next_int(3, 9);
+                for (int i = 0; i < length && x + i < width; ++i) {
+                    cell(x + i, row) = '1';
+                }
+                x += length + rng.next_int(min_gap, max_gap);
+            }
+        }
+
+        GeneratedLevel level;
+        for (const auto &row : rows) {
+            level.solid_tiles += static_cast<std::uint64_t>(std::count(row.begin(), row.end(), '1'));
+        }
+
+        // Enemies stand on the ground and on platforms; any surplus is dropped from random empty cells.
+        const float koopa_ratio = std::clamp(params.koopa_ratio, 0.0f, 1.0f);
+        auto enemy_char = [&rng, koopa_ratio]() { return rng.next_unit() < koopa_ratio ? 'K' : 'G'; };
+        const auto cells = standing_cells(rows, width, height);
+        const auto requested = static_cast<std::size_t>(std::max(0, params.enemy_count));
+        const auto standing = std::min(requested, cells.size());
+        for (const std::size_t index : pick_cells(cells.size(), standing, params.distribution, rng)) {
+            cell(cells[index].x, cells[index].y) = enemy_char();
+        }
+        level.enemies = static_cast<int>(standing);
+        const auto max_attempts = (requested - standing) * 16;
+        for (std::size_t attempt = 0; level.enemies < static_cast<int>(requested) && attempt < max_attempts; ++attempt) {
+            const int x = rng.next_int(SAFE_COLUMNS, width - 1);
+            const int y = rng.next_int(0, ground - 1);
+            if (cell(x, y) != '0') continue;
+            cell(x, y) = enemy_char();
+            ++level.enemies;
+            ++level.airborne_enemies;
+        }
+
+        // The JSON schema of the shipped levels.
+        std::string &json = level.json;
+        json.reserve(static_cast<std::size_t>(width + 8) * static_cast<std::size_t>(height) + 1024);
+        json += "{\n  \"width\": " + std::to_string(width) + ",\n  \"height\": " + std::to_string(height) + ",\n";
+        json += "  \"background\": ";
+        write_string(json, SKY_PATH);
+        json += ",\n  \"background_scale\": 1.0,\n  \"clouds\": ";
+        json += params.clouds ? "true" : "false";
+        json += ",\n  \"background_layers\": [";
+        for (int i = 0; i < std::max(0, params.background_layers); ++i) {
+            const float parallax = std::min(0.9f, 0.2f + 0.15f * static_cast<float>(i));
+            json += i == 0 ? "\n    {\"path\": " : ",\n    {\"path\": ";
+            write_string(json, LAYER_ART[static_cast<std::size_t>(i) % LAYER_ART.size()]);
+            json += ", \"scale\": 1.0, \"parallax\": " + std::to_string(parallax) + ", \"repeat\": true, \"repeat_x\": true}";
+        }
+        json += params.background_layers > 0 ? "\n  ],\n" : "],\n";
+        json += "  \"entities\": [\n    {\"type\": \"player\", \"name\": \"player1\", \"x\": 2, \"y\": " + std::to_string(ground - 1) + "}\n  ],\n";
+        json += "  \"rows\": [\n";
+        for (std::size_t y = 0; y < rows.size(); ++y) {
+            json += "    ";
+            write_string(json, rows[y]);
+            json += y + 1 < rows.size() ? ",\n" : "\n";
+        }
+        json += "  ]\n}\n";
+        return level;
+    }
+
+    // Used by: tools/level_generator, zia_bench
+    bool write_generated_level(const GeneratedLevel &level, const std::filesystem::path &json_path, bool compile) {
+        {
+            std::ofstream out(json_path, std::ios::binary | std::ios::trunc);
+            out << level.json;
+            if (!out) {
+                std::cerr << "write_generated_level: cannot write '" << json_path.string() << "'" << std::endl;
+                return false;
+            }
+        }
+        if (!compile) return true;
+
+        Level loaded;
+        loaded.load_json(json_path.string());
+        return write_compiled_level(loaded, compiled_level_path(json_path));
+    }
+
+    bool parse_enemy_distribution(std::string_view text, EnemyDistribution &out) {
+        if (text == "uniform") {
+            out = EnemyDistribution::Uniform;
+        } else if (text == "random") {
+            out = EnemyDistribution::Random;
+        } else if (text == "clustered") {
+            out = EnemyDistribution::Clustered;
+        } else {
+            return false;
+        }
+        return true;
+    }
+} // namespace zia
@@ -1,280 +1,182 @@
 #include "Zia/game/world/TileMap.hpp"
+#include "Zia/game/world/JsonDocument.hpp"
+#include "Zia/engine/IAssetManager.hpp"
+#include "Zia/engine/profiling/Profiler.hpp"
 
 #include <algorithm>
 #include <cctype>
-#include <filesystem>
-#include <fstream>
 #include <string>
 #include <iostream>
 #include <array>
+#include <chrono>
 
 #include "Zia/game/helpers/Spawner.hpp"
+#include "Zia/game/helpers/Constants.hpp"
 
 namespace zia {
     namespace {
         // Fixed the tile size used project-wide (px). JSON "tileSize" is deprecated and ignored.
         constexpr int kFixedTileSize = 32;
 
-        // Loads a default tile map with a single solid tile and entities.
-        // Used by: TileMap::load (fallback when file not found or invalid)
-        void build_default(TileMap &map, std::optional<std::reference_wrapper<std::vector<EntitySpawn>>> entity_spawns) {
-            map.unload();
-            map.load({}, entity_spawns);
-        }
-
-        // Extract an integer field from a JSON-like string.
-        // Used by: TileMap::load (parsing level JSON)
-        bool extract_int_field(const std::string &text, std::string_view key, int &value) {
-            const std::string needle = std::string("\"") + std::string(key) + "\"";
-            std::size_t pos = text.find(needle);
-            if (pos == std::string::npos) {
-                return false;
-            }
-
-            pos = text.find(':', pos);
-            if (pos == std::string::npos) {
-                return false;
-            }
-
-            ++pos;
-            while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
-                ++pos;
+        // In-memory row-major layers used for JSON and default maps.
+        class DenseTileSource final : public TileSource {
+        public:
+            DenseTileSource(int width, int height, std::vector<TileId> tiles)
+                : _width(width), _height(height), _tiles(std::move(tiles)) {}
+
+            void read_columns(int layer, int first_column, int count, TileId *out) const override {
+                const auto layer_size = static_cast<std::size_t>(_width) * static_cast<std::size_t>(_height);
+                const auto *grid = _tiles.data() + static_cast<std::size_t>(layer) * layer_size;
+                for (int y = 0; y < _height; ++y) {
+                    const auto *row = grid + static_cast<std::size_t>(y) * static_cast<std::size_t>(_width);
+                    std::copy_n(row + first_column, count, out + static_cast<std::size_t>(y) * static_cast<std::size_t>(count));
+                }
             }
 
-            bool negative = false;
-            if (pos < text.size() && text[pos] == '-') {
-                negative = true;
-                ++pos;
+        private:
+            int _width;
+            int _height;
+            std::vector<TileId> _tiles;
+        };
+
+        // Columns [first, first + columns) of every layer, plus the solidity bitset derived from the
+        // tileset. Runs on worker threads for prefetched chunks; everything it reads is immutable.
+        TileMap::ChunkData read_block(const std::shared_ptr<const TileSource> &source, const std::shared_ptr<const Tileset> &tileset,
+                                      int first, int columns, int height, int layers) {
+            ZIA_PROFILE_SCOPE("chunk_read");
+            TileMap::ChunkData data;
+            const auto cells = static_cast<std::size_t>(columns) * static_cast<std::size_t>(height);
+            data.tiles.assign(cells * static_cast<std::size_t>(layers), 0);
+            data.solid.assign((cells + 63) / 64, 0);
+            if (!source || cells == 0) {
+                return data;
             }
-
-            int result = 0;
-            bool found = false;
-            while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]))) {
-                found = true;
-                result = (result * 10) + (text[pos] - '0');
-                ++pos;
+            for (int layer = 0; layer < layers; ++layer) {
+                source->read_columns(layer, first, columns, data.tiles.data() + static_cast<std::size_t>(layer) * cells);
             }
-
-            if (!found) {
-                return false;
+            for (int layer = 0; layer < layers; ++layer) {
+                const auto *tiles = data.tiles.data() + static_cast<std::size_t>(layer) * cells;
+                for (std::size_t i = 0; i < cells; ++i) {
+                    if (tiles[i] != 0 && (tileset->flags(tiles[i]) & TILE_SOLID) != 0) {
+                        data.solid[i >> 6] |= std::uint64_t{1} << (i & 63);
+                    }
+                }
             }
-
-            value = negative ? -result : result;
-            return true;
+            return data;
         }
 
-        // Extract a quoted string field from a JSON-like string.
-        // Used by: TileMap::load (parsing level JSON, entity parsing)
-        bool extract_string_field(const std::string &text, std::string_view key, std::string &value) {
-            const std::string needle = std::string("\"") + std::string(key) + "\"";
-            std::size_t pos = text.find(needle);
-            if (pos == std::string::npos) {
-                return false;
-            }
-
-            pos = text.find(':', pos);
-            if (pos == std::string::npos) {
-                return false;
-            }
-
-            ++pos;
-            while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
-                ++pos;
-            }
-
-            if (pos >= text.size() || text[pos] != '"') {
-                return false;
-            }
-
-            const std::size_t start = pos + 1;
-            const std::size_t end = text.find('"', start);
-            if (end == std::string::npos) {
-                return false;
-            }
-
-            value = text.substr(start, end - start);
-            return true;
+        // Loads a default tile map with a single solid tile and entities.
+        // Used by: TileMap::load (fallback when file not found or invalid)
+        void build_default(TileMap &map, std::optional<std::reference_wrapper<std::pmr::vector<EntitySpawn>>> entity_spawns) {
+            map.unload();
+            map.load({}, entity_spawns);
         }
 
-        bool extract_int_field_any(const std::string &text, const std::array<std::string_view, 2>& keys, int &value) {
+        // First integer member among 'keys' (e.g. "x" or the older "tileX").
+        // Used by: find_player_spawn
+        bool get_int_any(const JsonValue &object, const std::array<std::string_view, 2>& keys, int &value) {
             for (const auto &k : keys) {
-                if (extract_int_field(text, k, value)) {
+                if (object.get(k, value)) {
                     return true;
                 }
             }
             return false;
         }
-        // Used by: TileMap::load (parsing player entity spawn)
-        bool extract_player_spawn(const std::string &text, EntitySpawn &spawn) {
-            const std::string needle = "\"entities\"";
-            std::size_t pos = text.find(needle);
-            if (pos == std::string::npos) {
-                return false;
-            }
-
-            pos = text.find('{', pos);
-            while (pos != std::string::npos) {
-                const std::size_t end = text.find('}', pos);
-                if (end == std::string::npos) {
-                    break;
-                }
 
-                const std::string object = text.substr(pos, end - pos + 1);
-                constexpr std::array<std::string_view,2> x_keys = {"x", "tileX"};
-                constexpr std::array<std::string_view,2> y_keys = {"y", "tileY"};
+        // First "player" entry of the "entities" array (type compared case-insensitively).
+        // Used by: TileMap::load (parsing player entity spawn)
+        bool find_player_spawn(const JsonValue &root, EntitySpawn &spawn) {
+            constexpr std::array<std::string_view,2> x_keys = {"x", "tileX"};
+            constexpr std::array<std::string_view,2> y_keys = {"y", "tileY"};
+            for (const JsonValue entity : root["entities"]) {
                 int tile_x = 0;
                 int tile_y = 0;
                 std::string type;
-                std::string name;
-
-                if (!extract_string_field(object, "type", type) ||
-                    !extract_int_field_any(object, x_keys, tile_x) ||
-                    !extract_int_field_any(object, y_keys, tile_y)) {
-                    pos = end + 1;
+                if (!entity.get("type", type) ||
+                    !get_int_any(entity, x_keys, tile_x) ||
+                    !get_int_any(entity, y_keys, tile_y)) {
                     continue;
                 }
 
-                // Try to extract optional name field
-                extract_string_field(object, "name", name);
-
                 std::transform(type.begin(), type.end(), type.begin(), [](unsigned char ch) {
                     return static_cast<char>(std::tolower(ch));
                 });
-
                 if (type != "player") {
-                    pos = end + 1;
                     continue;
                 }
 
                 spawn.type = "player";
                 spawn.tile_x = tile_x;
                 spawn.tile_y = tile_y;
-                spawn.name = name;
+                // Optional name field
+                spawn.name.clear();
+                entity.get("name", spawn.name);
                 return true;
             }
-
             return false;
         }
-
-        // Extract an array of strings from a JSON-like string.
-        // Used by: TileMap::load (parsing rows array from level JSON)
-        std::vector<std::string> extract_string_array(const std::string &text, std::string_view key) {
-            std::vector<std::string> result;
-            const std::string needle = std::string("\"") + std::string(key) + "\"";
-            std::size_t pos = text.find(needle);
-            if (pos == std::string::npos) {
-                return result;
-            }
-
-            pos = text.find('[', pos);
-            if (pos == std::string::npos) {
-                return result;
-            }
-
-            ++pos;
-            while (pos < text.size()) {
-                if (text[pos] == ']') {
-                    break;
-                }
-                if (text[pos] != '"') {
-                    ++pos;
-                    continue;
-                }
-
-                const std::size_t start = ++pos;
-                const std::size_t end = text.find('"', start);
-                if (end == std::string::npos) {
-                    break;
-                }
-
-                result.emplace_back(text.substr(start, end - start));
-                pos = end + 1;
-            }
-
-            return result;
-        }
-
-        // Open a level file from a given path, searching in multiple locations if necessary.
-        // Used by: TileMap::load (opening JSON level files)
-        std::ifstream open_level_file(std::string_view path) {
-            std::filesystem::path base(path);
-            std::ifstream file{base.string()};
-            if (file) {
-                return file;
-            }
-
-            const std::filesystem::path cwd = std::filesystem::current_path();
-            const std::filesystem::path tries[] = {
-                cwd / base,
-                cwd / ".." / base,
-                cwd / ".." / ".." / base,
-                cwd / ".." / ".." / ".." / base,
-            };
-
-            for (const auto &candidate: tries) {
-                file = std::ifstream{candidate.string()};
-                if (file) {
-                    return file;
-                }
-            }
-
-            return {};
-        }
     }
 
     // Load a tile map from a given identifier, either by ID or by file path.
     // Used by: Level::load (initializes tile map for a level), tests, and any caller that needs to (re)load map data
-    void TileMap::load(std::string_view map_id, std::optional<std::reference_wrapper<std::vector<EntitySpawn>>> entity_spawns) {
+    void TileMap::load(std::string_view map_id, std::optional<std::reference_wrapper<std::pmr::vector<EntitySpawn>>> entity_spawns) {
         if (map_id.empty()) {
-            _width = 50;
-            _height = 18;
-            _tile_size = kFixedTileSize;
-            _tiles.assign(static_cast<std::size_t>(_width * _height), 0);
-
-            for (int x = 0; x < _width; ++x) {
-                _tiles[static_cast<std::size_t>((_height - 1) * _width + x)] = 1;
+            constexpr int width = 50;
+            constexpr int height = 18;
+            auto tileset = Tileset::load(constants::DEFAULT_TILESET_PATH);
+            const TileId block = std::max<TileId>(tileset->id_for_char('1'), 1);
+            std::vector<TileId> tiles(static_cast<std::size_t>(width * height), 0);
+
+            for (int x = 0; x < width; ++x) {
+                tiles[static_cast<std::size_t>((height - 1) * width + x)] = block;
             }
 
             for (int x = 10; x < 16; ++x) {
-                _tiles[static_cast<std::size_t>((_height - 5) * _width + x)] = 1;
+                tiles[static_cast<std::size_t>((height - 5) * width + x)] = block;
             }
+            assign(width, height, 1, std::move(tiles), std::move(tileset));
             if (entity_spawns) {
                 entity_spawns->get().clear();
             }
             return;
         }
 
-        std::ifstream file = open_level_file(map_id);
-
-        // If the file cannot be opened, build a default tile map.
-        if (!file) {
+        JsonDocument document;
+        // If the file cannot be opened or parsed, build a default tile map.
+        if (!document.load_file(map_id)) {
+            if (!document.error().empty()) {
+                std::cerr << "TileMap: " << document.error() << std::endl;
+            }
             build_default(*this, entity_spawns);
             return;
         }
+        load(document.root(), map_id, entity_spawns);
+    }
 
-        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-
+    // Build the tile map from an already parsed level document (see Level::load, which shares one
+    // parse between the tile map and the level metadata).
+    void TileMap::load(const JsonValue &root, std::string_view map_id, std::optional<std::reference_wrapper<std::pmr::vector<EntitySpawn>>> entity_spawns) {
+        ZIA_PROFILE_SCOPE("tile_map_build");
         // If there is no width or height, build a default tile map.
         int width = 0;
         int height = 0;
         int tile_size = kFixedTileSize;
-        if (!extract_int_field(content, "width", width) ||
-            !extract_int_field(content, "height", height)) {
+        if (!root.get("width", width) || !root.get("height", height)) {
             build_default(*this, entity_spawns);
             return;
         }
 
         // NOTE: per-level "tileSize" is deprecated and ignored. Use project-wide TILE_SIZE.
-        const auto rows = extract_string_array(content, "rows");
+        const JsonValue rows = root["rows"];
 
         // Warn if JSON contains a tileSize field to help migration
-        if (content.find("\"tileSize\"") != std::string::npos) {
+        if (root.contains("tileSize")) {
             std::cerr << "Warning: level '" << std::string(map_id) << "' contains 'tileSize' which is deprecated and will be ignored; using project TILE_SIZE=" << kFixedTileSize << std::endl;
         }
 
         // Prefer rows length as a source of truth for map width. If the JSON "width" differs, adopt rows length and warn.
-        if (!rows.empty()) {
-            const int rows_len = static_cast<int>(rows[0].size());
+        if (rows.size() > 0) {
+            const int rows_len = static_cast<int>(rows[std::size_t{0}].as_string().size());
             if (width != rows_len) {
                 std::cerr << "Warning: level '" << std::string(map_id) << "' width field (" << width << ") differs from rows length (" << rows_len << "); using rows length." << std::endl;
                 width = rows_len;
@@ -284,49 +186,100 @@ namespace zia {
         if (entity_spawns) {
             entity_spawns->get().clear();
             EntitySpawn player_spawn;
-            if (extract_player_spawn(content, player_spawn)) {
+            if (find_player_spawn(root, player_spawn)) {
                 entity_spawns->get().push_back(player_spawn);
             }
         }
 
         // If there is no tile size or rows, build a default tile map.
-        if (width <= 0 || height <= 0 || tile_size <= 0 || rows.empty()) {
+        if (width <= 0 || height <= 0 || tile_size <= 0 || rows.size() == 0) {
             build_default(*this, entity_spawns);
             return;
         }
 
-        _width = width;
-        _height = height;
-        _tile_size = tile_size;
-        _tiles.assign(static_cast<std::size_t>(_width * _height), 0);
-
-        // Build the tile map from the parsed data.
-        const int row_count = std::min(static_cast<int>(rows.size()), _height);
-        for (int y = 0; y < row_count; ++y) {
-            const std::string &row = rows[static_cast<std::size_t>(y)];
-            const int col_count = std::min(static_cast<int>(row.size()), _width);
-            for (int x = 0; x < col_count; ++x) {
-                char tile_char = row[static_cast<std::size_t>(x)];
-                if (tile_char == '1') {
-                    _tiles[static_cast<std::size_t>(y * _width + x)] = 1;
-                } else if (tile_char == 'G' || tile_char == 'K') {
-                    if (entity_spawns) {
-                        EntitySpawn spawn;
-                        spawn.type = (tile_char == 'G') ? "goomba" : "koopa";
-                        spawn.tile_x = x;
-                        spawn.tile_y = y;
-                        entity_spawns->get().push_back(spawn);
+        std::string tileset_path(constants::DEFAULT_TILESET_PATH);
+        root.get("tileset", tileset_path);
+        auto tileset = Tileset::load(tileset_path);
+
+        const JsonValue extra_layers = root["layers"];
+        const int layers = 1 + static_cast<int>(extra_layers.size());
+        const auto layer_size = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        std::vector<TileId> tiles(layer_size * static_cast<std::size_t>(layers), 0);
+
+        // Fill one layer from legend rows; 'G'/'K' enemy markers are collected on layer 0 only.
+        const auto read_rows = [&](const JsonValue &layer_rows, TileId *grid, bool collect_spawns) {
+            int y = 0;
+            for (const JsonValue row_value : layer_rows) {
+                if (y >= height) break;
+                const std::string_view row = row_value.as_string();
+                const int col_count = std::min(static_cast<int>(row.size()), width);
+                for (int x = 0; x < col_count; ++x) {
+                    const char tile_char = row[static_cast<std::size_t>(x)];
+                    if (collect_spawns && (tile_char == 'G' || tile_char == 'K')) {
+                        if (entity_spawns) {
+                            // Built in place, so the strings go straight to the vector's allocator.
+                            EntitySpawn &spawn = entity_spawns->get().emplace_back();
+                            spawn.type = (tile_char == 'G') ? "goomba" : "koopa";
+                            spawn.tile_x = x;
+                            spawn.tile_y = y;
+                        }
+                    } else {
+                        grid[static_cast<std::size_t>(y * width + x)] = tileset->id_for_char(tile_char);
                     }
                 }
+                ++y;
+            }
+        };
+
+        // Build the tile map from the parsed data.
+        read_rows(rows, tiles.data(), true);
+        int layer = 1;
+        for (const JsonValue entry : extra_layers) {
+            TileId *grid = tiles.data() + static_cast<std::size_t>(layer++) * layer_size;
+            if (entry["rows"].is_array()) {
+                read_rows(entry["rows"], grid, false);
+                continue;
+            }
+            std::size_t i = 0;
+            for (const JsonValue id : entry["tiles"]) {
+                if (i >= layer_size) break;
+                grid[i++] = static_cast<TileId>(std::clamp(id.as_int(), 0, 0xFFFF));
             }
         }
+        assign(width, height, layers, std::move(tiles), std::move(tileset));
+    }
+
+    // Used by: TileMap::load (JSON and default maps)
+    void TileMap::assign(int width, int height, int layers, std::vector<TileId> tiles, std::shared_ptr<const Tileset> tileset) {
+        assign(width, height, layers, std::make_shared<DenseTileSource>(width, height, std::move(tiles)), std::move(tileset));
+    }
+
+    // Used by: Level::load_compiled, assign (dense grids)
+    void TileMap::assign(int width, int height, int layers, std::shared_ptr<const TileSource> source, std::shared_ptr<const Tileset> tileset) {
+        unload();
+        _width = width;
+        _height = height;
+        _layers = std::max(1, layers);
+        _tile_size = kFixedTileSize;
+        _source = std::move(source);
+        _tileset = tileset ? std::move(tileset) : Tileset::builtin();
+        _chunks = std::vector<Chunk>(static_cast<std::size_t>((width + CHUNK_COLUMNS - 1) / CHUNK_COLUMNS));
     }
 
     // Used by: Level::unload, build_default
     void TileMap::unload() {
-        _tiles.clear();
+        // Pending reads hold their own reference to the source; cancel the queued ones and wait for
+        // those already running so none outlives the map.
+        while (!_in_flight.empty()) {
+            (void) finish_read(_in_flight.back());
+        }
+        _chunks.clear();
+        _resident.clear();
+        _source.reset();
+        _tileset.reset();
         _width = 0;
         _height = 0;
+        _layers = 0;
     }
 
     // Used by: systems that poll TileMap for time-based behavior; currently not used directly but kept for API consistency
@@ -352,8 +305,142 @@ namespace zia {
             return false;
         }
 
-        const auto index = static_cast<std::size_t>(ty * _width + tx);
-        return _tiles[index] != 0;
+        const int chunk = tx / CHUNK_COLUMNS;
+        const auto &entry = _chunks[static_cast<std::size_t>(chunk)];
+        if (!entry.resident) {
+            return false;
+        }
+        const auto index = static_cast<std::size_t>(ty * chunk_width(chunk) + (tx - chunk * CHUNK_COLUMNS));
+        return ((entry.data.solid[index >> 6] >> (index & 63)) & 1u) != 0;
+    }
+
+    // Used by: Level::render
+    TileId TileMap::tile(int layer, int tx, int ty) const {
+        if (layer < 0 || layer >= _layers || tx < 0 || ty < 0 || tx >= _width || ty >= _height) {
+            return 0;
+        }
+
+        const int chunk = tx / CHUNK_COLUMNS;
+        const auto &entry = _chunks[static_cast<std::size_t>(chunk)];
+        if (!entry.resident) {
+            return 0;
+        }
+        const auto cells = static_cast<std::size_t>(chunk_width(chunk)) * static_cast<std::size_t>(_height);
+        const auto index = static_cast<std::size_t>(ty * chunk_width(chunk) + (tx - chunk * CHUNK_COLUMNS));
+        return entry.data.tiles[static_cast<std::size_t>(layer) * cells + index];
+    }
+
+    // Used by: gameplay queries for one-way, hazard and slippery tiles
+    std::uint8_t TileMap::tile_flags(int tx, int ty) const {
+        std::uint8_t flags = 0;
+        for (int layer = 0; layer < _layers; ++layer) {
+            flags |= _tileset->flags(tile(layer, tx, ty));
+        }
+        return flags;
+    }
+
+    // Used by: write_compiled_level, level_compiler
+    void TileMap::copy_layer(int layer, std::vector<TileId> &out) const {
+        out.assign(static_cast<std::size_t>(_width) * static_cast<std::size_t>(_height), 0);
+        if (_source && !out.empty() && layer >= 0 && layer < _layers) {
+            _source->read_columns(layer, 0, _width, out.data());
+        }
+    }
+
+    // Width of 'chunk' in tiles; the last chunk may be narrower than CHUNK_COLUMNS.
+    int TileMap::chunk_width(int chunk) const {
+        return std::min(CHUNK_COLUMNS, _width - chunk * CHUNK_COLUMNS);
+    }
+
+    // Tiles of 'chunk' read from the source.
+    TileMap::ChunkData TileMap::read_chunk(int chunk) const {
+        return read_block(_source, _tileset, chunk * CHUNK_COLUMNS, chunk_width(chunk), _height, _layers);
+    }
+
+    // Used by: ChunkStreamingSystem
+    bool TileMap::is_chunk_resident(int chunk) const {
+        return chunk >= 0 && chunk < chunk_count() && _chunks[static_cast<std::size_t>(chunk)].resident;
+    }
+
+    // Used by: ChunkStreamingSystem (prefetch window)
+    void TileMap::request_chunk(int chunk, engine::IAssetManager &assets) {
+        if (chunk < 0 || chunk >= chunk_count()) return;
+        auto &entry = _chunks[static_cast<std::size_t>(chunk)];
+        if (entry.resident || entry.read) return;
+        auto read = std::make_shared<PendingRead>();
+        entry.pending = read->result.get_future();
+        entry.read = read;
+        _in_flight.push_back(chunk);
+        // The job gets its own copies of everything it reads, so it never touches the map.
+        assets.submit_job(engine::AssetPriority::High, [read, source = _source, tileset = _tileset, first = chunk * CHUNK_COLUMNS,
+                                                         columns = chunk_width(chunk), height = _height, layers = _layers]() {
+            if (read->started.exchange(true)) return;
+            try {
+                read->result.set_value(read_block(source, tileset, first, columns, height, layers));
+            } catch (...) {
+                read->result.set_exception(std::current_exception());
+            }
+        });
+    }
+
+    // Used by: ChunkStreamingSystem (chunks the player is about to touch)
+    void TileMap::load_chunk_now(int chunk) {
+        if (chunk < 0 || chunk >= chunk_count()) return;
+        auto &entry = _chunks[static_cast<std::size_t>(chunk)];
+        if (entry.resident) return;
+        auto data = entry.read ? finish_read(chunk) : std::nullopt;
+        mark_resident(chunk, data ? std::move(*data) : read_chunk(chunk));
+    }
+
+    // Used by: ChunkStreamingSystem (per frame)
+    void TileMap::poll_chunks(std::vector<int> &loaded) {
+        for (std::size_t i = 0; i < _in_flight.size();) {
+            const int chunk = _in_flight[i];
+            if (_chunks[static_cast<std::size_t>(chunk)].pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                ++i;
+                continue;
+            }
+            // Ready means a worker ran it, so finish_read returns its data (and drops it from _in_flight).
+            auto data = finish_read(chunk);
+            mark_resident(chunk, std::move(*data));
+            loaded.push_back(chunk);
+        }
+    }
+
+    // Used by: ChunkStreamingSystem (chunks far behind or ahead of the view)
+    void TileMap::evict_chunk(int chunk) {
+        if (chunk < 0 || chunk >= chunk_count()) return;
+        auto &entry = _chunks[static_cast<std::size_t>(chunk)];
+        if (entry.read) {
+            (void) finish_read(chunk);
+        }
+        if (entry.resident) {
+            _resident.erase(std::find(_resident.begin(), _resident.end(), chunk));
+        }
+        entry.data = {};
+        entry.resident = false;
+    }
+
+    std::optional<TileMap::ChunkData> TileMap::finish_read(int chunk) {
+        auto &entry = _chunks[static_cast<std::size_t>(chunk)];
+        std::optional<ChunkData> data;
+        if (entry.read->started.exchange(true)) {
+            // A worker got there first; wait for its result.
+            data = entry.pending.get();
+        }
+        entry.read.reset();
+        entry.pending = {};
+        _in_flight.erase(std::find(_in_flight.begin(), _in_flight.end(), chunk));
+        return data;
+    }
+
+    void TileMap::mark_resident(int chunk, ChunkData data) {
+        auto &entry = _chunks[static_cast<std::size_t>(chunk)];
+        entry.data = std::move(data);
+        if (!entry.resident) {
+            entry.resident = true;
+            _resident.push_back(chunk);
+        }
     }
 
     // Used by: various callers that need clamped tile indices (helpers/tileSweep, systems). Provides safe clamping.
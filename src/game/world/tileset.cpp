@@ -0,0 +1,109 @@
+// Implements Tileset loading: the tileset JSON is parsed once into a flat property table and an art
+// table indexed by tile id.
+
+#include "Zia/game/world/Tileset.hpp"
+#include "Zia/game/world/JsonDocument.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace zia {
+    namespace {
+        // Property names accepted in a tile's "flags" array.
+        std::uint8_t flag_from_name(std::string_view name) {
+            if (name == "solid") return TILE_SOLID;
+            if (name == "one_way") return TILE_ONE_WAY;
+            if (name == "hazard") return TILE_HAZARD;
+            if (name == "slippery") return TILE_SLIPPERY;
+            return 0;
+        }
+    }
+
+    Tileset::Tileset() : _flags(1, 0), _art(1) {}
+
+    // Used by: TileMap::load (level "tileset" field), Level::load_compiled
+    std::shared_ptr<const Tileset> Tileset::load(std::string_view path) {
+        JsonDocument document;
+        if (path.empty() || !document.load_file(path)) {
+            std::cerr << "Tileset: cannot load '" << std::string(path) << "'";
+            if (!document.error().empty()) std::cerr << " (" << document.error() << ")";
+            std::cerr << ", using the builtin tileset" << std::endl;
+            return builtin();
+        }
+
+        const JsonValue root = document.root();
+        auto tileset = std::shared_ptr<Tileset>(new Tileset());
+        tileset->_path = std::string(path);
+
+        int tile_width = 0;
+        int tile_height = 0;
+        root.get("tile_width", tile_width);
+        root.get("tile_height", tile_height);
+
+        for (const JsonValue image : root["images"]) {
+            tileset->_images.emplace_back(image.as_string());
+        }
+
+        for (const JsonValue entry : root["tiles"]) {
+            int id = 0;
+            if (!entry.get("id", id) || id <= 0 || id > std::numeric_limits<TileId>::max()) {
+                std::cerr << "Tileset: '" << tileset->_path << "' has a tile without a valid id, skipped" << std::endl;
+                continue;
+            }
+            const auto index = static_cast<std::size_t>(id);
+            if (index >= tileset->_flags.size()) {
+                tileset->_flags.resize(index + 1, 0);
+                tileset->_art.resize(index + 1);
+            }
+
+            std::uint8_t flags = 0;
+            for (const JsonValue name : entry["flags"]) {
+                flags |= flag_from_name(name.as_string());
+            }
+            tileset->_flags[index] = flags;
+
+            int image = -1;
+            if (entry.get("image", image) && image >= 0 && static_cast<std::size_t>(image) < tileset->_images.size()) {
+                int x = 0;
+                int y = 0;
+                int width = tile_width;
+                int height = tile_height;
+                entry.get("x", x);
+                entry.get("y", y);
+                entry.get("width", width);
+                entry.get("height", height);
+                auto &art = tileset->_art[index];
+                art.image = static_cast<std::uint16_t>(image);
+                art.x = static_cast<std::uint16_t>(std::max(0, x));
+                art.y = static_cast<std::uint16_t>(std::max(0, y));
+                art.width = static_cast<std::uint16_t>(std::max(0, width));
+                art.height = static_cast<std::uint16_t>(std::max(0, height));
+            }
+
+            std::string symbol;
+            if (entry.get("char", symbol) && symbol.size() == 1 && static_cast<unsigned char>(symbol[0]) < tileset->_legend.size()) {
+                tileset->_legend[static_cast<unsigned char>(symbol[0])] = static_cast<TileId>(id);
+            }
+        }
+        return tileset;
+    }
+
+    // Used by: Tileset::load (fallback), TileMap (maps built without a tileset)
+    std::shared_ptr<const Tileset> Tileset::builtin() {
+        static const std::shared_ptr<const Tileset> instance = [] {
+            auto tileset = std::shared_ptr<Tileset>(new Tileset());
+            tileset->_flags.push_back(TILE_SOLID);
+            tileset->_art.emplace_back();
+            tileset->_legend[static_cast<unsigned char>('1')] = 1;
+            return tileset;
+        }();
+        return instance;
+    }
+
+    // Used by: TileMap::load (level rows)
+    TileId Tileset::id_for_char(char symbol) const {
+        const auto index = static_cast<unsigned char>(symbol);
+        return index < _legend.size() ? _legend[index] : 0;
+    }
+} // namespace zia
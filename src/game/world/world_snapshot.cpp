@@ -0,0 +1,203 @@
+// Implements WorldSnapshot: capture and restore of the ECS, camera and level streaming state.
+
+#include "Zia/game/world/WorldSnapshot.hpp"
+#include "Zia/game/world/Camera.hpp"
+#include "Zia/game/world/Level.hpp"
+#include "Zia/game/world/TileMap.hpp"
+#include "Zia/game/helpers/Spawner.hpp"
+#include "Zia/engine/ecs/components/AnimationComponent.hpp"
+#include "Zia/engine/ecs/components/BackgroundComponent.hpp"
+#include "Zia/engine/ecs/components/CloudComponent.hpp"
+#include "Zia/engine/ecs/components/CollisionInfoComponent.hpp"
+#include "Zia/engine/ecs/components/ColorComponent.hpp"
+#include "Zia/engine/ecs/components/EnemyComponent.hpp"
+#include "Zia/engine/ecs/components/PlayerControllerComponent.hpp"
+#include "Zia/engine/ecs/components/PositionComponent.hpp"
+#include "Zia/engine/ecs/components/SizeComponent.hpp"
+#include "Zia/engine/ecs/components/SpriteComponent.hpp"
+#include "Zia/engine/ecs/components/TypeComponent.hpp"
+#include "Zia/engine/ecs/components/VelocityComponent.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <optional>
+#include <type_traits>
+
+namespace zia::engine {
+    void SnapshotCodec<zia::NameComponent>::write(SnapshotWriter &out, const zia::NameComponent &component) {
+        out.write_value(static_cast<std::uint32_t>(component.value.size()));
+        out.write(component.value.data(), component.value.size());
+    }
+
+    bool SnapshotCodec<zia::NameComponent>::read(SnapshotReader &in, zia::NameComponent &component) {
+        std::uint32_t size = 0;
+        if (!in.read_value(size)) return false;
+        const std::byte *chars = in.view(size);
+        if (!chars) return false;
+        // assign() reuses the string's buffer when the name did not grow.
+        component.value.assign(reinterpret_cast<const char *>(chars), size);
+        return true;
+    }
+} // namespace zia::engine
+
+namespace zia {
+    namespace {
+        // Every component type gameplay creates. A new component type must be added here, or it is
+        // neither saved nor rolled back.
+        using GameComponents = zia::engine::ComponentSnapshot<
+            PositionComponent, VelocityComponent, SizeComponent, CollisionInfoComponent, ColorComponent,
+            EnemyComponent, PlayerControllerComponent, TypeComponent, SpriteComponent, AnimationComponent,
+            BackgroundComponent, CloudComponent, NameComponent>;
+
+        static_assert(std::is_trivially_copyable_v<Camera>, "the camera is saved as raw bytes");
+
+        // Pack 'count' flags into bytes, eight per byte, without a temporary buffer.
+        template<typename Flag>
+        void write_bits(zia::engine::SnapshotWriter &out, std::size_t count, Flag flag) {
+            for (std::size_t base = 0; base < count; base += 8) {
+                std::uint8_t byte = 0;
+                for (std::size_t bit = 0; bit < 8 && base + bit < count; ++bit) {
+                    if (flag(base + bit)) byte |= static_cast<std::uint8_t>(1u << bit);
+                }
+                out.write_value(byte);
+            }
+        }
+
+        // FNV-1a over raw bytes: float bit patterns must match exactly for two runs to count as equal.
+        void hash_bytes(std::uint64_t &hash, const void *data, std::size_t size) {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+        }
+
+        bool bit_at(const std::byte *bits, std::size_t index) {
+            return (std::to_integer<unsigned>(bits[index / 8]) >> (index % 8) & 1u) != 0;
+        }
+    }
+
+    // Used by: PlayPipeline (quick save, level start)
+    void WorldSnapshot::capture(const zia::EntityManager &entities, const Level &level, std::string_view level_path,
+                                const SceneSnapshotState &scene) {
+        const auto tile_map = level.tile_map();
+        const auto camera = level.camera();
+        const auto seed = Spawner::random_seed();
+
+        WorldSnapshotHeader header;
+        header.flags = (camera ? WorldSnapshotHeader::HAS_CAMERA : 0u) | (seed ? WorldSnapshotHeader::HAS_RANDOM_SEED : 0u);
+        header.level_path_size = static_cast<std::uint32_t>(level_path.size());
+        header.spawn_count = static_cast<std::uint32_t>(level.entity_spawns().size());
+        header.chunk_count = tile_map ? static_cast<std::uint32_t>(tile_map->chunk_count()) : 0u;
+        header.entity_counter = entities.entity_counter();
+        header.random_seed = seed.value_or(0u);
+        header.player_id = scene.player_id;
+        header.background_slot = scene.background_slot;
+        header.level_transition_delay = scene.level_transition_delay;
+
+        _data.clear();
+        zia::engine::SnapshotWriter out(_data);
+        out.write_value(header);
+        out.write(level_path.data(), level_path.size());
+        if (camera) {
+            out.write(camera.get(), sizeof(Camera));
+        }
+        write_bits(out, header.spawn_count, [&level](std::size_t i) { return level.spawn_consumed(i); });
+        write_bits(out, header.chunk_count, [&tile_map](std::size_t i) { return tile_map->is_chunk_resident(static_cast<int>(i)); });
+        GameComponents::save(entities, out);
+    }
+
+    // Used by: PlayPipeline (quick load, level restart)
+    bool WorldSnapshot::restore(zia::EntityManager &entities, Level &level, SceneSnapshotState &scene) const {
+        const WorldSnapshotHeader *header = this->header();
+        if (!header) {
+            std::cerr << "WorldSnapshot: nothing to restore" << std::endl;
+            return false;
+        }
+        const auto tile_map = level.tile_map();
+        const auto camera = level.camera();
+        const std::uint32_t chunk_count = tile_map ? static_cast<std::uint32_t>(tile_map->chunk_count()) : 0u;
+        if (header->spawn_count != level.entity_spawns().size() || header->chunk_count != chunk_count ||
+            ((header->flags & WorldSnapshotHeader::HAS_CAMERA) != 0) != static_cast<bool>(camera)) {
+            std::cerr << "WorldSnapshot: snapshot of " << level_path() << " does not match the loaded level" << std::endl;
+            return false;
+        }
+
+        zia::engine::SnapshotReader in(_data.data(), _data.size());
+        in.view(sizeof(WorldSnapshotHeader) + header->level_path_size);
+        if (camera && !in.read(camera.get(), sizeof(Camera))) return false;
+
+        const std::byte *consumed = in.view((header->spawn_count + 7u) / 8u);
+        const std::byte *resident = in.view((header->chunk_count + 7u) / 8u);
+        if (!consumed || !resident) return false;
+        for (std::size_t i = 0; i < header->spawn_count; ++i) {
+            level.set_spawn_consumed(i, bit_at(consumed, i));
+        }
+        for (std::size_t i = 0; i < header->chunk_count; ++i) {
+            const int chunk = static_cast<int>(i);
+            const bool want = bit_at(resident, i);
+            if (want && !tile_map->is_chunk_resident(chunk)) {
+                tile_map->load_chunk_now(chunk);
+            } else if (!want && tile_map->is_chunk_resident(chunk)) {
+                tile_map->evict_chunk(chunk);
+            }
+        }
+
+        if (!GameComponents::restore(entities, in)) {
+            std::cerr << "WorldSnapshot: truncated component data" << std::endl;
+            return false;
+        }
+        entities.set_entity_counter(header->entity_counter);
+        Spawner::set_random_seed((header->flags & WorldSnapshotHeader::HAS_RANDOM_SEED) != 0
+                                     ? std::optional<std::uint32_t>(header->random_seed)
+                                     : std::nullopt);
+        scene.player_id = header->player_id;
+        scene.background_slot = header->background_slot;
+        scene.level_transition_delay = header->level_transition_delay;
+        return true;
+    }
+
+    std::string_view WorldSnapshot::level_path() const {
+        const WorldSnapshotHeader *header = this->header();
+        if (!header) return {};
+        return {reinterpret_cast<const char *>(_data.data() + sizeof(WorldSnapshotHeader)), header->level_path_size};
+    }
+
+    SceneSnapshotState WorldSnapshot::scene_state() const {
+        SceneSnapshotState scene;
+        if (const WorldSnapshotHeader *header = this->header()) {
+            scene.player_id = header->player_id;
+            scene.background_slot = header->background_slot;
+            scene.level_transition_delay = header->level_transition_delay;
+        }
+        return scene;
+    }
+
+    // Used by: Game::world_state_hash (input replays), zia_bench checks
+    std::uint64_t world_state_hash(const zia::EntityManager &entities) {
+        static thread_local std::vector<EntityID> ids;
+        entities.get_entities_with<PositionComponent>(ids);
+        std::sort(ids.begin(), ids.end());
+
+        std::uint64_t hash = 14695981039346656037ull;
+        for (const EntityID id : ids) {
+            hash_bytes(hash, &id, sizeof(id));
+            const auto &position = entities.get_component<PositionComponent>(id)->get();
+            hash_bytes(hash, &position.x, sizeof(position.x));
+            hash_bytes(hash, &position.y, sizeof(position.y));
+            if (const auto velocity = entities.get_component<VelocityComponent>(id)) {
+                hash_bytes(hash, &velocity->get().vx, sizeof(float));
+                hash_bytes(hash, &velocity->get().vy, sizeof(float));
+            }
+        }
+        return hash;
+    }
+
+    const WorldSnapshotHeader *WorldSnapshot::header() const {
+        if (_data.size() < sizeof(WorldSnapshotHeader)) return nullptr;
+        // The buffer comes from operator new, which is aligned for the header.
+        const auto *header = reinterpret_cast<const WorldSnapshotHeader *>(_data.data());
+        if (header->magic != WORLD_SNAPSHOT_MAGIC || header->version != WORLD_SNAPSHOT_VERSION) return nullptr;
+        return header;
+    }
+} // namespace zia
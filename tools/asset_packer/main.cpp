@@ -0,0 +1,156 @@
+// asset_packer: bundles an asset directory into a single .zpak archive (see AssetArchive.hpp).
+//
+// Usage: asset_packer <assets_dir> <output.zpak> [--prefix <key_prefix>] [--predecode]
+//
+// Every regular file under <assets_dir> is stored under the key "<key_prefix>/<relative path>"
+// (prefix defaults to the directory name, e.g. "assets"), matching the paths the game passes to
+// the asset manager. With --predecode, PNG files are stored as raw RGBA8 pixels so the runtime can
+// upload them without decoding.
+
+#include "Zia/engine/resources/AssetArchive.hpp"
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr std::size_t BLOB_ALIGNMENT = 16;
+
+    struct PackedFile {
+        std::string key;
+        std::filesystem::path source;
+        zia::engine::ArchiveEntry entry;
+    };
+
+    bool read_file(const std::filesystem::path& path, std::vector<char>& out) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) return false;
+        out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    bool is_png(const std::filesystem::path& path) {
+        auto ext = path.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return ext == ".png";
+    }
+
+    void pad_to(std::ofstream& out, std::size_t alignment) {
+        static const char zeros[BLOB_ALIGNMENT] = {};
+        const auto pos = static_cast<std::size_t>(out.tellp());
+        const auto padding = (alignment - pos % alignment) % alignment;
+        out.write(zeros, static_cast<std::streamsize>(padding));
+    }
+
+    int usage() {
+        std::cerr << "usage: asset_packer <assets_dir> <output.zpak> [--prefix <key_prefix>] [--predecode]" << std::endl;
+        return 2;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) return usage();
+
+    const std::filesystem::path root(argv[1]);
+    const std::filesystem::path output(argv[2]);
+    std::string prefix = root.filename().string();
+    bool predecode = false;
+    for (int i = 3; i < argc; ++i) {
+        const std::string arg(argv[i]);
+        if (arg == "--predecode") {
+            predecode = true;
+        } else if (arg == "--prefix" && i + 1 < argc) {
+            prefix = argv[++i];
+        } else {
+            return usage();
+        }
+    }
+
+    if (!std::filesystem::is_directory(root)) {
+        std::cerr << "asset_packer: '" << root.string() << "' is not a directory" << std::endl;
+        return 1;
+    }
+
+    // Collect files and their keys; the table of contents is sorted by key hash for binary search.
+    std::vector<PackedFile> files;
+    for (const auto& item : std::filesystem::recursive_directory_iterator(root)) {
+        if (!item.is_regular_file()) continue;
+        PackedFile file;
+        const auto relative = std::filesystem::relative(item.path(), root).generic_string();
+        file.key = zia::engine::normalize_asset_path(prefix.empty() ? relative : prefix + "/" + relative);
+        file.source = item.path();
+        file.entry.path_hash = zia::engine::fnv1a64(file.key);
+        files.push_back(std::move(file));
+    }
+    std::sort(files.begin(), files.end(), [](const PackedFile& a, const PackedFile& b) {
+        return a.entry.path_hash < b.entry.path_hash;
+    });
+    for (std::size_t i = 1; i < files.size(); ++i) {
+        if (files[i].entry.path_hash == files[i - 1].entry.path_hash) {
+            std::cerr << "asset_packer: hash collision between '" << files[i - 1].key << "' and '" << files[i].key << "'" << std::endl;
+            return 1;
+        }
+    }
+
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "asset_packer: cannot write '" << output.string() << "'" << std::endl;
+        return 1;
+    }
+
+    // Header is rewritten at the end once the table of contents offset is known.
+    zia::engine::ArchiveHeader header;
+    header.entry_count = static_cast<std::uint32_t>(files.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<char> bytes;
+    std::size_t predecoded_count = 0;
+    for (auto& file : files) {
+        pad_to(out, BLOB_ALIGNMENT);
+        file.entry.offset = static_cast<std::uint64_t>(out.tellp());
+
+        sf::Image image;
+        if (predecode && is_png(file.source) && image.loadFromFile(file.source)) {
+            const auto size = image.getSize();
+            const auto pixel_bytes = static_cast<std::size_t>(size.x) * size.y * 4u;
+            out.write(reinterpret_cast<const char*>(image.getPixelsPtr()), static_cast<std::streamsize>(pixel_bytes));
+            file.entry.size = pixel_bytes;
+            file.entry.flags = zia::engine::ARCHIVE_FLAG_PREDECODED_RGBA;
+            file.entry.width = size.x;
+            file.entry.height = size.y;
+            ++predecoded_count;
+            continue;
+        }
+
+        if (!read_file(file.source, bytes)) {
+            std::cerr << "asset_packer: cannot read '" << file.source.string() << "'" << std::endl;
+            return 1;
+        }
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        file.entry.size = bytes.size();
+    }
+
+    pad_to(out, alignof(zia::engine::ArchiveEntry));
+    header.toc_offset = static_cast<std::uint64_t>(out.tellp());
+    for (const auto& file : files) {
+        out.write(reinterpret_cast<const char*>(&file.entry), sizeof(file.entry));
+    }
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!out) {
+        std::cerr << "asset_packer: write error on '" << output.string() << "'" << std::endl;
+        return 1;
+    }
+    std::cout << "asset_packer: packed " << files.size() << " files (" << predecoded_count
+              << " pre-decoded) into " << output.string() << std::endl;
+    return 0;
+}
@@ -0,0 +1,58 @@
+// level_compiler: converts level JSON files into the binary .zlvl format (see LevelBinary.hpp).
+//
+// Usage: level_compiler <level.json> [output.zlvl]
+//
+// The output defaults to the input path with a ".zlvl" extension, which is where Level::load looks
+// for it. The level is loaded through the normal JSON path, so the compiled file holds exactly what
+// the game would have built: the tile grid, the resolved spawn table and the background layers.
+
+#include "Zia/game/world/Level.hpp"
+#include "Zia/game/world/LevelBinary.hpp"
+#include "Zia/game/world/TileMap.hpp"
+
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "usage: level_compiler <level.json> [output.zlvl]" << std::endl;
+        return 2;
+    }
+
+    const std::filesystem::path input(argv[1]);
+    const std::filesystem::path output = argc == 3 ? std::filesystem::path(argv[2]) : zia::compiled_level_path(input);
+    if (!std::filesystem::is_regular_file(input)) {
+        std::cerr << "level_compiler: cannot read '" << input.string() << "'" << std::endl;
+        return 1;
+    }
+
+    zia::Level level;
+    level.load_json(input.string());
+    if (!zia::write_compiled_level(level, output)) {
+        return 1;
+    }
+
+    // Read the result back so a broken file fails the build instead of the game.
+    zia::Level check;
+    bool matches = check.load_compiled(output) && check.tile_map() &&
+                   check.tile_map()->layer_count() == level.tile_map()->layer_count() &&
+                   check.entity_spawns().size() == level.entity_spawns().size();
+    std::vector<zia::TileId> expected;
+    std::vector<zia::TileId> actual;
+    for (int layer = 0; matches && layer < level.tile_map()->layer_count(); ++layer) {
+        level.tile_map()->copy_layer(layer, expected);
+        check.tile_map()->copy_layer(layer, actual);
+        matches = (actual == expected);
+    }
+    if (!matches) {
+        std::cerr << "level_compiler: verification of '" << output.string() << "' failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "level_compiler: " << input.string() << " -> " << output.string() << " ("
+              << level.tile_map()->width() << "x" << level.tile_map()->height() << ", "
+              << level.tile_map()->layer_count() << " layer(s), "
+              << level.entity_spawns().size() << " spawns)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,76 @@
+// level_generator: writes procedurally generated stress levels (see LevelGenerator.hpp).
+//
+// Usage: level_generator <output.json> [--seed n] [--width tiles] [--height tiles]
+//                        [--platform-density 0..1] [--gap-chance 0..1] [--enemies n]
+//                        [--distribution uniform|random|clustered] [--koopa-ratio 0..1]
+//                        [--background-layers n] [--no-clouds] [--no-compile]
+//
+// The level is written in the JSON schema of assets/levels and, unless --no-compile is given,
+// compiled to a .zlvl next to it. Example, a ~100k-tile level with 10k enemies:
+//   level_generator stress.json --width 6000 --enemies 10000 --distribution random
+
+#include "Zia/game/world/LevelGenerator.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "usage: level_generator <output.json> [--seed n] [--width tiles] [--height tiles] "
+                     "[--platform-density f] [--gap-chance f] [--enemies n] [--distribution uniform|random|clustered] "
+                     "[--koopa-ratio f] [--background-layers n] [--no-clouds] [--no-compile]" << std::endl;
+        return 2;
+    }
+
+    const std::filesystem::path output(argv[1]);
+    zia::LevelGeneratorParams params;
+    bool compile = true;
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view arg(argv[i]);
+        const bool has_value = i + 1 < argc;
+        if (arg == "--seed" && has_value) {
+            params.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--width" && has_value) {
+            params.width = std::atoi(argv[++i]);
+        } else if (arg == "--height" && has_value) {
+            params.height = std::atoi(argv[++i]);
+        } else if (arg == "--platform-density" && has_value) {
+            params.platform_density = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--gap-chance" && has_value) {
+            params.gap_chance = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--enemies" && has_value) {
+            params.enemy_count = std::atoi(argv[++i]);
+        } else if (arg == "--distribution" && has_value) {
+            if (!zia::parse_enemy_distribution(argv[++i], params.distribution)) {
+                std::cerr << "level_generator: unknown distribution '" << argv[i] << "'" << std::endl;
+                return 2;
+            }
+        } else if (arg == "--koopa-ratio" && has_value) {
+            params.koopa_ratio = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--background-layers" && has_value) {
+            params.background_layers = std::atoi(argv[++i]);
+        } else if (arg == "--no-clouds") {
+            params.clouds = false;
+        } else if (arg == "--no-compile") {
+            compile = false;
+        } else {
+            std::cerr << "level_generator: unknown argument '" << arg << "'" << std::endl;
+            return 2;
+        }
+    }
+
+    const zia::GeneratedLevel level = zia::generate_level(params);
+    if (!zia::write_generated_level(level, output, compile)) {
+        return 1;
+    }
+
+    std::cout << "level_generator: " << output.string() << " (seed " << params.seed << ", " << params.width << "x"
+              << params.height << ", " << level.solid_tiles << " solid tiles, " << level.enemies << " enemies";
+    if (level.airborne_enemies > 0) {
+        std::cout << ", " << level.airborne_enemies << " dropped from the air";
+    }
+    std::cout << ")" << std::endl;
+    return 0;
+}
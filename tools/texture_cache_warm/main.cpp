@@ -0,0 +1,118 @@
+// warm_texture_cache: decodes every image under an asset directory into the on-disk texture cache
+// (see TextureCache.hpp), so the first launch after a fresh checkout or asset edit skips PNG decoding.
+//
+// Usage: warm_texture_cache [assets_dir] [--cache-dir <dir>] [--archive <file> | --no-archive]
+//                           [--prefix <name>] [--clear]
+//
+// assets_dir defaults to "assets". --cache-dir must match the directory the game uses
+// ($ZIA_TEXTURE_CACHE, or .zia_cache/textures under its working directory). --clear deletes every
+// cached blob before warming; stale blobs are otherwise rewritten as their sources are decoded.
+//
+// Images packed into the asset archive are warmed from the archive, since that is where the game
+// reads them. --archive defaults to the game's archive ($ZIA_ASSET_ARCHIVE, or assets.zpak in the
+// working directory). The archive only stores path hashes, so entry names come from assets_dir:
+// each file's archive key is "<prefix>/<path relative to assets_dir>", prefix defaulting to the
+// directory name as in asset_packer.
+
+#include "Zia/engine/resources/AssetArchive.hpp"
+#include "Zia/engine/resources/TextureCache.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+    bool is_image(const std::filesystem::path& path) {
+        auto ext = path.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" || ext == ".tga";
+    }
+
+    int usage() {
+        std::cerr << "usage: warm_texture_cache [assets_dir] [--cache-dir <dir>] [--archive <file> | --no-archive]"
+                     " [--prefix <name>] [--clear]" << std::endl;
+        return 2;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::filesystem::path root("assets");
+    std::filesystem::path cache_dir = zia::engine::TextureCache::default_directory();
+    std::filesystem::path archive_path;
+    bool use_archive = true;
+    std::string prefix;
+    bool prefix_given = false;
+    bool clear = false;
+    bool root_given = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg(argv[i]);
+        if (arg == "--clear") {
+            clear = true;
+        } else if (arg == "--cache-dir" && i + 1 < argc) {
+            cache_dir = argv[++i];
+        } else if (arg == "--archive" && i + 1 < argc) {
+            archive_path = argv[++i];
+        } else if (arg == "--no-archive") {
+            use_archive = false;
+        } else if (arg == "--prefix" && i + 1 < argc) {
+            prefix = argv[++i];
+            prefix_given = true;
+        } else if (!root_given && arg.rfind("--", 0) != 0) {
+            root = arg;
+            root_given = true;
+        } else {
+            return usage();
+        }
+    }
+
+    if (!std::filesystem::is_directory(root)) {
+        std::cerr << "warm_texture_cache: '" << root.string() << "' is not a directory" << std::endl;
+        return 1;
+    }
+
+    if (!prefix_given) prefix = root.filename().string();
+
+    std::shared_ptr<const zia::engine::AssetArchive> archive;
+    if (use_archive && !archive_path.empty()) {
+        auto opened = std::make_shared<zia::engine::AssetArchive>();
+        if (!opened->open(archive_path)) return 1;
+        archive = std::move(opened);
+    } else if (use_archive) {
+        archive = zia::engine::open_default_asset_archive();
+    }
+
+    const zia::engine::TextureCache cache(cache_dir);
+    if (clear) {
+        std::cout << "warm_texture_cache: removed " << cache.clear() << " cached blobs" << std::endl;
+    }
+
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t failures = 0;
+    std::size_t archived = 0;
+    sf::Image image;
+    for (const auto& item : std::filesystem::recursive_directory_iterator(root)) {
+        if (!item.is_regular_file() || !is_image(item.path())) continue;
+        const auto relative = std::filesystem::relative(item.path(), root).generic_string();
+        const auto key = zia::engine::normalize_asset_path(prefix.empty() ? relative : prefix + "/" + relative);
+        const bool in_archive = archive && archive->contains(key);
+        if (in_archive) ++archived;
+        const auto result = in_archive ? cache.decode(*archive, key, image) : cache.decode(item.path(), image);
+        switch (result) {
+            case zia::engine::TextureCache::DecodeResult::Hit: ++hits; break;
+            case zia::engine::TextureCache::DecodeResult::Miss: ++misses; break;
+            case zia::engine::TextureCache::DecodeResult::Failed:
+                std::cerr << "warm_texture_cache: cannot decode '" << item.path().string() << "'" << std::endl;
+                ++failures;
+                break;
+        }
+    }
+
+    std::cout << "warm_texture_cache: " << misses << " decoded, " << hits << " already cached, "
+              << failures << " failed (" << archived << " from " << (archive ? archive->path().string() : "no archive")
+              << ") -> " << cache.directory().string() << std::endl;
+    return failures == 0 ? 0 : 1;
+}